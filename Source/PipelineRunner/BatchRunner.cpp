@@ -0,0 +1,456 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BatchRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <hdf5.h>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractErrorMessage.h"
+#include "SIMPLib/Messages/AbstractWarningMessage.h"
+
+namespace
+{
+std::mutex s_OutputMutex;
+
+/**
+ * @brief Prints the errors and warnings of one job prefixed with its name and keeps the last
+ * error for the summary. Status and progress messages of concurrent jobs would only interleave.
+ */
+class JobObserver : public Observer
+{
+public:
+  explicit JobObserver(const QString& jobName)
+  : m_JobName(jobName)
+  {
+  }
+
+  ~JobObserver() override = default;
+
+  void processPipelineMessage(const AbstractMessage::Pointer& pm) override
+  {
+    bool isError = (dynamic_cast<const AbstractErrorMessage*>(pm.get()) != nullptr);
+    bool isWarning = (dynamic_cast<const AbstractWarningMessage*>(pm.get()) != nullptr);
+    if(!isError && !isWarning)
+    {
+      return;
+    }
+
+    QString msg = pm->generateMessageString();
+    if(isError)
+    {
+      m_LastError = msg;
+    }
+    std::lock_guard<std::mutex> lock(s_OutputMutex);
+    std::cout << "[" << m_JobName.toStdString() << "] " << msg.toStdString() << std::endl;
+  }
+
+  QString getLastError() const
+  {
+    return m_LastError;
+  }
+
+  JobObserver(const JobObserver&) = delete;            // Copy Constructor Not Implemented
+  JobObserver(JobObserver&&) = delete;                 // Move Constructor Not Implemented
+  JobObserver& operator=(const JobObserver&) = delete; // Copy Assignment Not Implemented
+  JobObserver& operator=(JobObserver&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  QString m_JobName;
+  QString m_LastError;
+};
+
+// -----------------------------------------------------------------------------
+int64_t sizeOfNamedFiles(const QJsonValue& value)
+{
+  int64_t size = 0;
+  if(value.isObject())
+  {
+    QJsonObject obj = value.toObject();
+    for(auto iter = obj.constBegin(); iter != obj.constEnd(); ++iter)
+    {
+      size += sizeOfNamedFiles(iter.value());
+    }
+  }
+  else if(value.isString())
+  {
+    QFileInfo fi(value.toString());
+    if(fi.isFile())
+    {
+      size += fi.size();
+    }
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BatchRunner::BatchRunner(size_t concurrency, int64_t memoryBudget)
+: m_Concurrency(std::max<size_t>(1, concurrency))
+, m_MemoryBudget(memoryBudget)
+{
+  if(m_Concurrency > 1 && !IsHDF5ThreadSafe())
+  {
+    std::cout << "The HDF5 library is not thread safe, batch jobs will execute one at a time" << std::endl;
+    m_Concurrency = 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BatchRunner::~BatchRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BatchRunner::getConcurrency() const
+{
+  return m_Concurrency;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchRunner::IsHDF5ThreadSafe()
+{
+  hbool_t isThreadSafe = 0;
+  if(H5is_library_threadsafe(&isThreadSafe) < 0)
+  {
+    return false;
+  }
+  return isThreadSafe > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchRunner::readManifest(const QString& filePath, QString& errorMessage)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    errorMessage = QString("The manifest '%1' could not be opened: %2").arg(filePath).arg(file.errorString());
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError)
+  {
+    errorMessage = QString("The manifest '%1' could not be parsed: %2").arg(filePath).arg(parseError.errorString());
+    return false;
+  }
+
+  QDir manifestDir = QFileInfo(filePath).absoluteDir();
+  QJsonObject manifestObj = doc.object();
+  QString defaultPipeline = manifestObj["Pipeline"].toString();
+
+  m_Jobs.clear();
+  m_Pipelines.clear();
+  QJsonArray jobsArray = manifestObj["Jobs"].toArray();
+  for(int i = 0; i < jobsArray.size(); i++)
+  {
+    QJsonObject jobObj = jobsArray[i].toObject();
+
+    Job job;
+    job.name = jobObj["Name"].toString(QString("Job_%1").arg(i));
+    job.pipelineFile = jobObj["Pipeline"].toString(defaultPipeline);
+    if(job.pipelineFile.isEmpty())
+    {
+      errorMessage = QString("Job '%1' of the manifest does not name a pipeline").arg(job.name);
+      return false;
+    }
+    job.pipelineFile = QDir::cleanPath(manifestDir.absoluteFilePath(job.pipelineFile));
+    job.overrides = jobObj["Overrides"].toObject();
+    job.estimatedMemory = jobObj.contains("EstimatedMemory") ? static_cast<int64_t>(jobObj["EstimatedMemory"].toDouble()) : sizeOfNamedFiles(job.overrides);
+
+    // Every pipeline file is read and parsed once for all the jobs that use it
+    if(!m_Pipelines.contains(job.pipelineFile))
+    {
+      QFile pipelineFile(job.pipelineFile);
+      if(!pipelineFile.open(QIODevice::ReadOnly))
+      {
+        errorMessage = QString("The pipeline '%1' of job '%2' could not be opened: %3").arg(job.pipelineFile).arg(job.name).arg(pipelineFile.errorString());
+        return false;
+      }
+      QJsonDocument pipelineDoc = QJsonDocument::fromJson(pipelineFile.readAll(), &parseError);
+      if(parseError.error != QJsonParseError::NoError)
+      {
+        errorMessage = QString("The pipeline '%1' of job '%2' could not be parsed: %3").arg(job.pipelineFile).arg(job.name).arg(parseError.errorString());
+        return false;
+      }
+      m_Pipelines.insert(job.pipelineFile, pipelineDoc.object());
+    }
+
+    m_Jobs.push_back(job);
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BatchRunner::getJobCount() const
+{
+  return m_Jobs.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<BatchRunner::Result> BatchRunner::execute()
+{
+  std::vector<Result> results(m_Jobs.size());
+  std::atomic<size_t> nextJob = {0};
+  std::atomic<size_t> finishedJobs = {0};
+
+  auto worker = [&]() {
+    for(size_t index = nextJob++; index < m_Jobs.size(); index = nextJob++)
+    {
+      const Job& job = m_Jobs[index];
+      int64_t reserved = reserveMemory(job.estimatedMemory);
+      results[index] = runJob(job);
+      releaseMemory(reserved);
+
+      std::lock_guard<std::mutex> lock(s_OutputMutex);
+      std::cout << "[" << ++finishedJobs << "/" << m_Jobs.size() << "] " << job.name.toStdString() << ": " << results[index].status.toStdString() << std::endl;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  size_t threadCount = std::min(m_Concurrency, m_Jobs.size());
+  for(size_t i = 0; i < threadCount; i++)
+  {
+    threads.emplace_back(worker);
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BatchRunner::Result BatchRunner::runJob(const Job& job)
+{
+  Result result;
+  result.name = job.name;
+  result.pipelineFile = job.pipelineFile;
+  result.startTime = QDateTime::currentDateTime().toString(Qt::ISODate);
+  result.status = "Failed";
+
+  QJsonObject pipelineObj = m_Pipelines.value(job.pipelineFile);
+  if(!ApplyOverrides(pipelineObj, job.overrides, result.message))
+  {
+    result.errorCode = -1;
+    return result;
+  }
+
+  // The filters are created in this thread so that their notifications are delivered directly
+  FilterPipeline::Pointer pipeline;
+  {
+    std::lock_guard<std::mutex> lock(m_FactoryMutex);
+    pipeline = FilterPipeline::FromJson(pipelineObj);
+  }
+  if(pipeline.get() == nullptr)
+  {
+    result.errorCode = -2;
+    result.message = "The pipeline could not be created from the JSON data";
+    return result;
+  }
+
+  JobObserver obs(job.name);
+  pipeline->addMessageReceiver(&obs);
+
+  auto start = std::chrono::steady_clock::now();
+  try
+  {
+    result.errorCode = pipeline->preflightPipeline();
+  } catch(const std::exception& exception)
+  {
+    result.errorCode = -3;
+    result.message = QString("Caught exception while preflighting pipeline: %1").arg(exception.what());
+    return result;
+  }
+  result.preflightSeconds = secondsSince(start);
+  if(result.errorCode < 0)
+  {
+    result.message = obs.getLastError();
+    return result;
+  }
+
+  start = std::chrono::steady_clock::now();
+  try
+  {
+    pipeline->execute();
+  } catch(const std::exception& exception)
+  {
+    result.errorCode = -4;
+    result.message = QString("Caught exception while executing pipeline: %1").arg(exception.what());
+    return result;
+  }
+  result.executeSeconds = secondsSince(start);
+  result.errorCode = pipeline->getErrorCode();
+  if(result.errorCode < 0)
+  {
+    result.message = obs.getLastError();
+    return result;
+  }
+
+  result.status = (pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Canceled) ? "Canceled" : "Completed";
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t BatchRunner::reserveMemory(int64_t bytes)
+{
+  if(m_MemoryBudget <= 0)
+  {
+    return 0;
+  }
+
+  // A job larger than the whole budget still runs, just never next to another one
+  bytes = std::min(std::max<int64_t>(bytes, 0), m_MemoryBudget);
+  std::unique_lock<std::mutex> lock(m_MemoryMutex);
+  m_MemoryReleased.wait(lock, [&]() { return m_MemoryInUse + bytes <= m_MemoryBudget; });
+  m_MemoryInUse += bytes;
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchRunner::releaseMemory(int64_t bytes)
+{
+  if(bytes <= 0)
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_MemoryMutex);
+    m_MemoryInUse -= bytes;
+  }
+  m_MemoryReleased.notify_all();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchRunner::ApplyOverrides(QJsonObject& pipelineObj, const QJsonObject& overrides, QString& errorMessage)
+{
+  for(auto iter = overrides.constBegin(); iter != overrides.constEnd(); ++iter)
+  {
+    if(!pipelineObj.contains(iter.key()) || !pipelineObj[iter.key()].isObject() || !iter.value().isObject())
+    {
+      errorMessage = QString("The overrides refer to filter '%1' which the pipeline does not have").arg(iter.key());
+      return false;
+    }
+
+    QJsonObject filterObj = pipelineObj[iter.key()].toObject();
+    const QJsonObject values = iter.value().toObject();
+    for(auto valueIter = values.constBegin(); valueIter != values.constEnd(); ++valueIter)
+    {
+      filterObj[valueIter.key()] = valueIter.value();
+    }
+    pipelineObj[iter.key()] = filterObj;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchRunner::WriteSummary(const QString& filePath, const std::vector<Result>& results, double elapsedSeconds)
+{
+  QJsonArray jobsArray;
+  int completed = 0;
+  for(const Result& result : results)
+  {
+    QJsonObject jobObj;
+    jobObj["Name"] = result.name;
+    jobObj["Pipeline"] = result.pipelineFile;
+    jobObj["Status"] = result.status;
+    jobObj["ErrorCode"] = result.errorCode;
+    jobObj["Message"] = result.message;
+    jobObj["StartTime"] = result.startTime;
+    jobObj["PreflightSeconds"] = result.preflightSeconds;
+    jobObj["ExecuteSeconds"] = result.executeSeconds;
+    jobsArray.push_back(jobObj);
+
+    if(result.status == "Completed")
+    {
+      completed++;
+    }
+  }
+
+  QJsonObject summaryObj;
+  summaryObj["Jobs"] = jobsArray;
+  summaryObj["Completed"] = completed;
+  summaryObj["Failed"] = static_cast<int>(results.size()) - completed;
+  summaryObj["ElapsedSeconds"] = elapsedSeconds;
+
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  file.write(QJsonDocument(summaryObj).toJson());
+  return true;
+}
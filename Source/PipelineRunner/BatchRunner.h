@@ -0,0 +1,171 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+/**
+ * @brief The BatchRunner class executes the jobs of a batch manifest concurrently inside one
+ * process, so plugins are loaded and every pipeline file is parsed only once for the whole batch.
+ *
+ * The manifest is a JSON file of the following form. Relative paths are resolved against the
+ * directory of the manifest, a job without a "Pipeline" uses the top level one.
+ * <code><pre>
+ * {
+ *   "Pipeline": "Segmentation.json",
+ *   "Jobs": [
+ *     {
+ *       "Name": "Specimen_0001",
+ *       "Overrides": { "0": { "InputFile": "/data/Specimen_0001.dream3d" }, "7": { "OutputFile": "/out/Specimen_0001.dream3d" } },
+ *       "EstimatedMemory": 2147483648
+ *     }
+ *   ]
+ * }
+ * </pre></code>
+ * "Overrides" maps a filter index of the pipeline to the parameter values that replace the ones
+ * of the pipeline file. "EstimatedMemory" is the number of bytes the job is expected to use,
+ * without it the total size of the existing files named in the overrides is used.
+ *
+ * Readers and writers of every job call into HDF5 from the job's thread. If the HDF5 library was
+ * not built thread safe the jobs run one after the other.
+ */
+class BatchRunner
+{
+public:
+  struct Job
+  {
+    QString name;
+    QString pipelineFile;
+    QJsonObject overrides;
+    int64_t estimatedMemory = 0;
+  };
+
+  struct Result
+  {
+    QString name;
+    QString pipelineFile;
+    QString status;
+    int32_t errorCode = 0;
+    QString message;
+    QString startTime;
+    double preflightSeconds = 0.0;
+    double executeSeconds = 0.0;
+  };
+
+  /**
+   * @brief Constructor
+   * @param concurrency Maximum number of jobs executing at the same time. Reduced to 1 if the
+   * HDF5 library is not thread safe.
+   * @param memoryBudget Bytes the estimated memory of all executing jobs may add up to, 0 for no limit
+   */
+  BatchRunner(size_t concurrency, int64_t memoryBudget);
+  ~BatchRunner();
+
+  /**
+   * @brief Returns the maximum number of jobs executing at the same time.
+   * @return
+   */
+  size_t getConcurrency() const;
+
+  /**
+   * @brief Returns whether the HDF5 library may be called from several threads at the same time.
+   * @return
+   */
+  static bool IsHDF5ThreadSafe();
+
+  /**
+   * @brief Reads the jobs of the manifest and parses every pipeline file they use.
+   * @param filePath
+   * @param errorMessage Set if the manifest or one of the pipeline files could not be read
+   * @return
+   */
+  bool readManifest(const QString& filePath, QString& errorMessage);
+
+  /**
+   * @brief Returns the number of jobs read from the manifest.
+   * @return
+   */
+  size_t getJobCount() const;
+
+  /**
+   * @brief Executes every job and returns their results in manifest order.
+   * @return
+   */
+  std::vector<Result> execute();
+
+  /**
+   * @brief Replaces parameter values of the pipeline JSON with the values of the overrides.
+   * @param pipelineObj
+   * @param overrides Maps filter indices to objects of parameter values
+   * @param errorMessage Set if an override refers to a filter the pipeline does not have
+   * @return
+   */
+  static bool ApplyOverrides(QJsonObject& pipelineObj, const QJsonObject& overrides, QString& errorMessage);
+
+  /**
+   * @brief Writes the per job status and timing summary as a JSON file.
+   * @param filePath
+   * @param results
+   * @param elapsedSeconds Wall time of the whole batch
+   * @return
+   */
+  static bool WriteSummary(const QString& filePath, const std::vector<Result>& results, double elapsedSeconds);
+
+public:
+  BatchRunner(const BatchRunner&) = delete;            // Copy Constructor Not Implemented
+  BatchRunner(BatchRunner&&) = delete;                 // Move Constructor Not Implemented
+  BatchRunner& operator=(const BatchRunner&) = delete; // Copy Assignment Not Implemented
+  BatchRunner& operator=(BatchRunner&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  size_t m_Concurrency = 1;
+  int64_t m_MemoryBudget = 0;
+
+  std::vector<Job> m_Jobs;
+  QHash<QString, QJsonObject> m_Pipelines; // Parsed pipeline files, read only while executing
+
+  std::mutex m_MemoryMutex;
+  std::condition_variable m_MemoryReleased;
+  int64_t m_MemoryInUse = 0;
+
+  std::mutex m_FactoryMutex;
+
+  Result runJob(const Job& job);
+  int64_t reserveMemory(int64_t bytes);
+  void releaseMemory(int64_t bytes);
+};
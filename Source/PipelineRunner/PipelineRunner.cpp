@@ -38,8 +38,11 @@
 #include <cstdlib>
 
 // C++ Includes
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 // Qt Includes
 #include <QtCore/QCommandLineOption>
@@ -71,6 +74,8 @@
 #include "SIMPLib/Python/PythonLoader.h"
 #endif
 
+#include "BatchRunner.h"
+
 QFile s_LogFile;
 QTextStream s_LogStream(&s_LogFile);
 
@@ -159,11 +164,32 @@ int main(int argc, char* argv[])
                                                  << "logfile",
                                    "Save output to file", "log");
   parser.addOption(logFileOption);
+
+  QCommandLineOption batchFileOption(QStringList() << "b"
+                                                   << "batch",
+                                     "Batch manifest as a JSON file. Runs every job of the manifest instead of a single pipeline.", "manifest");
+  parser.addOption(batchFileOption);
+
+  QCommandLineOption jobsOption(QStringList() << "j"
+                                              << "jobs",
+                                "Number of batch jobs executing at the same time. Defaults to the number of cores, 1 if HDF5 is not thread safe.", "count");
+  parser.addOption(jobsOption);
+
+  QCommandLineOption memoryOption(QStringList() << "m"
+                                                << "memory",
+                                  "Memory budget in MiB that the estimated memory of concurrent batch jobs may add up to.", "MiB");
+  parser.addOption(memoryOption);
+
+  QCommandLineOption summaryOption(QStringList() << "s"
+                                                 << "summary",
+                                   "Batch summary JSON file. Defaults to the manifest file name with a '_Summary.json' suffix.", "file");
+  parser.addOption(summaryOption);
   // Process the actual command line arguments given by the user
   parser.process(app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
   QString logFile = parser.value(logFileOption);
+  QString batchFile = parser.value(batchFileOption);
 
   if(!logFile.isEmpty())
   {
@@ -196,7 +222,14 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "PipelineRunner " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
-  std::cout << "Input File: " << pipelineFile.toStdString() << std::endl;
+  if(batchFile.isEmpty())
+  {
+    std::cout << "Input File: " << pipelineFile.toStdString() << std::endl;
+  }
+  else
+  {
+    std::cout << "Batch Manifest: " << batchFile.toStdString() << std::endl;
+  }
   if(!logFile.isEmpty())
   {
     std::cout << "Log File: " << logFile.toStdString() << std::endl;
@@ -226,6 +259,46 @@ int main(int argc, char* argv[])
 
   QMetaObjectUtilities::RegisterMetaTypes();
 
+  if(!batchFile.isEmpty())
+  {
+    size_t concurrency = std::max(1u, std::thread::hardware_concurrency());
+    if(parser.isSet(jobsOption))
+    {
+      concurrency = static_cast<size_t>(std::max(1, parser.value(jobsOption).toInt()));
+    }
+    int64_t memoryBudget = parser.value(memoryOption).toLongLong() * 1024 * 1024;
+
+    BatchRunner batchRunner(concurrency, memoryBudget);
+    QString errorMessage;
+    if(!batchRunner.readManifest(batchFile, errorMessage))
+    {
+      std::cout << errorMessage.toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Job Count: " << batchRunner.getJobCount() << "  Concurrency: " << batchRunner.getConcurrency() << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<BatchRunner::Result> results = batchRunner.execute();
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    QString summaryFile = parser.value(summaryOption);
+    if(summaryFile.isEmpty())
+    {
+      QFileInfo batchInfo(batchFile);
+      summaryFile = batchInfo.absolutePath() + "/" + batchInfo.completeBaseName() + "_Summary.json";
+    }
+    if(!BatchRunner::WriteSummary(summaryFile, results, elapsedSeconds))
+    {
+      std::cout << "The batch summary could not be written to '" << summaryFile.toStdString() << "'" << std::endl;
+    }
+
+    size_t failed = std::count_if(results.begin(), results.end(), [](const BatchRunner::Result& result) { return result.status != "Completed"; });
+    std::cout << "Batch finished in " << elapsedSeconds << "s. Completed: " << (results.size() - failed) << "  Failed: " << failed << std::endl;
+
+    std::cout.rdbuf(stdCoutBuf);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
   // Sanity Check the filepath to make sure it exists, Report an error and bail if it does not
   QFileInfo fi(pipelineFile);
   if(!fi.exists())
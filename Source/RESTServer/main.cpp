@@ -62,7 +62,9 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineResultCache.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
+#include "SIMPLib/REST/SessionDataStore.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 
 // -----------------------------------------------------------------------------
@@ -140,9 +142,12 @@ int main(int argc, char* argv[])
   ServerSettings serverSettings(config);
 
   HttpSessionStore* sessionStore = HttpSessionStore::CreateInstance(&serverSettings, &app);
-  sessionStore = nullptr; // This is here to quiet the compiler about unused variable.
+  // Configure the data kept resident for each session
+  SessionDataStore::CreateInstance(&serverSettings, sessionStore);
   // Configure static file controller
   SIMPLStaticFileController::CreateInstance(&serverSettings, &app);
+  // Configure the pipeline result cache
+  PipelineResultCache::CreateInstance(&serverSettings);
 
   // Configure and start the TCP listener
   QSharedPointer<HttpListener> httpListener = QSharedPointer<HttpListener>(new HttpListener(&serverSettings, new SIMPLRequestMapper(&app), &app));
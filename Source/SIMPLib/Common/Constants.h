@@ -107,6 +107,7 @@ inline const QString String("string");
 inline const QString StatsDataArray("StatsDataArray");
 inline const QString NeighborList("NeighborList<T>");
 inline const QString StringArray("StringDataArray");
+inline const QString BitMaskArray("BitMaskArray");
 inline const QString Unknown("Unknown");
 inline const QString SupportedTypeList(TypeNames::Bool + ", " + TypeNames::StringArray + ", " + TypeNames::Int8 + ", " + TypeNames::UInt8 + ", " + TypeNames::Int16 + ", " + TypeNames::UInt16 + ", " +
                                        TypeNames::Int32 + ", " + TypeNames::UInt32 + ", " + TypeNames::Int64 + ", " + TypeNames::UInt64 + ", " + TypeNames::Float + ", " + TypeNames::Double + ", " +
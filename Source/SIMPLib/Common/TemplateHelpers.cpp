@@ -322,7 +322,7 @@ IDataArrayWkPtr GetPrereqArrayFromPath::operator()(AbstractFilter* f, const Data
     compDims = templ_ptr->getComponentDimensions();
   }
 
-  IDataArrayShPtr i_data_array = cell_attr_matrix->getAttributeArray(arrayPath.getDataArrayName());
+  IDataArrayShPtr i_data_array = cell_attr_matrix->getOwnedAttributeArray(arrayPath.getDataArrayName());
   if(CanDynamicCast<Int8ArrayType>()(i_data_array))
   {
     retPtr = f->getDataContainerArray()->template getPrereqArrayFromPath<DataArray<int8_t>>(f, arrayPath, compDims);
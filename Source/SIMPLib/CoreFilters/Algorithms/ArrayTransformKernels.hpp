@@ -0,0 +1,277 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Typed element-wise kernels shared by the array conversion and replacement filters.
+ *
+ * Each kernel is dispatched once per type by the caller and then runs over raw pointers with
+ * ParallelDataAlgorithm, so the inner loops are branch-light and can be vectorized.
+ */
+namespace ArrayTransformKernels
+{
+/**
+ * @brief Converts a single value using the compiler's conversion rules, except where those rules
+ * are undefined: NaN becomes 0 and out of range floating point values clamp to the limits of an
+ * integer destination type.
+ */
+template <typename InT, typename OutT>
+inline OutT ConvertValue(InT value)
+{
+  if constexpr(std::is_same<InT, OutT>::value)
+  {
+    return value;
+  }
+  else if constexpr(std::is_same<OutT, bool>::value)
+  {
+    return value != static_cast<InT>(0);
+  }
+  else if constexpr(std::is_same<InT, bool>::value)
+  {
+    return static_cast<OutT>(value ? 1 : 0);
+  }
+  else if constexpr(std::is_floating_point<InT>::value && std::is_integral<OutT>::value)
+  {
+    if(std::isnan(value))
+    {
+      return static_cast<OutT>(0);
+    }
+    if(value <= static_cast<InT>(std::numeric_limits<OutT>::lowest()))
+    {
+      return std::numeric_limits<OutT>::lowest();
+    }
+    if(value >= static_cast<InT>(std::numeric_limits<OutT>::max()))
+    {
+      return std::numeric_limits<OutT>::max();
+    }
+    return static_cast<OutT>(value);
+  }
+  else
+  {
+    return static_cast<OutT>(value);
+  }
+}
+
+/**
+ * @brief Converts a range of elements from one primitive type to another
+ */
+template <typename InT, typename OutT>
+class ConvertImpl
+{
+public:
+  ConvertImpl(const InT* source, OutT* destination)
+  : m_Source(source)
+  , m_Destination(destination)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const InT* source = m_Source;
+    OutT* destination = m_Destination;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      destination[i] = ConvertValue<InT, OutT>(source[i]);
+    }
+  }
+
+private:
+  const InT* m_Source = nullptr;
+  OutT* m_Destination = nullptr;
+};
+
+/**
+ * @brief Replaces every element equal to removeValue with replaceValue
+ */
+template <typename T>
+class ReplaceImpl
+{
+public:
+  ReplaceImpl(T* data, T removeValue, T replaceValue)
+  : m_Data(data)
+  , m_RemoveValue(removeValue)
+  , m_ReplaceValue(replaceValue)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    T* data = m_Data;
+    const T removeValue = m_RemoveValue;
+    const T replaceValue = m_ReplaceValue;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      data[i] = (data[i] == removeValue) ? replaceValue : data[i];
+    }
+  }
+
+private:
+  T* m_Data = nullptr;
+  T m_RemoveValue;
+  T m_ReplaceValue;
+};
+
+/**
+ * @brief Sets every component of the tuples selected by a byte-per-value mask to a value
+ */
+template <typename T>
+class MaskedFillImpl
+{
+public:
+  MaskedFillImpl(T* data, size_t numComps, const bool* mask, T value)
+  : m_Data(data)
+  , m_NumComps(numComps)
+  , m_Mask(mask)
+  , m_Value(value)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    if(m_NumComps == 1)
+    {
+      T* data = m_Data;
+      const bool* mask = m_Mask;
+      const T value = m_Value;
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        data[i] = mask[i] ? value : data[i];
+      }
+      return;
+    }
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(m_Mask[i])
+      {
+        std::fill_n(m_Data + i * m_NumComps, m_NumComps, m_Value);
+      }
+    }
+  }
+
+private:
+  T* m_Data = nullptr;
+  size_t m_NumComps = 1;
+  const bool* m_Mask = nullptr;
+  T m_Value;
+};
+
+/**
+ * @brief Sets every component of the tuples selected by a packed mask to a value. The range
+ * is over the words of the mask so empty words are skipped outright.
+ */
+template <typename T>
+class BitMaskFillImpl
+{
+public:
+  BitMaskFillImpl(T* data, size_t numComps, const BitMaskArray::word_type* words, T value)
+  : m_Data(data)
+  , m_NumComps(numComps)
+  , m_Words(words)
+  , m_Value(value)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t w = range.min(); w < range.max(); w++)
+    {
+      BitMaskArray::word_type word = m_Words[w];
+      const size_t base = w * BitMaskArray::k_BitsPerWord;
+      while(word != 0)
+      {
+        const size_t tuple = base + BitMaskArray::CountTrailingZeros(word);
+        std::fill_n(m_Data + tuple * m_NumComps, m_NumComps, m_Value);
+        word &= word - 1;
+      }
+    }
+  }
+
+private:
+  T* m_Data = nullptr;
+  size_t m_NumComps = 1;
+  const BitMaskArray::word_type* m_Words = nullptr;
+  T m_Value;
+};
+
+/**
+ * @brief Converts count elements of source into destination in parallel
+ */
+template <typename InT, typename OutT>
+void Convert(const InT* source, OutT* destination, size_t count)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, count);
+  dataAlg.execute(ConvertImpl<InT, OutT>(source, destination));
+}
+
+/**
+ * @brief Replaces, in parallel, every one of the count elements equal to removeValue with replaceValue
+ */
+template <typename T>
+void Replace(T* data, size_t count, T removeValue, T replaceValue)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, count);
+  dataAlg.execute(ReplaceImpl<T>(data, removeValue, replaceValue));
+}
+
+/**
+ * @brief Sets, in parallel, all components of each tuple whose mask value is true
+ */
+template <typename T>
+void MaskedFill(T* data, size_t numTuples, size_t numComps, const bool* mask, T value)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(MaskedFillImpl<T>(data, numComps, mask, value));
+}
+
+/**
+ * @brief Sets, in parallel, all components of each tuple that is set in the packed mask
+ */
+template <typename T>
+void MaskedFill(T* data, size_t numComps, const BitMaskArray& mask, T value)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, mask.getNumberOfWords());
+  dataAlg.execute(BitMaskFillImpl<T>(data, numComps, mask.getWordPointer(0), value));
+}
+} // namespace ArrayTransformKernels
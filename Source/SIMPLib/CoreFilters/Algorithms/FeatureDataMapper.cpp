@@ -0,0 +1,535 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FeatureDataMapper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Elements per block. The largest id and the consistency scans write one partial result per
+// block into a scratch array that is then reduced serially, so the size keeps those arrays small
+// for large volumes while leaving enough blocks to balance the load.
+constexpr size_t k_BlockSize = 16384;
+
+/**
+ * @brief A source/destination pair of raw tuple buffers
+ */
+struct TuplePair
+{
+  const uint8_t* source = nullptr;
+  uint8_t* destination = nullptr;
+  size_t tupleBytes = 0;
+  size_t numSourceTuples = 0;
+};
+
+template <typename... T>
+bool IsAnyDataArrayOf(const IDataArray& array)
+{
+  return ((dynamic_cast<const DataArray<T>*>(&array) != nullptr) || ...);
+}
+
+inline void AtomicMin(std::atomic<int64_t>& target, int64_t value)
+{
+  int64_t current = target.load(std::memory_order_relaxed);
+  while(value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+inline void AtomicMax(std::atomic<int64_t>& target, int64_t value)
+{
+  int64_t current = target.load(std::memory_order_relaxed);
+  while(value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+/**
+ * @brief Copies feature tuples to elements. TupleBytes is the tuple size when it is known at
+ * compile time (so the copy becomes a single load/store) or 0 for the general case.
+ */
+template <size_t TupleBytes>
+void ScatterTuples(const int32_t* featureIds, const TuplePair& pair, size_t start, size_t end)
+{
+  const size_t tupleBytes = (TupleBytes == 0) ? pair.tupleBytes : TupleBytes;
+  const size_t numFeatures = pair.numSourceTuples;
+  for(size_t i = start; i < end; i++)
+  {
+    const int32_t featureId = featureIds[i];
+    if(featureId < 0 || static_cast<size_t>(featureId) >= numFeatures)
+    {
+      continue;
+    }
+    ::memcpy(pair.destination + i * tupleBytes, pair.source + static_cast<size_t>(featureId) * tupleBytes, tupleBytes);
+  }
+}
+
+void ScatterTuples(const int32_t* featureIds, const TuplePair& pair, size_t start, size_t end)
+{
+  switch(pair.tupleBytes)
+  {
+  case 1:
+    ScatterTuples<1>(featureIds, pair, start, end);
+    break;
+  case 2:
+    ScatterTuples<2>(featureIds, pair, start, end);
+    break;
+  case 4:
+    ScatterTuples<4>(featureIds, pair, start, end);
+    break;
+  case 8:
+    ScatterTuples<8>(featureIds, pair, start, end);
+    break;
+  case 12:
+    ScatterTuples<12>(featureIds, pair, start, end);
+    break;
+  case 16:
+    ScatterTuples<16>(featureIds, pair, start, end);
+    break;
+  case 24:
+    ScatterTuples<24>(featureIds, pair, start, end);
+    break;
+  default:
+    ScatterTuples<0>(featureIds, pair, start, end);
+    break;
+  }
+}
+
+/**
+ * @brief Finds the largest Feature Id of each block
+ */
+class MaxFeatureIdImpl
+{
+public:
+  MaxFeatureIdImpl(const int32_t* featureIds, size_t numElements, int32_t* blockMax)
+  : m_FeatureIds(featureIds)
+  , m_NumElements(numElements)
+  , m_BlockMax(blockMax)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumElements);
+      int32_t maxId = -1;
+      for(size_t i = start; i < end; i++)
+      {
+        maxId = std::max(maxId, m_FeatureIds[i]);
+      }
+      m_BlockMax[block] = maxId;
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumElements = 0;
+  int32_t* m_BlockMax = nullptr;
+};
+
+/**
+ * @brief Records the first and last element of every Feature. Runs of equal ids are collapsed
+ * before touching the shared atomics since FeatureIds are usually spatially coherent.
+ */
+class ElementRangesImpl
+{
+public:
+  ElementRangesImpl(const int32_t* featureIds, size_t numElements, size_t numFeatures, std::atomic<int64_t>* firstElement, std::atomic<int64_t>* lastElement)
+  : m_FeatureIds(featureIds)
+  , m_NumElements(numElements)
+  , m_NumFeatures(numFeatures)
+  , m_FirstElement(firstElement)
+  , m_LastElement(lastElement)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumElements);
+      size_t runStart = start;
+      while(runStart < end)
+      {
+        const int32_t featureId = m_FeatureIds[runStart];
+        size_t runEnd = runStart + 1;
+        while(runEnd < end && m_FeatureIds[runEnd] == featureId)
+        {
+          runEnd++;
+        }
+        if(featureId >= 0 && static_cast<size_t>(featureId) < m_NumFeatures)
+        {
+          AtomicMin(m_FirstElement[featureId], static_cast<int64_t>(runStart));
+          AtomicMax(m_LastElement[featureId], static_cast<int64_t>(runEnd - 1));
+        }
+        runStart = runEnd;
+      }
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumElements = 0;
+  size_t m_NumFeatures = 0;
+  std::atomic<int64_t>* m_FirstElement = nullptr;
+  std::atomic<int64_t>* m_LastElement = nullptr;
+};
+
+/**
+ * @brief Copies Feature tuples to every element of each array pair
+ */
+class ScatterImpl
+{
+public:
+  ScatterImpl(const int32_t* featureIds, size_t numElements, const std::vector<TuplePair>& pairs)
+  : m_FeatureIds(featureIds)
+  , m_NumElements(numElements)
+  , m_Pairs(pairs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumElements);
+      // The ids of this block stay in cache while each array is copied
+      for(const auto& pair : m_Pairs)
+      {
+        ScatterTuples(m_FeatureIds, pair, start, end);
+      }
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumElements = 0;
+  const std::vector<TuplePair>& m_Pairs;
+};
+
+/**
+ * @brief Copies the tuple of the last element of each Feature into the Feature arrays
+ */
+class GatherImpl
+{
+public:
+  GatherImpl(const int64_t* lastElement, const std::vector<TuplePair>& pairs)
+  : m_LastElement(lastElement)
+  , m_Pairs(pairs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      const int64_t element = m_LastElement[featureId];
+      if(element < 0)
+      {
+        continue;
+      }
+      for(const auto& pair : m_Pairs)
+      {
+        ::memcpy(pair.destination + featureId * pair.tupleBytes, pair.source + static_cast<size_t>(element) * pair.tupleBytes, pair.tupleBytes);
+      }
+    }
+  }
+
+private:
+  const int64_t* m_LastElement = nullptr;
+  const std::vector<TuplePair>& m_Pairs;
+};
+
+/**
+ * @brief Finds the lowest element of each block whose tuple differs from the first tuple of its Feature
+ */
+class ConsistencyImpl
+{
+public:
+  ConsistencyImpl(const int32_t* featureIds, size_t numElements, size_t numFeatures, const int64_t* firstElement, const std::vector<TuplePair>& pairs, int64_t* blockMismatch)
+  : m_FeatureIds(featureIds)
+  , m_NumElements(numElements)
+  , m_NumFeatures(numFeatures)
+  , m_FirstElement(firstElement)
+  , m_Pairs(pairs)
+  , m_BlockMismatch(blockMismatch)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumElements);
+      m_BlockMismatch[block] = findMismatch(start, end);
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumElements = 0;
+  size_t m_NumFeatures = 0;
+  const int64_t* m_FirstElement = nullptr;
+  const std::vector<TuplePair>& m_Pairs;
+  int64_t* m_BlockMismatch = nullptr;
+
+  int64_t findMismatch(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const int32_t featureId = m_FeatureIds[i];
+      if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+      {
+        continue;
+      }
+      const size_t first = static_cast<size_t>(m_FirstElement[featureId]);
+      if(first == i)
+      {
+        continue;
+      }
+      for(const auto& pair : m_Pairs)
+      {
+        if(::memcmp(pair.source + i * pair.tupleBytes, pair.source + first * pair.tupleBytes, pair.tupleBytes) != 0)
+        {
+          return static_cast<int64_t>(i);
+        }
+      }
+    }
+    return -1;
+  }
+};
+
+/**
+ * @brief Builds the raw tuple pairs, returning false if any pair does not match in type or shape
+ */
+bool BuildTuplePairs(const std::vector<IDataArrayShPtrType>& sources, const std::vector<IDataArrayShPtrType>& destinations, std::vector<TuplePair>& pairs)
+{
+  if(sources.size() != destinations.size())
+  {
+    return false;
+  }
+  pairs.clear();
+  pairs.reserve(sources.size());
+  for(size_t i = 0; i < sources.size(); i++)
+  {
+    const IDataArrayShPtrType& source = sources[i];
+    const IDataArrayShPtrType& destination = destinations[i];
+    if(nullptr == source || nullptr == destination || !FeatureDataMapper::IsSupported(*source) || source->getTypeAsString() != destination->getTypeAsString() ||
+       source->getNumberOfComponents() != destination->getNumberOfComponents())
+    {
+      return false;
+    }
+    TuplePair pair;
+    pair.tupleBytes = source->getTypeSize() * static_cast<size_t>(source->getNumberOfComponents());
+    pair.numSourceTuples = source->getNumberOfTuples();
+    if(pair.numSourceTuples > 0)
+    {
+      pair.source = static_cast<const uint8_t*>(source->getVoidPointer(0));
+    }
+    if(destination->getNumberOfTuples() > 0)
+    {
+      pair.destination = static_cast<uint8_t*>(destination->getVoidPointer(0));
+    }
+    pairs.push_back(pair);
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureDataMapper::FeatureDataMapper(const int32_t* featureIds, size_t numElements)
+: m_FeatureIds(featureIds)
+, m_NumElements(numElements)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureDataMapper::~FeatureDataMapper() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FeatureDataMapper::IsSupported(const IDataArray& array)
+{
+  return IsAnyDataArrayOf<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, bool>(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FeatureDataMapper::numBlocks() const
+{
+  return (m_NumElements + k_BlockSize - 1) / k_BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t FeatureDataMapper::findMaxFeatureId() const
+{
+  const size_t blockCount = numBlocks();
+  if(blockCount == 0)
+  {
+    return -1;
+  }
+  std::vector<int32_t> blockMax(blockCount, -1);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, blockCount);
+  dataAlg.execute(MaxFeatureIdImpl(m_FeatureIds, m_NumElements, blockMax.data()));
+
+  return *std::max_element(blockMax.begin(), blockMax.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureDataMapper::findElementRanges(size_t numFeatures, std::vector<int64_t>& firstElement, std::vector<int64_t>& lastElement) const
+{
+  std::vector<std::atomic<int64_t>> first(numFeatures);
+  std::vector<std::atomic<int64_t>> last(numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    first[i].store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    last[i].store(-1, std::memory_order_relaxed);
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks());
+  dataAlg.execute(ElementRangesImpl(m_FeatureIds, m_NumElements, numFeatures, first.data(), last.data()));
+
+  firstElement.resize(numFeatures);
+  lastElement.resize(numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    lastElement[i] = last[i].load(std::memory_order_relaxed);
+    firstElement[i] = (lastElement[i] < 0) ? -1 : first[i].load(std::memory_order_relaxed);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FeatureDataMapper::copyFeatureToElement(const std::vector<IDataArrayShPtrType>& featureArrays, const std::vector<IDataArrayShPtrType>& elementArrays) const
+{
+  std::vector<TuplePair> pairs;
+  if(!BuildTuplePairs(featureArrays, elementArrays, pairs))
+  {
+    return false;
+  }
+  for(const auto& elementArray : elementArrays)
+  {
+    if(elementArray->getNumberOfTuples() != m_NumElements)
+    {
+      return false;
+    }
+  }
+  if(pairs.empty() || m_NumElements == 0)
+  {
+    return true;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks());
+  dataAlg.execute(ScatterImpl(m_FeatureIds, m_NumElements, pairs));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t FeatureDataMapper::copyElementToFeature(const std::vector<IDataArrayShPtrType>& elementArrays, const std::vector<IDataArrayShPtrType>& featureArrays, bool checkConsistency) const
+{
+  std::vector<TuplePair> pairs;
+  if(!BuildTuplePairs(elementArrays, featureArrays, pairs))
+  {
+    return -2;
+  }
+  if(pairs.empty())
+  {
+    return -1;
+  }
+  const size_t numFeatures = featureArrays.front()->getNumberOfTuples();
+  for(size_t i = 0; i < featureArrays.size(); i++)
+  {
+    if(elementArrays[i]->getNumberOfTuples() != m_NumElements || featureArrays[i]->getNumberOfTuples() != numFeatures)
+    {
+      return -2;
+    }
+  }
+  if(m_NumElements == 0 || numFeatures == 0)
+  {
+    return -1;
+  }
+
+  std::vector<int64_t> firstElement;
+  std::vector<int64_t> lastElement;
+  findElementRanges(numFeatures, firstElement, lastElement);
+
+  ParallelDataAlgorithm gatherAlg;
+  gatherAlg.setRange(0, numFeatures);
+  gatherAlg.execute(GatherImpl(lastElement.data(), pairs));
+
+  if(!checkConsistency)
+  {
+    return -1;
+  }
+
+  std::vector<int64_t> blockMismatch(numBlocks(), -1);
+  ParallelDataAlgorithm checkAlg;
+  checkAlg.setRange(0, blockMismatch.size());
+  checkAlg.execute(ConsistencyImpl(m_FeatureIds, m_NumElements, numFeatures, firstElement.data(), pairs, blockMismatch.data()));
+
+  // Blocks are in element order, so the first block with a mismatch holds the lowest index
+  for(const auto& mismatch : blockMismatch)
+  {
+    if(mismatch >= 0)
+    {
+      return mismatch;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+class IDataArray;
+using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+
+/**
+ * @brief The FeatureDataMapper class moves tuples between Feature level arrays and Element level
+ * arrays using a FeatureIds array as the index. Every pass is parallel over fixed size blocks of
+ * elements (or over features) and any number of arrays may be moved in a single sweep of the
+ * FeatureIds, so the ids are only streamed through the cache once.
+ *
+ * All results are independent of the number of threads: the element -> feature direction always
+ * takes the tuple from the last element of each feature, which matches the serial behavior.
+ */
+class FeatureDataMapper
+{
+public:
+  FeatureDataMapper(const int32_t* featureIds, size_t numElements);
+
+  virtual ~FeatureDataMapper();
+
+  /**
+   * @brief Returns true if the array is a primitive DataArray that the mapper can copy.
+   * @param array
+   * @return
+   */
+  static bool IsSupported(const IDataArray& array);
+
+  /**
+   * @brief Returns the largest Feature Id, or -1 if there are no elements.
+   * @return
+   */
+  int32_t findMaxFeatureId() const;
+
+  /**
+   * @brief Finds the first and last element index of each Feature. Features without any elements
+   * get -1 for both. Ids that are negative or not less than numFeatures are ignored.
+   * @param numFeatures
+   * @param firstElement
+   * @param lastElement
+   */
+  void findElementRanges(size_t numFeatures, std::vector<int64_t>& firstElement, std::vector<int64_t>& lastElement) const;
+
+  /**
+   * @brief Scatters each Feature array into the Element array at the same position. The Element
+   * arrays must have one tuple per element and the same type and component count as their Feature
+   * array. Elements whose id is out of range are left untouched.
+   * @param featureArrays
+   * @param elementArrays
+   * @return false if the arrays do not match
+   */
+  bool copyFeatureToElement(const std::vector<IDataArrayShPtrType>& featureArrays, const std::vector<IDataArrayShPtrType>& elementArrays) const;
+
+  /**
+   * @brief Gathers each Element array into the Feature array at the same position. Each Feature
+   * receives the tuple of its last element; Features without elements are left untouched.
+   * @param elementArrays
+   * @param featureArrays
+   * @param checkConsistency If true, every element is compared bitwise against the first element
+   * of its Feature.
+   * @return The lowest element index whose tuple differs from the first tuple of its Feature, or
+   * -1 if all Features are consistent (or the check was not requested). -2 if the arrays do not match.
+   */
+  int64_t copyElementToFeature(const std::vector<IDataArrayShPtrType>& elementArrays, const std::vector<IDataArrayShPtrType>& featureArrays, bool checkConsistency) const;
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumElements = 0;
+
+  /**
+   * @brief Returns the number of fixed size blocks the elements are split into
+   * @return
+   */
+  size_t numBlocks() const;
+
+public:
+  FeatureDataMapper(const FeatureDataMapper&) = delete;            // Copy Constructor Not Implemented
+  FeatureDataMapper(FeatureDataMapper&&) = delete;                 // Move Constructor Not Implemented
+  FeatureDataMapper& operator=(const FeatureDataMapper&) = delete; // Copy Assignment Not Implemented
+  FeatureDataMapper& operator=(FeatureDataMapper&&) = delete;      // Move Assignment Not Implemented
+};
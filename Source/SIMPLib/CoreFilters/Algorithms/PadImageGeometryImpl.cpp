@@ -32,57 +32,15 @@
 
 #include "SIMPLib/CoreFilters/PadImageGeometry.h"
 
-namespace Detail
-{
-template <typename T>
-void fillDataArray(const AttributeMatrix& srcAttrMatrix, AttributeMatrix& destAttrMatrix, const QString& dataArrayName, int defaultFillValue, int xMinPadding, int yMinPadding, int zMinPadding)
-{
-  typename DataArray<T>::Pointer srcArray = srcAttrMatrix.getAttributeArrayAs<DataArray<T>>(dataArrayName);
-  typename DataArray<T>::Pointer destArray = destAttrMatrix.getAttributeArrayAs<DataArray<T>>(dataArrayName);
-
-  // Initialize the array with the default value to start
-  if constexpr(std::is_same<T, bool>::value)
-  {
-    destArray->initializeWithValue(defaultFillValue != 0);
-  }
-  else
-  {
-    destArray->initializeWithValue(static_cast<T>(defaultFillValue));
-  }
-
-  // Copy contents from srcArray to destArray
-  SizeVec3Type srcDims = srcAttrMatrix.getTupleDimensions();
-  SizeVec3Type destDims = destAttrMatrix.getTupleDimensions();
-  size_t compCount = srcArray->getNumberOfComponents();
-  T* srcArrayPtr = srcArray->getPointer(0);
-  T* destArrayPtr = destArray->getPointer(0);
-  for(size_t z = 0; z < srcDims[2]; z++)
-  {
-    for(size_t y = 0; y < srcDims[1]; y++)
-    {
-      for(size_t x = 0; x < srcDims[0]; x++)
-      {
-        size_t srcIndex = (z * srcDims[1] * srcDims[0]) + (y * srcDims[0]) + x;
-        size_t destIndex = ((z + zMinPadding) * destDims[1] * destDims[0]) + ((y + yMinPadding) * destDims[0]) + (x + xMinPadding);
-        for(size_t c = 0; c < compCount; c++)
-        {
-          destArrayPtr[destIndex * compCount + c] = srcArrayPtr[srcIndex * compCount + c];
-        }
-      }
-    }
-  }
-}
-} // namespace Detail
-
 // -----------------------------------------------------------------------------
 PadImageGeometryImpl::PadImageGeometryImpl(PadImageGeometry* filter, AttributeMatrix& srcAttrMatrix, AttributeMatrix& destAttrMatrix, const QString& dataArrayName, int defaultFillValue,
-                                           const IntVec3Type& minPadding)
+                                           const ImageBoxCopy::Box& box)
 : m_Filter(filter)
 , m_SrcAttrMatrix(srcAttrMatrix)
 , m_DestAttrMatrix(destAttrMatrix)
 , m_ArrayName(dataArrayName)
 , m_DefaultFillValue(defaultFillValue)
-, m_MinPadding(minPadding)
+, m_Box(box)
 {
 }
 
@@ -92,54 +50,9 @@ PadImageGeometryImpl::~PadImageGeometryImpl() = default;
 // -----------------------------------------------------------------------------
 void PadImageGeometryImpl::operator()() const
 {
-  IDataArray::Pointer srcArray = m_SrcAttrMatrix.getAttributeArray(m_ArrayName);
-
-  QString arrayType = srcArray->getTypeAsString();
-  if(arrayType == "int8_t")
-  {
-    Detail::fillDataArray<int8_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "int16_t")
-  {
-    Detail::fillDataArray<int16_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "int32_t")
-  {
-    Detail::fillDataArray<int32_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "int64_t")
-  {
-    Detail::fillDataArray<int64_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "uint8_t")
-  {
-    Detail::fillDataArray<uint8_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "uint16_t")
-  {
-    Detail::fillDataArray<uint16_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "uint32_t")
-  {
-    Detail::fillDataArray<uint32_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "uint64_t")
-  {
-    Detail::fillDataArray<uint64_t>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "float")
-  {
-    Detail::fillDataArray<float>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "double")
-  {
-    Detail::fillDataArray<double>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else if(arrayType == "bool")
-  {
-    Detail::fillDataArray<bool>(m_SrcAttrMatrix, m_DestAttrMatrix, m_ArrayName, m_DefaultFillValue, m_MinPadding[0], m_MinPadding[1], m_MinPadding[2]);
-  }
-  else
+  IDataArray::Pointer srcArray = m_SrcAttrMatrix.getOwnedAttributeArray(m_ArrayName);
+  IDataArray::Pointer destArray = m_DestAttrMatrix.getOwnedAttributeArray(m_ArrayName);
+  if(!ImageBoxCopy::CopyBox(*srcArray, *destArray, m_Box, m_DefaultFillValue))
   {
     QString ss = QObject::tr("Array '%1', contained in attribute matrix '%2', has an unidentified array type.").arg(srcArray->getName(), m_SrcAttrMatrix.getName());
     m_Filter->setErrorCondition(-3010, ss);
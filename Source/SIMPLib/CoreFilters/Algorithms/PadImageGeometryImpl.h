@@ -32,17 +32,18 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
-#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/Geometry/ImageBoxCopy.hpp"
 
 class PadImageGeometry;
 
 /**
- * @brief The PadImageGeometryImpl class.
+ * @brief The PadImageGeometryImpl class copies one array of the source attribute matrix into the resized
+ * destination attribute matrix with ImageBoxCopy and then removes the source array.
  */
 class PadImageGeometryImpl
 {
 public:
-  PadImageGeometryImpl(PadImageGeometry* filter, AttributeMatrix& srcAttrMatrix, AttributeMatrix& destAttrMatrix, const QString& dataArrayName, int defaultFillValue, const IntVec3Type& minPadding);
+  PadImageGeometryImpl(PadImageGeometry* filter, AttributeMatrix& srcAttrMatrix, AttributeMatrix& destAttrMatrix, const QString& dataArrayName, int defaultFillValue, const ImageBoxCopy::Box& box);
 
   virtual ~PadImageGeometryImpl();
 
@@ -57,5 +58,5 @@ private:
   AttributeMatrix& m_DestAttrMatrix;
   QString m_ArrayName;
   int m_DefaultFillValue;
-  IntVec3Type m_MinPadding;
+  ImageBoxCopy::Box m_Box;
 };
@@ -3,13 +3,18 @@ set(${PLUGIN_NAME}_Algorithms_HDRS "")
 set(${PLUGIN_NAME}_Algorithms_SRCS "")
 
 set(${PLUGIN_NAME}_Algorithms_HDRS ${${PLUGIN_NAME}_Algorithms_HDRS}
+    ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/ArrayTransformKernels.hpp
+    ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/FeatureDataMapper.h
     ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/InitializeDataImpl.h
     ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/PadImageGeometryImpl.h
+    ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/TupleCompactor.h
 )
 
 set(${PLUGIN_NAME}_Algorithms_SRCS ${${PLUGIN_NAME}_Algorithms_SRCS}
+    ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/FeatureDataMapper.cpp
     ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/InitializeDataImpl.cpp
     ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/PadImageGeometryImpl.cpp
+    ${${PLUGIN_NAME}_SOURCE_DIR}/Algorithms/TupleCompactor.cpp
 )
 
 
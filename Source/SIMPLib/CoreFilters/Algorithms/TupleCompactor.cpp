@@ -0,0 +1,347 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TupleCompactor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "SIMPLib/CoreFilters/Algorithms/FeatureDataMapper.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Tuples per block. The constructor counts the selection per block and the gather passes
+// re-evaluate the predicate over the very same blocks, so the size is a constant; the 16 KB
+// selection buffer each work item allocates stays in the L1 cache.
+constexpr size_t k_BlockSize = 16384;
+
+/**
+ * @brief A source/destination pair of raw tuple buffers
+ */
+struct TuplePair
+{
+  const uint8_t* source = nullptr;
+  uint8_t* destination = nullptr;
+  size_t tupleBytes = 0;
+};
+
+/**
+ * @brief Packs the selected tuples of one block. TupleBytes is the tuple size when it is known at
+ * compile time (so the copy becomes a single load/store) or 0 for the general case.
+ */
+template <size_t TupleBytes>
+void CopySelected(const uint8_t* selected, const TuplePair& pair, size_t start, size_t end, size_t destination)
+{
+  const size_t tupleBytes = (TupleBytes == 0) ? pair.tupleBytes : TupleBytes;
+  uint8_t* out = pair.destination + destination * tupleBytes;
+  for(size_t i = start; i < end; i++)
+  {
+    if(selected[i - start] != 0)
+    {
+      ::memcpy(out, pair.source + i * tupleBytes, tupleBytes);
+      out += tupleBytes;
+    }
+  }
+}
+
+void CopySelected(const uint8_t* selected, const TuplePair& pair, size_t start, size_t end, size_t destination)
+{
+  switch(pair.tupleBytes)
+  {
+  case 1:
+    CopySelected<1>(selected, pair, start, end, destination);
+    break;
+  case 2:
+    CopySelected<2>(selected, pair, start, end, destination);
+    break;
+  case 4:
+    CopySelected<4>(selected, pair, start, end, destination);
+    break;
+  case 8:
+    CopySelected<8>(selected, pair, start, end, destination);
+    break;
+  case 12:
+    CopySelected<12>(selected, pair, start, end, destination);
+    break;
+  case 16:
+    CopySelected<16>(selected, pair, start, end, destination);
+    break;
+  case 24:
+    CopySelected<24>(selected, pair, start, end, destination);
+    break;
+  default:
+    CopySelected<0>(selected, pair, start, end, destination);
+    break;
+  }
+}
+
+/**
+ * @brief Counts the selected tuples of each block
+ */
+class CountImpl
+{
+public:
+  CountImpl(size_t numTuples, const TupleCompactor::BlockPredicate& predicate, size_t* blockCounts)
+  : m_NumTuples(numTuples)
+  , m_Predicate(predicate)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint8_t> selected(k_BlockSize, 0);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumTuples);
+      m_Predicate(start, end, selected.data());
+      size_t count = 0;
+      for(size_t i = 0; i < end - start; i++)
+      {
+        count += (selected[i] != 0) ? 1 : 0;
+      }
+      m_BlockCounts[block] = count;
+    }
+  }
+
+private:
+  size_t m_NumTuples = 0;
+  const TupleCompactor::BlockPredicate& m_Predicate;
+  size_t* m_BlockCounts = nullptr;
+};
+
+/**
+ * @brief Packs the selected tuples of every array pair, one block at a time
+ */
+class GatherImpl
+{
+public:
+  GatherImpl(size_t numTuples, const TupleCompactor::BlockPredicate& predicate, const size_t* blockOffsets, const std::vector<TuplePair>& pairs)
+  : m_NumTuples(numTuples)
+  , m_Predicate(predicate)
+  , m_BlockOffsets(blockOffsets)
+  , m_Pairs(pairs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint8_t> selected(k_BlockSize, 0);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      if(m_BlockOffsets[block] == m_BlockOffsets[block + 1])
+      {
+        continue;
+      }
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumTuples);
+      m_Predicate(start, end, selected.data());
+      // The selection of this block stays in cache while each array is copied
+      for(const auto& pair : m_Pairs)
+      {
+        CopySelected(selected.data(), pair, start, end, m_BlockOffsets[block]);
+      }
+    }
+  }
+
+private:
+  size_t m_NumTuples = 0;
+  const TupleCompactor::BlockPredicate& m_Predicate;
+  const size_t* m_BlockOffsets = nullptr;
+  const std::vector<TuplePair>& m_Pairs;
+};
+
+/**
+ * @brief Calls a function for every selected tuple of each block
+ */
+class ForEachImpl
+{
+public:
+  ForEachImpl(size_t numTuples, const TupleCompactor::BlockPredicate& predicate, const size_t* blockOffsets, const std::function<void(size_t, size_t)>& func)
+  : m_NumTuples(numTuples)
+  , m_Predicate(predicate)
+  , m_BlockOffsets(blockOffsets)
+  , m_Func(func)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint8_t> selected(k_BlockSize, 0);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      if(m_BlockOffsets[block] == m_BlockOffsets[block + 1])
+      {
+        continue;
+      }
+      const size_t start = block * k_BlockSize;
+      const size_t end = std::min(start + k_BlockSize, m_NumTuples);
+      m_Predicate(start, end, selected.data());
+      size_t destination = m_BlockOffsets[block];
+      for(size_t i = start; i < end; i++)
+      {
+        if(selected[i - start] != 0)
+        {
+          m_Func(i, destination++);
+        }
+      }
+    }
+  }
+
+private:
+  size_t m_NumTuples = 0;
+  const TupleCompactor::BlockPredicate& m_Predicate;
+  const size_t* m_BlockOffsets = nullptr;
+  const std::function<void(size_t, size_t)>& m_Func;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactor::TupleCompactor(size_t numTuples, BlockPredicate predicate)
+: m_NumTuples(numTuples)
+, m_Predicate(std::move(predicate))
+{
+  const size_t blockCount = numBlocks();
+  m_BlockOffsets.assign(blockCount + 1, 0);
+  if(blockCount == 0)
+  {
+    return;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, blockCount);
+  dataAlg.execute(CountImpl(m_NumTuples, m_Predicate, m_BlockOffsets.data() + 1));
+
+  // Exclusive prefix sum of the block counts gives the first output position of each block
+  for(size_t block = 1; block <= blockCount; block++)
+  {
+    m_BlockOffsets[block] += m_BlockOffsets[block - 1];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactor::~TupleCompactor() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TupleCompactor::IsSupported(const IDataArray& array)
+{
+  return FeatureDataMapper::IsSupported(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactor::numBlocks() const
+{
+  return (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactor::getNumberOfSelected() const
+{
+  return m_BlockOffsets.back();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TupleCompactor::gather(const std::vector<IDataArrayShPtrType>& sources, const std::vector<IDataArrayShPtrType>& destinations) const
+{
+  if(sources.size() != destinations.size())
+  {
+    return false;
+  }
+
+  std::vector<TuplePair> pairs;
+  pairs.reserve(sources.size());
+  for(size_t i = 0; i < sources.size(); i++)
+  {
+    const IDataArrayShPtrType& source = sources[i];
+    const IDataArrayShPtrType& destination = destinations[i];
+    if(nullptr == source || nullptr == destination || !IsSupported(*source) || source->getTypeAsString() != destination->getTypeAsString() ||
+       source->getNumberOfComponents() != destination->getNumberOfComponents() || source->getNumberOfTuples() != m_NumTuples ||
+       destination->getNumberOfTuples() != getNumberOfSelected())
+    {
+      return false;
+    }
+    if(getNumberOfSelected() == 0)
+    {
+      continue;
+    }
+    TuplePair pair;
+    pair.tupleBytes = source->getTypeSize() * static_cast<size_t>(source->getNumberOfComponents());
+    pair.source = static_cast<const uint8_t*>(source->getVoidPointer(0));
+    pair.destination = static_cast<uint8_t*>(destination->getVoidPointer(0));
+    pairs.push_back(pair);
+  }
+  if(pairs.empty())
+  {
+    return true;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks());
+  dataAlg.execute(GatherImpl(m_NumTuples, m_Predicate, m_BlockOffsets.data(), pairs));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TupleCompactor::forEachSelected(const std::function<void(size_t, size_t)>& func, bool parallel) const
+{
+  if(getNumberOfSelected() == 0)
+  {
+    return;
+  }
+
+  ForEachImpl impl(m_NumTuples, m_Predicate, m_BlockOffsets.data(), func);
+  if(!parallel)
+  {
+    impl(SIMPLRange(0, numBlocks()));
+    return;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks());
+  dataAlg.execute(impl);
+}
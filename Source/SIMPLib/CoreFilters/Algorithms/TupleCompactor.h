@@ -0,0 +1,117 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+class IDataArray;
+using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+
+/**
+ * @brief The TupleCompactor class selects a subset of tuples with a predicate and packs them,
+ * in their original order, into smaller arrays. The selection is evaluated in parallel over fixed
+ * size blocks and an exclusive prefix sum of the block counts gives the output position of every
+ * block. Only the per block offsets are stored, so no index list the size of the selection is
+ * ever built; the predicate is evaluated again block by block when the tuples are gathered.
+ *
+ * Any number of arrays may be gathered in one sweep of the predicate, and the output is
+ * independent of the number of threads.
+ */
+class TupleCompactor
+{
+public:
+  /**
+   * @brief Sets selected[i - start] to a non zero value for each tuple i in [start, end) that is
+   * kept. Called concurrently for different blocks.
+   */
+  using BlockPredicate = std::function<void(size_t start, size_t end, uint8_t* selected)>;
+
+  /**
+   * @brief Evaluates the predicate over numTuples tuples and computes the block offsets
+   * @param numTuples
+   * @param predicate
+   */
+  TupleCompactor(size_t numTuples, BlockPredicate predicate);
+
+  virtual ~TupleCompactor();
+
+  /**
+   * @brief Returns true if the array is a primitive DataArray that gather() can copy.
+   * @param array
+   * @return
+   */
+  static bool IsSupported(const IDataArray& array);
+
+  /**
+   * @brief Returns the number of tuples the predicate kept
+   * @return
+   */
+  size_t getNumberOfSelected() const;
+
+  /**
+   * @brief Copies the selected tuples of each source array into the destination array at the
+   * same position. The destinations must hold getNumberOfSelected() tuples and have the same type
+   * and component count as their source.
+   * @param sources
+   * @param destinations
+   * @return false if the arrays do not match
+   */
+  bool gather(const std::vector<IDataArrayShPtrType>& sources, const std::vector<IDataArrayShPtrType>& destinations) const;
+
+  /**
+   * @brief Calls func(sourceIndex, destinationIndex) for every selected tuple. When parallel is
+   * false the calls are made in increasing index order on the calling thread.
+   * @param func
+   * @param parallel
+   */
+  void forEachSelected(const std::function<void(size_t, size_t)>& func, bool parallel = true) const;
+
+private:
+  size_t m_NumTuples = 0;
+  BlockPredicate m_Predicate;
+  std::vector<size_t> m_BlockOffsets;
+
+  /**
+   * @brief Returns the number of fixed size blocks the tuples are split into
+   * @return
+   */
+  size_t numBlocks() const;
+
+public:
+  TupleCompactor(const TupleCompactor&) = delete;            // Copy Constructor Not Implemented
+  TupleCompactor(TupleCompactor&&) = delete;                 // Move Constructor Not Implemented
+  TupleCompactor& operator=(const TupleCompactor&) = delete; // Copy Assignment Not Implemented
+  TupleCompactor& operator=(TupleCompactor&&) = delete;      // Move Assignment Not Implemented
+};
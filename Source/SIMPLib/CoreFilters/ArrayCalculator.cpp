@@ -900,7 +900,7 @@ bool ArrayCalculator::parseArray(QString token, QVector<CalculatorItem::Pointer>
     return false;
   }
 
-  IDataArray::Pointer dataArray = selectedAM->getAttributeArray(token);
+  IDataArray::Pointer dataArray = selectedAM->getOwnedAttributeArray(token);
   if(firstArray_NumTuples < 0 && firstArray_Name.isEmpty())
   {
     firstArray_NumTuples = dataArray->getNumberOfTuples();
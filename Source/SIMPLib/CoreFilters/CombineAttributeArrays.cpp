@@ -39,6 +39,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/ComponentCopy.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -80,95 +81,155 @@ public:
   {
     typename DataArrayType::Pointer outputDataPtr = std::dynamic_pointer_cast<DataArrayType>(outputIDataArray);
 
-    std::vector<DataType*> inputArrays;
-    int32_t numArrays = inputIDataArrays.size();
-
-    for(int32_t i = 0; i < numArrays; i++)
-    {
-      DataType* inputData = (std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock()))->getPointer(0);
-      inputArrays.push_back(inputData);
-    }
     DataType* outputData = static_cast<DataType*>(outputDataPtr->getPointer(0));
-
     size_t numTuples = inputIDataArrays[0].lock()->getNumberOfTuples();
-    int32_t stackedDims = outputIDataArray.get()->getNumberOfComponents();
+    size_t stackedDims = static_cast<size_t>(outputIDataArray.get()->getNumberOfComponents());
+
+    // Each input array fills its own run of components in every output tuple
+    std::vector<ComponentCopy::ComponentSlice<DataType>> slices;
     size_t arrayOffset = 0;
-    int32_t numDims = 0;
+    for(const auto& inputIDataArray : inputIDataArrays)
+    {
+      typename DataArrayType::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArrayType>(inputIDataArray.lock());
+      size_t numDims = static_cast<size_t>(inputDataPtr->getNumberOfComponents());
+      slices.push_back({inputDataPtr->getPointer(0), numDims, outputData + arrayOffset, stackedDims, numDims});
+      arrayOffset += numDims;
+    }
+    ComponentCopy::CopyComponents(slices, numTuples);
 
     if(filter->getNormalizeData())
     {
-      std::vector<DataType> maxVals(stackedDims, std::numeric_limits<DataType>::lowest());
-      std::vector<DataType> minVals(stackedDims, std::numeric_limits<DataType>::max());
+      normalizeComponents(outputData, numTuples, stackedDims);
+    }
+  }
 
-      for(int32_t i = 0; i < numArrays; i++)
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  static void normalizeComponents(DataType* data, size_t numTuples, size_t numComps)
+  {
+    // Per block ranges are folded in block order. Min and max do not depend on the order anyway
+    // but this keeps the NaN handling identical to a single serial pass.
+    const size_t numBlocks = (numTuples + k_BlockSize - 1) / k_BlockSize;
+    std::vector<DataType> blockMins(numBlocks * numComps, std::numeric_limits<DataType>::max());
+    std::vector<DataType> blockMaxs(numBlocks * numComps, std::numeric_limits<DataType>::lowest());
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute(ComponentRangeImpl(data, numTuples, numComps, blockMins.data(), blockMaxs.data()));
+
+    std::vector<DataType> minVals(numComps, std::numeric_limits<DataType>::max());
+    std::vector<DataType> maxVals(numComps, std::numeric_limits<DataType>::lowest());
+    for(size_t b = 0; b < numBlocks; b++)
+    {
+      for(size_t k = 0; k < numComps; k++)
       {
-        numDims = inputIDataArrays[i].lock()->getNumberOfComponents();
-        if(i > 0)
+        if(blockMaxs[b * numComps + k] > maxVals[k])
         {
-          arrayOffset += inputIDataArrays[i - 1].lock()->getNumberOfComponents();
+          maxVals[k] = blockMaxs[b * numComps + k];
         }
-        for(size_t j = 0; j < numTuples; j++)
+        if(blockMins[b * numComps + k] < minVals[k])
         {
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(inputArrays[i][numDims * j + k] > maxVals[arrayOffset + k])
-            {
-              maxVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-            if(inputArrays[i][numDims * j + k] < minVals[arrayOffset + k])
-            {
-              minVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-          }
+          minVals[k] = blockMins[b * numComps + k];
         }
       }
+    }
+
+    ParallelDataAlgorithm normalizeAlg;
+    normalizeAlg.setRange(0, numTuples);
+    normalizeAlg.execute(NormalizeImpl(data, numComps, minVals.data(), maxVals.data()));
+  }
 
-      arrayOffset = 0;
+private:
+  static constexpr size_t k_BlockSize = 16384;
+
+  /**
+   * @brief Finds the per component minimum and maximum of each block of tuples
+   */
+  class ComponentRangeImpl
+  {
+  public:
+    ComponentRangeImpl(const DataType* data, size_t numTuples, size_t numComps, DataType* blockMins, DataType* blockMaxs)
+    : m_Data(data)
+    , m_NumTuples(numTuples)
+    , m_NumComps(numComps)
+    , m_BlockMins(blockMins)
+    , m_BlockMaxs(blockMaxs)
+    {
+    }
 
-      for(size_t i = 0; i < numTuples; i++)
+    void operator()(const SIMPLRange& range) const
+    {
+      for(size_t b = range.min(); b < range.max(); b++)
       {
-        for(int32_t j = 0; j < numArrays; j++)
+        DataType* mins = m_BlockMins + b * m_NumComps;
+        DataType* maxs = m_BlockMaxs + b * m_NumComps;
+        const size_t end = std::min((b + 1) * k_BlockSize, m_NumTuples);
+        for(size_t i = b * k_BlockSize; i < end; i++)
         {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
-          {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
-          }
-          for(int32_t k = 0; k < numDims; k++)
+          const DataType* tuple = m_Data + i * m_NumComps;
+          for(size_t k = 0; k < m_NumComps; k++)
           {
-            if(maxVals[arrayOffset + k] == minVals[arrayOffset + k])
+            if(tuple[k] > maxs[k])
             {
-              outputData[stackedDims * i + (arrayOffset) + k] = static_cast<DataType>(0);
+              maxs[k] = tuple[k];
             }
-            else
+            if(tuple[k] < mins[k])
             {
-              outputData[stackedDims * i + (arrayOffset) + k] = (inputArrays[j][numDims * i + k] - minVals[arrayOffset + k]) / (maxVals[arrayOffset + k] - minVals[arrayOffset + k]);
+              mins[k] = tuple[k];
             }
           }
         }
-        arrayOffset = 0;
       }
     }
-    else
+
+  private:
+    const DataType* m_Data = nullptr;
+    size_t m_NumTuples = 0;
+    size_t m_NumComps = 0;
+    DataType* m_BlockMins = nullptr;
+    DataType* m_BlockMaxs = nullptr;
+  };
+
+  /**
+   * @brief Rescales every component into [0, 1] in place
+   */
+  class NormalizeImpl
+  {
+  public:
+    NormalizeImpl(DataType* data, size_t numComps, const DataType* minVals, const DataType* maxVals)
+    : m_Data(data)
+    , m_NumComps(numComps)
+    , m_MinVals(minVals)
+    , m_MaxVals(maxVals)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
     {
-      for(size_t i = 0; i < numTuples; i++)
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        for(int32_t j = 0; j < numArrays; j++)
+        DataType* tuple = m_Data + i * m_NumComps;
+        for(size_t k = 0; k < m_NumComps; k++)
         {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
+          if(m_MaxVals[k] == m_MinVals[k])
           {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
+            tuple[k] = static_cast<DataType>(0);
           }
-          for(int32_t k = 0; k < numDims; k++)
+          else
           {
-            outputData[stackedDims * i + (arrayOffset) + k] = inputArrays[j][numDims * i + k];
+            tuple[k] = (tuple[k] - m_MinVals[k]) / (m_MaxVals[k] - m_MinVals[k]);
           }
         }
-        arrayOffset = 0;
       }
     }
-  }
+
+  private:
+    DataType* m_Data = nullptr;
+    size_t m_NumComps = 0;
+    const DataType* m_MinVals = nullptr;
+    const DataType* m_MaxVals = nullptr;
+  };
 
 public:
   CombineAttributeArraysTemplatePrivate(const CombineAttributeArraysTemplatePrivate&) = delete; // Copy Constructor Not Implemented
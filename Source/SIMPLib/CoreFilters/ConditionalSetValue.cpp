@@ -41,6 +41,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/Algorithms/ArrayTransformKernels.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -67,6 +68,7 @@ void ConditionalSetValue::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Category::Parameter, ConditionalSetValue));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
+    req.daTypes.push_back(SIMPL::TypeNames::BitMaskArray);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Conditional Array", ConditionalArrayPath, FilterParameter::Category::RequiredArray, ConditionalSetValue, req));
   }
   {
@@ -124,23 +126,31 @@ void checkValuesFloatDouble(AbstractFilter* filter, double replaceValue, QString
 // -----------------------------------------------------------------------------
 
 template <typename T>
-void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue)
+void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, IDataArray::Pointer condDataPtr, double replaceValue)
 {
   std::ignore = filter;
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
   T replaceVal = static_cast<T>(replaceValue);
 
-  bool* condData = condDataPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
+  size_t numComps = static_cast<size_t>(inputArrayPtr->getNumberOfComponents());
+  if(numTuples == 0)
+  {
+    return;
+  }
+  T* inData = inputArrayPtr->getPointer(0);
 
-  for(size_t iter = 0; iter < numTuples; iter++)
+  // A packed mask only visits the words that have tuples set
+  BitMaskArray::Pointer bitMaskPtr = std::dynamic_pointer_cast<BitMaskArray>(condDataPtr);
+  if(nullptr != bitMaskPtr)
   {
-    if(condData[iter])
-    {
-      inputArrayPtr->initializeTuple(iter, &replaceVal);
-    }
+    ArrayTransformKernels::MaskedFill<T>(inData, numComps, *bitMaskPtr, replaceVal);
+    return;
   }
+
+  bool* condData = std::dynamic_pointer_cast<BoolArrayType>(condDataPtr)->getPointer(0);
+  ArrayTransformKernels::MaskedFill<T>(inData, numTuples, numComps, condData, replaceVal);
 }
 
 // -----------------------------------------------------------------------------
@@ -167,15 +177,24 @@ void ConditionalSetValue::dataCheck()
   }
   dataArrayPaths.push_back(getSelectedArrayPath());
 
-  std::vector<size_t> cDims(1, 1);
-  m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getConditionalArrayPath(), cDims);
+  IDataArray::Pointer conditionalArray = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getConditionalArrayPath());
   if(getErrorCode() < 0)
   {
     return;
   }
-  if(nullptr != m_ConditionalArrayPtr.lock())
+  m_ConditionalBitMaskPtr = std::dynamic_pointer_cast<BitMaskArray>(conditionalArray);
+  if(nullptr == m_ConditionalBitMaskPtr.lock())
   {
-    m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    std::vector<size_t> cDims(1, 1);
+    m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getConditionalArrayPath(), cDims);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    if(nullptr != m_ConditionalArrayPtr.lock())
+    {
+      m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    }
   }
   dataArrayPaths.push_back(getConditionalArrayPath());
 
@@ -247,7 +266,13 @@ void ConditionalSetValue::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  IDataArray::Pointer conditionalArray = m_ConditionalBitMaskPtr.lock();
+  if(nullptr == conditionalArray)
+  {
+    conditionalArray = m_ConditionalArrayPtr.lock();
+  }
+
+  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), conditionalArray, m_ReplaceValue)
 }
 
 // -----------------------------------------------------------------------------
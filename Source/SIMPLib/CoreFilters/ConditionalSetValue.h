@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -192,6 +193,7 @@ protected:
 private:
   std::weak_ptr<DataArray<bool>> m_ConditionalArrayPtr;
   bool* m_ConditionalArray = nullptr;
+  std::weak_ptr<BitMaskArray> m_ConditionalBitMaskPtr;
 
   DataArrayPath m_SelectedArrayPath = {"", "", ""};
   DataArrayPath m_ConditionalArrayPath = {"", "", ""};
@@ -364,7 +364,7 @@ void ConvertColorToGrayScale::execute()
     DataContainer::Pointer m = getDataContainerArray()->getDataContainer(arrayPath.getDataContainerName());
     AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(arrayPath);
 
-    IDataArray::Pointer inputData = attrMat->getAttributeArray(arrayPath.getDataArrayName());
+    IDataArray::Pointer inputData = attrMat->getOwnedAttributeArray(arrayPath.getDataArrayName());
     UInt8ArrayType::Pointer inputColorData = std::dynamic_pointer_cast<UInt8ArrayType>(inputData);
 
     if(nullptr == inputColorData.get())
@@ -40,6 +40,7 @@
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/Algorithms/ArrayTransformKernels.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -79,29 +80,11 @@ void ConvertData(DataArray<O>* origin, const std::vector<size_t>& dims, DataCont
 
   typename DataArray<D>::Pointer p = DataArray<D>::CreateArray(voxels, dims, name, true);
   m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-  for(size_t v = 0; v < size; ++v)
+  if(size == 0)
   {
-    if constexpr(std::is_same<O, D>::value)
-    {
-      // Origin and destination arrays have the same type
-      p->setValue(v, origin->getValue(v));
-    }
-    else if constexpr(std::is_same<O, bool>::value)
-    {
-      // Origin array is a boolean array
-      p->setValue(v, (origin->getValue(v) ? 1 : 0));
-    }
-    else if constexpr(std::is_same<D, bool>::value)
-    {
-      // Destination array is a boolean array
-      p->setValue(v, (origin->getValue(v) != 0));
-    }
-    else
-    {
-      // All other cases
-      p->setValue(v, static_cast<D>(origin->getValue(v)));
-    }
+    return;
   }
+  ArrayTransformKernels::Convert<O, D>(origin->getPointer(0), p->getPointer(0), size);
 }
 
 template <typename T>
@@ -324,7 +307,7 @@ void ConvertData::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_SelectedCellArrayPath.getDataContainerName());
   AttributeMatrix::Pointer am = m->getAttributeMatrix(m_SelectedCellArrayPath.getAttributeMatrixName());
 
-  IDataArray::Pointer iArray = am->getAttributeArray(m_SelectedCellArrayPath.getDataArrayName());
+  IDataArray::Pointer iArray = am->getOwnedAttributeArray(m_SelectedCellArrayPath.getDataArrayName());
 
   if(nullptr == iArray.get())
   {
@@ -41,6 +41,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/Algorithms/TupleCompactor.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -192,32 +193,6 @@ void CropVertexGeometry::dataCheck()
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
-{
-  typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
-  T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
-  typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
-  T* croppedData = static_cast<T*>(croppedDataPtr->getPointer(0));
-
-  size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
-
-  for(std::vector<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
-    {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * croppedPoints[i] + d;
-      croppedData[tmpIndex] = inputData[ptrIndex];
-    }
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -231,42 +206,36 @@ void CropVertexGeometry::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
-  VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
-  std::vector<int64_t> croppedPoints;
-  croppedPoints.reserve(numVerts);
-
-  for(int64_t i = 0; i < numVerts; i++)
-  {
-    if(getCancel())
+  VertexGeom::Pointer vertices = m->getGeometryAs<VertexGeom>();
+  const float* allVerts = vertices->getVertexPointer(0);
+  const float xMin = m_XMin;
+  const float yMin = m_YMin;
+  const float zMin = m_ZMin;
+  const float xMax = m_XMax;
+  const float yMax = m_YMax;
+  const float zMax = m_ZMax;
+
+  // Find the position of every kept vertex in parallel; the vertices and all of the Vertex arrays
+  // are then packed in a single sweep
+  TupleCompactor compactor(vertices->getNumberOfVertices(), [=](size_t start, size_t end, uint8_t* selected) {
+    for(size_t i = start; i < end; i++)
     {
-      return;
-    }
-    if(allVerts[3 * i + 0] >= m_XMin && allVerts[3 * i + 0] <= m_XMax && allVerts[3 * i + 1] >= m_YMin && allVerts[3 * i + 1] <= m_YMax && allVerts[3 * i + 2] >= m_ZMin &&
-       allVerts[3 * i + 2] <= m_ZMax)
-    {
-      croppedPoints.push_back(i);
+      const float* coords = allVerts + 3 * i;
+      selected[i - start] = (coords[0] >= xMin && coords[0] <= xMax && coords[1] >= yMin && coords[1] <= yMax && coords[2] >= zMin && coords[2] <= zMax) ? 1 : 0;
     }
+  });
+  if(getCancel())
+  {
+    return;
   }
 
-  croppedPoints.shrink_to_fit();
-
+  size_t numCroppedPoints = compactor.getNumberOfSelected();
   VertexGeom::Pointer crop = dc->getGeometryAs<VertexGeom>();
-  crop->resizeVertexList(croppedPoints.size());
-  float coords[3] = {0.0f, 0.0f, 0.0f};
+  crop->resizeVertexList(numCroppedPoints);
 
-  for(std::list<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    if(getCancel())
-    {
-      return;
-    }
-    vertices->getCoords(croppedPoints[i], coords);
-    crop->setCoords(i, coords);
-  }
-
-  std::vector<size_t> tDims(1, croppedPoints.size());
+  std::vector<IDataArray::Pointer> sources = {vertices->getVertices()};
+  std::vector<IDataArray::Pointer> destinations = {crop->getVertices()};
+  std::vector<size_t> tDims(1, numCroppedPoints);
 
   for(auto&& attr_mat : m_AttrMatList)
   {
@@ -283,6 +252,11 @@ void CropVertexGeometry::execute()
 
         for(auto&& data_array : srcDataArrays)
         {
+          if(getCancel())
+          {
+            return;
+          }
+
           IDataArray::Pointer src = srcAttrMat->getAttributeArray(data_array);
           IDataArray::Pointer dest = tmpAttrMat->getAttributeArray(data_array);
 
@@ -290,11 +264,30 @@ void CropVertexGeometry::execute()
           assert(dest);
           assert(src->getNumberOfComponents() == dest->getNumberOfComponents());
 
-          EXECUTE_FUNCTION_TEMPLATE(this, copyDataToCroppedGeometry, src, src, dest, croppedPoints)
+          if(TupleCompactor::IsSupported(*src))
+          {
+            sources.push_back(src);
+            destinations.push_back(dest);
+          }
+          else
+          {
+            compactor.forEachSelected([&](size_t srcIndex, size_t destIndex) { dest->copyFromArray(destIndex, src, srcIndex, 1); }, false);
+          }
         }
       }
     }
   }
+
+  if(getCancel())
+  {
+    return;
+  }
+
+  if(!compactor.gather(sources, destinations))
+  {
+    QString ss = QObject::tr("The selected vertices could not be copied into the cropped arrays");
+    setErrorCondition(-5551, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -54,6 +54,7 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/HDF5/H5ScopedLock.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -146,6 +147,9 @@ void DataContainerReader::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
+  // Everything below reads the input file, which may happen on several threads (montage tiles)
+  H5ScopedLock h5Lock;
+
   // Sync the file proxy and cached proxy if the time stamps are different
   QFileInfo fi(getInputFile());
   if(getInputFile() == getLastFileRead() && getLastRead() < fi.lastModified())
@@ -315,6 +319,7 @@ DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(cons
 // -----------------------------------------------------------------------------
 DataContainerArrayProxy DataContainerReader::readDataContainerArrayStructure(const QString& path)
 {
+  H5ScopedLock h5Lock;
   SIMPLH5DataReader::Pointer h5Reader = SIMPLH5DataReader::New();
   if(!h5Reader->openFile(path))
   {
@@ -53,6 +53,7 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/HDF5/H5ScopedLock.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #ifdef _WIN32
@@ -141,6 +142,8 @@ void DataContainerWriter::execute()
     return;
   }
 
+  // The rest of execute() writes the output file, which may happen on several threads (montage tiles)
+  H5ScopedLock h5Lock;
   hid_t fileId = -1;
 
   // Try to open a file to append data into
@@ -39,6 +39,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -150,31 +151,43 @@ void ExtractComponentAsArray::dataCheck()
 
   std::vector<size_t> cDims(1, 1);
   DataArrayPath tempPath(getSelectedArrayPath().getDataContainerName(), getSelectedArrayPath().getAttributeMatrixName(), getNewArrayArrayName());
-  m_NewArrayPtr = TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, cDims, m_InArrayPtr.lock(), DataArrayID);
+  if(getInPreflight())
+  {
+    m_NewArrayPtr = TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, cDims, m_InArrayPtr.lock(), DataArrayID);
+    return;
+  }
+
+  // During execute the new array is a zero-copy view of the selected component that execute() inserts,
+  // so only make sure that it can be inserted.
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, tempPath, -11006);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  if(attrMat->doesAttributeArrayExist(getNewArrayArrayName()))
+  {
+    QString ss = QObject::tr("AttributeMatrix:'%1' An Attribute Array already exists with the name %2.").arg(attrMat->getName()).arg(getNewArrayArrayName());
+    setErrorCondition(-10002, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void extractComponent(IDataArray::Pointer inputData, IDataArray::Pointer newData, int compNumber)
+void extractComponent(IDataArray::Pointer inputData, const AttributeMatrix::Pointer& attrMat, int compNumber, const QString& newArrayName, IDataArray::WeakPointer& newData)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inputData);
-  typename DataArray<T>::Pointer newArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(newData);
-
-  if(nullptr == inputArrayPtr || nullptr == newArrayPtr)
+  if(nullptr == inputArrayPtr)
   {
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
-  T* newArray = newArrayPtr->getPointer(0);
-  size_t numPoints = inputArrayPtr->getNumberOfTuples();
-  size_t numComps = inputArrayPtr->getNumberOfComponents();
-
-  for(size_t i = 0; i < numPoints; i++)
+  typename StridedDataArrayView<T>::Pointer view = StridedDataArrayView<T>::Create(inputArrayPtr, static_cast<size_t>(compNumber), 1, newArrayName);
+  if(nullptr != view)
   {
-    newArray[i] = inputArray[numComps * i + compNumber];
+    attrMat->insertOrAssign(view);
+    newData = view;
   }
 }
 
@@ -189,7 +202,14 @@ void ExtractComponentAsArray::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, extractComponent, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_NewArrayPtr.lock(), m_CompNumber)
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedArrayPath());
+  EXECUTE_FUNCTION_TEMPLATE(this, extractComponent, m_InArrayPtr.lock(), m_InArrayPtr.lock(), attrMat, m_CompNumber, getNewArrayArrayName(), m_NewArrayPtr)
+
+  if(nullptr == m_NewArrayPtr.lock())
+  {
+    QString ss = QObject::tr("Unable to create a view of component %1 of the Attribute Array '%2'").arg(m_CompNumber).arg(getSelectedArrayPath().getDataArrayName());
+    setErrorCondition(-11008, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
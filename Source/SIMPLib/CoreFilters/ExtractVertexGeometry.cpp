@@ -34,12 +34,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ExtractVertexGeometry.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/Algorithms/TupleCompactor.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
@@ -100,6 +102,7 @@ void ExtractVertexGeometry::setupFilterParameters()
 
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Element);
+    req.daTypes.push_back(SIMPL::TypeNames::BitMaskArray);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::Category::RequiredArray, ExtractVertexGeometry, req));
   }
 
@@ -197,22 +200,32 @@ void ExtractVertexGeometry::dataCheck()
   }
   if(m_UseMask)
   {
-    std::vector<size_t> cDims = {1};
-    m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType>(this, getMaskArrayPath(), cDims);
-    if(nullptr != m_MaskPtr.lock())
+    IDataArray::Pointer maskArray = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getMaskArrayPath());
+    if(getErrorCode() < 0)
     {
-      m_Mask = m_MaskPtr.lock()->getPointer(0);
-      if(m_MaskPtr.lock()->getNumberOfTuples() != elementCount)
+      return;
+    }
+    m_BitMaskPtr = std::dynamic_pointer_cast<BitMaskArray>(maskArray);
+    if(nullptr == m_BitMaskPtr.lock())
+    {
+      std::vector<size_t> cDims = {1};
+      m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType>(this, getMaskArrayPath(), cDims);
+      if(nullptr == m_MaskPtr.lock())
       {
-        QString ss = QObject::tr("The data array with path '%1' has a tuple count of %2, but this does not match the "
-                                 "number of tuples required by %4's geometry (%3)")
-                         .arg(getMaskArrayPath().serialize("/"))
-                         .arg(m_MaskPtr.lock()->getNumberOfTuples())
-                         .arg(elementCount)
-                         .arg(dc->getName());
-        setErrorCondition(-2019, ss);
         return;
       }
+      m_Mask = m_MaskPtr.lock()->getPointer(0);
+    }
+    if(maskArray->getNumberOfTuples() != elementCount)
+    {
+      QString ss = QObject::tr("The data array with path '%1' has a tuple count of %2, but this does not match the "
+                               "number of tuples required by %4's geometry (%3)")
+                       .arg(getMaskArrayPath().serialize("/"))
+                       .arg(maskArray->getNumberOfTuples())
+                       .arg(elementCount)
+                       .arg(dc->getName());
+      setErrorCondition(-2019, ss);
+      return;
     }
   }
 
@@ -294,55 +307,58 @@ void ExtractVertexGeometry::execute()
   VertexGeom::Pointer vertexGeom = vertexDC->getGeometryAs<VertexGeom>();
 
   SizeVec3Type dims = sourceGeometry->getDimensions();
-  size_t cellCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
-  size_t totalCells = cellCount; // We save this here because it may change based on the use_mask flag.
+  size_t totalCells = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
 
-  BoolArrayType::Pointer maskArrayPtr = m_MaskPtr.lock();
-  if(m_UseMask)
+  // Select the cells straight from the mask, either packed or one bool per cell. The vertices and
+  // the cell arrays are then packed in parallel without building a list of the selected cells.
+  TupleCompactor::BlockPredicate predicate = [](size_t start, size_t end, uint8_t* selected) { std::fill(selected, selected + (end - start), 1); };
+  BitMaskArray::Pointer bitMaskPtr = m_BitMaskPtr.lock();
+  if(m_UseMask && nullptr != bitMaskPtr)
   {
-    BoolArrayType& maskArray = *(maskArrayPtr);
-    size_t size = maskArray.size();
-    cellCount = 0;
-    for(size_t i = 0; i < size; i++)
-    {
-      if(maskArray[i])
+    const BitMaskArray* bitMask = bitMaskPtr.get();
+    predicate = [bitMask](size_t start, size_t end, uint8_t* selected) {
+      for(size_t i = start; i < end; i++)
       {
-        cellCount++;
+        selected[i - start] = bitMask->getValue(i) ? 1 : 0;
       }
-    }
+    };
+  }
+  else if(m_UseMask)
+  {
+    const bool* mask = m_Mask;
+    predicate = [mask](size_t start, size_t end, uint8_t* selected) {
+      for(size_t i = start; i < end; i++)
+      {
+        selected[i - start] = mask[i] ? 1 : 0;
+      }
+    };
+  }
+  TupleCompactor compactor(totalCells, predicate);
+  if(getCancel())
+  {
+    return;
+  }
+
+  size_t cellCount = compactor.getNumberOfSelected();
+  if(m_UseMask)
+  {
     // Resize the vertex geometry to the proper size
     vertexGeom->resizeVertexList(cellCount);
   }
 
-  SharedVertexList::Pointer vertices = vertexGeom->getVertices();
-  float coords[3] = {0.0f, 0.0f, 0.0f};
-
   // Use the APIs from the IGeometryGrid to get the XYZ coord for the center of each cell and then set that into
   // the new VertexGeometry
-  size_t vertIdx = 0;
-  for(size_t idx = 0; idx < totalCells; idx++)
+  SharedVertexList::Pointer vertices = vertexGeom->getVertices();
+  float* vertexCoords = vertices->getPointer(0);
+  compactor.forEachSelected([&](size_t cellIndex, size_t vertIndex) { sourceGeometry->getCoords(cellIndex, vertexCoords + 3 * vertIndex); });
+  if(getCancel())
   {
-    if(m_UseMask)
-    {
-      if(maskArrayPtr->getValue(idx))
-      {
-        sourceGeometry->getCoords(idx, coords);
-        vertices->setTuple(vertIdx, coords);
-        vertIdx++;
-      }
-    }
-    else
-    {
-      sourceGeometry->getCoords(idx, coords);
-      vertices->setTuple(idx, coords);
-    }
+    return;
   }
 
   // If we are using a mask we need to copy the data from the cell data arrays to the vertex cell data arrays
   if(m_UseMask && !m_IncludedDataArrayPaths.empty())
   {
-    BoolArrayType& maskArray = *(maskArrayPtr);
-
     AttributeMatrix& imageGeomCellAM = *(sourceGeomDC->getAttributeMatrix(m_IncludedDataArrayPaths[0].getAttributeMatrixName()));
 
     DataArrayPath vertCelAMPath = m_VertexDataContainerName;
@@ -354,10 +370,17 @@ void ExtractVertexGeometry::execute()
     // so we can't do a copy or move. We have to copy the values one at a time.
     vertexCellAttrMat.clearAttributeArrays();
     // Correctly set the dimensions on the AttributeMatrix for the vertex array
-    vertexCellAttrMat.resizeAttributeArrays({vertIdx});
+    vertexCellAttrMat.resizeAttributeArrays({cellCount});
 
+    std::vector<IDataArray::Pointer> sources;
+    std::vector<IDataArray::Pointer> destinations;
     for(const auto& dataArrayPath : m_IncludedDataArrayPaths)
     {
+      if(getCancel())
+      {
+        return;
+      }
+
       QString msg;
       QTextStream ss(&msg);
       ss << "Copying '" << dataArrayPath.serialize("/") << "' data from cell data arrays to vertex cell data array.";
@@ -370,22 +393,39 @@ void ExtractVertexGeometry::execute()
       // Create a new DataArray to copy the cell values into
       IDataArray::Pointer destDataArray = imageGeomDataArrayPtrPtr->createNewArray(cellCount, cDims, name, true);
 
-      vertIdx = 0;
-      for(size_t idx = 0; idx < totalCells; idx++)
+      if(TupleCompactor::IsSupported(*imageGeomDataArrayPtrPtr))
       {
-        if(maskArray[idx])
-        {
-          destDataArray->copyFromArray(vertIdx, imageGeomDataArrayPtrPtr, idx, 1);
-          vertIdx++;
-        }
+        sources.push_back(imageGeomDataArrayPtrPtr);
+        destinations.push_back(destDataArray);
+      }
+      else
+      {
+        compactor.forEachSelected([&](size_t cellIndex, size_t vertIndex) { destDataArray->copyFromArray(vertIndex, imageGeomDataArrayPtrPtr, cellIndex, 1); }, false);
       }
 
       // Insert the new data array into the vertex cell attribute matrix
       vertexCellAttrMat.insertOrAssign(destDataArray);
-      // if the user selected to "move" the arrays then remove the source array from its attribute matrix
-      if(static_cast<ArrayHandlingType>(m_ArrayHandling) == ArrayHandlingType::MoveArrays)
+    }
+
+    if(getCancel())
+    {
+      return;
+    }
+
+    // All of the primitive arrays are packed in one sweep of the mask
+    if(!compactor.gather(sources, destinations))
+    {
+      QString ss = QObject::tr("The selected cells could not be copied into the vertex arrays");
+      setErrorCondition(-2020, ss);
+      return;
+    }
+
+    // if the user selected to "move" the arrays then remove the source arrays from their attribute matrix
+    if(static_cast<ArrayHandlingType>(m_ArrayHandling) == ArrayHandlingType::MoveArrays)
+    {
+      for(const auto& dataArrayPath : m_IncludedDataArrayPaths)
       {
-        imageGeomCellAM.removeAttributeArray(name);
+        imageGeomCellAM.removeAttributeArray(dataArrayPath.getDataArrayName());
       }
     }
   }
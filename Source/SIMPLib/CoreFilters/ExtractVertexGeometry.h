@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
@@ -247,6 +248,7 @@ private:
   bool m_UseMask = {false};
   std::weak_ptr<BoolArrayType> m_MaskPtr;
   bool* m_Mask = nullptr;
+  std::weak_ptr<BitMaskArray> m_BitMaskPtr;
 
 public:
   ExtractVertexGeometry(const ExtractVertexGeometry&) = delete;            // Copy Constructor Not Implemented
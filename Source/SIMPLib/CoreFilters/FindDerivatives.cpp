@@ -34,6 +34,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindDerivatives.h"
 
+#include <type_traits>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -41,6 +43,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -140,6 +143,7 @@ void FindDerivatives::setupFilterParameters()
     req.amTypes = amTypes;
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Data Array to Process", SelectedArrayPath, FilterParameter::Category::RequiredArray, FindDerivatives, req));
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store Derivatives as Float", UseFloatOutput, FilterParameter::Category::Parameter, FindDerivatives));
   {
     DataArrayCreationFilterParameter::RequirementType req = DataArrayCreationFilterParameter::CreateRequirement(AttributeMatrix::Category::Unknown);
     AttributeMatrix::Types amTypes;
@@ -161,6 +165,7 @@ void FindDerivatives::readFilterParameters(AbstractFilterParametersReader* reade
   reader->openFilterGroup(this, index);
   setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
   setDerivativesArrayPath(reader->readDataArrayPath("DerivativesArrayPath", getDerivativesArrayPath()));
+  setUseFloatOutput(reader->readValue("UseFloatOutput", getUseFloatOutput()));
   reader->closeFilterGroup();
 }
 
@@ -168,28 +173,11 @@ void FindDerivatives::readFilterParameters(AbstractFilterParametersReader* reade
 //
 // -----------------------------------------------------------------------------
 template <typename DataType>
-void findDerivs(IDataArray::Pointer inDataPtr, DoubleArrayType::Pointer derivs, DataContainer::Pointer m, Observable* observable)
+void interpolateCellValues(IDataArray::Pointer inDataPtr, IDataArray::Pointer derivs, DataContainer::Pointer m, AbstractFilter* filter)
 {
-  typename DataArray<DataType>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<DataType>>(inDataPtr);
-  IGeometry::Pointer geom = m->getGeometry();
-  DoubleArrayType::Pointer dblInArray = DoubleArrayType::CreateArray(inputDataPtr->getNumberOfTuples(), inputDataPtr->getComponentDimensions(), "FIND_DERIVS_INTERNAL_USE_ONLY", true);
-
-  size_t size = inputDataPtr->getSize();
-
-  for(size_t i = 0; i < size; i++)
-  {
-    dblInArray->setValue(i, static_cast<double>(inputDataPtr->getValue(i)));
-  }
-
-  geom->findDerivatives(dblInArray, derivs, observable);
-}
+  // Float fields are averaged in single precision so the vertex copy is no larger than the input
+  using VertexType = typename std::conditional<std::is_same<DataType, float>::value, float, double>::type;
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename DataType>
-void interpolateCellValues(IDataArray::Pointer inDataPtr, DoubleArrayType::Pointer outDataPtr, DataContainer::Pointer m)
-{
   typename DataArray<DataType>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<DataType>>(inDataPtr);
   IGeometry::Pointer geom = m->getGeometry();
   int err = 0;
@@ -204,48 +192,44 @@ void interpolateCellValues(IDataArray::Pointer inDataPtr, DoubleArrayType::Point
   }
 
   ElementDynamicList::Pointer elemsContainingVert = geom->getElementsContainingVert();
-  IGeometry::Type geomType = geom->getGeometryType();
+  SharedVertexList::Pointer verts;
 
-  switch(geomType)
+  switch(geom->getGeometryType())
   {
   case IGeometry::Type::Edge: {
-    EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
-    SharedVertexList::Pointer verts = edgeGeom->getVertices();
-    outDataPtr->resizeTuples(edgeGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    verts = m->getGeometryAs<EdgeGeom>()->getVertices();
     break;
   }
   case IGeometry::Type::Triangle: {
-    TriangleGeom::Pointer triGeom = m->getGeometryAs<TriangleGeom>();
-    SharedVertexList::Pointer verts = triGeom->getVertices();
-    outDataPtr->resizeTuples(triGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    verts = m->getGeometryAs<TriangleGeom>()->getVertices();
     break;
   }
   case IGeometry::Type::Quad: {
-    QuadGeom::Pointer quadGeom = m->getGeometryAs<QuadGeom>();
-    SharedVertexList::Pointer verts = quadGeom->getVertices();
-    outDataPtr->resizeTuples(quadGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    verts = m->getGeometryAs<QuadGeom>()->getVertices();
     break;
   }
   case IGeometry::Type::Tetrahedral: {
-    TetrahedralGeom::Pointer tets = m->getGeometryAs<TetrahedralGeom>();
-    SharedVertexList::Pointer verts = tets->getVertices();
-    outDataPtr->resizeTuples(tets->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    verts = m->getGeometryAs<TetrahedralGeom>()->getVertices();
     break;
   }
   case IGeometry::Type::Hexahedral: {
-    HexahedralGeom::Pointer hexas = m->getGeometryAs<HexahedralGeom>();
-    SharedVertexList::Pointer verts = hexas->getVertices();
-    outDataPtr->resizeTuples(hexas->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    verts = m->getGeometryAs<HexahedralGeom>()->getVertices();
     break;
   }
   default: {
-    break;
+    return;
+  }
   }
+
+  size_t numVerts = verts->getNumberOfTuples();
+  typename DataArray<VertexType>::Pointer outDataPtr = DataArray<VertexType>::CreateArray(numVerts, inputDataPtr->getComponentDimensions(), "FIND_DERIVATIVES_INTERNAL_USE_ONLY", true);
+  std::vector<GeometryHelpers::AveragedArray<DataType, VertexType>> arrays = {GeometryHelpers::MakeAveragedArray(*inputDataPtr, *outDataPtr)};
+  GeometryHelpers::Generic::AverageCellArrayValues<size_t, DataType, uint16_t, VertexType>(*elemsContainingVert, numVerts, arrays);
+
+  if(geom->findDerivatives(outDataPtr, derivs, filter) < 0)
+  {
+    QString ss = QObject::tr("The geometry could not compute derivatives for the interpolated values of '%1'").arg(inDataPtr->getName());
+    filter->setErrorCondition(-11003, ss);
   }
 }
 
@@ -365,11 +349,14 @@ void FindDerivatives::dataCheck()
   cDims *= 3;
   std::vector<size_t> dims(1, cDims);
 
-  m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, getDerivativesArrayPath(), 0, dims, "", DerivativesArrayID);
-  if(nullptr != m_DerivativesArrayPtr.lock())
+  if(m_UseFloatOutput)
   {
-    m_DerivativesArray = m_DerivativesArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, getDerivativesArrayPath(), 0, dims, "", DerivativesArrayID);
+  }
+  else
+  {
+    m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, getDerivativesArrayPath(), 0, dims, "", DerivativesArrayID);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -388,15 +375,16 @@ void FindDerivatives::execute()
 
   if(m_Interpolate)
   {
-    DoubleArrayType::Pointer interpolatedValues =
-        DoubleArrayType::CreateArray(m_InArrayPtr.lock()->getNumberOfTuples(), m_InArrayPtr.lock()->getComponentDimensions(), "FIND_DERIVATIVES_INTERNAL_USE_ONLY", true);
-    EXECUTE_FUNCTION_TEMPLATE(this, interpolateCellValues, m_InArrayPtr.lock(), m_InArrayPtr.lock(), interpolatedValues, m)
-
-    geom->findDerivatives(interpolatedValues, m_DerivativesArrayPtr.lock(), this);
+    EXECUTE_FUNCTION_TEMPLATE(this, interpolateCellValues, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_DerivativesArrayPtr.lock(), m, this)
   }
   else
   {
-    EXECUTE_FUNCTION_TEMPLATE(this, findDerivs, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_DerivativesArrayPtr.lock(), m, this);
+    // The geometry kernels read the input in its native type, so no converted copy is needed
+    if(geom->findDerivatives(m_InArrayPtr.lock(), m_DerivativesArrayPtr.lock(), this) < 0)
+    {
+      QString ss = QObject::tr("The geometry could not compute derivatives of '%1' because its type or the type of the derivatives array is not supported").arg(m_SelectedArrayPath.serialize("/"));
+      setErrorCondition(-11003, ss);
+    }
   }
 }
 
@@ -533,3 +521,15 @@ DataArrayPath FindDerivatives::getDerivativesArrayPath() const
 {
   return m_DerivativesArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void FindDerivatives::setUseFloatOutput(bool value)
+{
+  m_UseFloatOutput = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindDerivatives::getUseFloatOutput() const
+{
+  return m_UseFloatOutput;
+}
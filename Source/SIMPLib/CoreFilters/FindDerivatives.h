@@ -60,6 +60,7 @@ class SIMPLib_EXPORT FindDerivatives : public AbstractFilter
   PYB11_FILTER_NEW_MACRO(FindDerivatives)
   PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
   PYB11_PROPERTY(DataArrayPath DerivativesArrayPath READ getDerivativesArrayPath WRITE setDerivativesArrayPath)
+  PYB11_PROPERTY(bool UseFloatOutput READ getUseFloatOutput WRITE setUseFloatOutput)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -117,6 +118,18 @@ public:
 
   Q_PROPERTY(DataArrayPath DerivativesArrayPath READ getDerivativesArrayPath WRITE setDerivativesArrayPath)
 
+  /**
+   * @brief Setter property for UseFloatOutput
+   */
+  void setUseFloatOutput(bool value);
+  /**
+   * @brief Getter property for UseFloatOutput
+   * @return Value of UseFloatOutput
+   */
+  bool getUseFloatOutput() const;
+
+  Q_PROPERTY(bool UseFloatOutput READ getUseFloatOutput WRITE setUseFloatOutput)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -200,14 +213,14 @@ protected Q_SLOTS:
   void processDerivativesMessage(const AbstractMessage::Pointer& msg);
 
 private:
-  std::weak_ptr<DataArray<double>> m_DerivativesArrayPtr;
-  double* m_DerivativesArray = nullptr;
+  IDataArrayWkPtrType m_DerivativesArrayPtr;
 
   IDataArrayWkPtrType m_InArrayPtr;
 
   DataArrayPath m_SelectedArrayPath = {"", "", ""};
   DataArrayPath m_DerivativesArrayPath = {SIMPL::Defaults::DataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "Derivatives"};
 
+  bool m_UseFloatOutput = {false};
   bool m_Interpolate = {false};
 
 public:
@@ -4,6 +4,10 @@
 
 #include "GenerateColorTable.h"
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -41,7 +45,7 @@ int findRightBinIndex(T nValue, std::vector<float> binPoints)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int findRightBinIndex_Binary(float nValue, std::vector<float> binPoints)
+int findRightBinIndex_Binary(float nValue, const std::vector<float>& binPoints)
 {
   int min = 0, max = binPoints.size() - 1;
   while(min < max)
@@ -59,80 +63,144 @@ int findRightBinIndex_Binary(float nValue, std::vector<float> binPoints)
   return min;
 }
 
+namespace
+{
+// Number of values reduced by one parallel work item. Fixed so that the reduction order does not
+// depend on the number of threads.
+constexpr size_t k_MinMaxBlockSize = 65536;
+
+// Integer arrays whose value range fits in this many entries are colored from a table holding
+// one RGB triplet per possible value, which covers every 8 and 16 bit array.
+constexpr uint64_t k_MaxDirectTableSize = 65536;
+
 /**
- * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
- * for each element in a given array of data
+ * @brief The ColorTableMinMaxImpl class finds the smallest and largest value of each block. The
+ * first value of the array is left out so that the blocks can be folded into it exactly like the
+ * serial loop, including its handling of NaN values.
  */
 template <typename T>
-class GenerateColorTableImpl
+class ColorTableMinMaxImpl
 {
 public:
-  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, std::vector<float> binPoints, std::vector<std::vector<double>> controlPoints, int numControlColors,
-                         UInt8ArrayType::Pointer colorArray)
-  : m_ArrayPtr(arrayPtr)
-  , m_BinPoints(std::move(binPoints))
-  , m_NumControlColors(numControlColors)
-  , m_ControlPoints(std::move(controlPoints))
-  , m_ColorArray(std::move(colorArray))
+  ColorTableMinMaxImpl(const T* data, size_t numValues, T* blockMin, T* blockMax)
+  : m_Data(data)
+  , m_NumValues(numValues)
+  , m_BlockMin(blockMin)
+  , m_BlockMax(blockMax)
   {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for(int i = 1; i < arrayPtr->getNumberOfTuples(); i++)
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    constexpr T k_Highest = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    constexpr T k_Lowest = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+    for(size_t block = range.min(); block < range.max(); block++)
     {
-      if(arrayPtr->getValue(i) < m_ArrayMin)
-      {
-        m_ArrayMin = arrayPtr->getValue(i);
-      }
-      if(arrayPtr->getValue(i) > m_ArrayMax)
+      const size_t start = std::max(block * k_MinMaxBlockSize, static_cast<size_t>(1));
+      const size_t end = std::min(block * k_MinMaxBlockSize + k_MinMaxBlockSize, m_NumValues);
+      T minValue = k_Highest;
+      T maxValue = k_Lowest;
+      for(size_t i = start; i < end; i++)
       {
-        m_ArrayMax = arrayPtr->getValue(i);
+        minValue = (m_Data[i] < minValue) ? m_Data[i] : minValue;
+        maxValue = (m_Data[i] > maxValue) ? m_Data[i] : maxValue;
       }
+      m_BlockMin[block] = minValue;
+      m_BlockMax[block] = maxValue;
     }
   }
+
+private:
+  const T* m_Data = nullptr;
+  size_t m_NumValues = 0;
+  T* m_BlockMin = nullptr;
+  T* m_BlockMax = nullptr;
+};
+} // namespace
+
+/**
+ * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
+ * for each element in a given array of data. When a lookup table is given each value is colored by
+ * copying its table entry, otherwise the color is interpolated from the control points.
+ */
+template <typename T>
+class GenerateColorTableImpl
+{
+public:
+  GenerateColorTableImpl(const T* data, T arrayMin, T arrayMax, const std::vector<float>& binPoints, const std::vector<std::vector<double>>& controlPoints, int numControlColors, uint8_t* colors,
+                         const uint8_t* table = nullptr)
+  : m_Data(data)
+  , m_BinPoints(binPoints)
+  , m_ArrayMin(arrayMin)
+  , m_ArrayMax(arrayMax)
+  , m_NumControlColors(numControlColors)
+  , m_ControlPoints(controlPoints)
+  , m_Colors(colors)
+  , m_Table(table)
+  {
+  }
   virtual ~GenerateColorTableImpl() = default;
 
-  void convert(size_t start, size_t end) const
+  /**
+   * @brief Computes the RGB value of a single data value
+   * @param value
+   * @param rgb
+   */
+  void computeColor(T value, uint8_t* rgb) const
   {
-    for(size_t i = start; i < end; i++)
+    // Normalize value
+    float nValue = (static_cast<float>(value - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
+
+    int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
+
+    int leftBinIndex = rightBinIndex - 1;
+    if(leftBinIndex < 0)
     {
-      // Normalize value
-      float nValue = (static_cast<float>(m_ArrayPtr->getValue(i) - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
+      leftBinIndex = 0;
+      rightBinIndex = 1;
+    }
 
-      int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
+    // Find the fractional distance traveled between the beginning and end of the current color bin
+    float currFraction = 0.0f;
+    if(rightBinIndex < m_BinPoints.size())
+    {
+      currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
+    }
+    else
+    {
+      currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
+    }
 
-      int leftBinIndex = rightBinIndex - 1;
-      if(leftBinIndex < 0)
-      {
-        leftBinIndex = 0;
-        rightBinIndex = 1;
-      }
+    // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
+    // to the last control color.
+    if(leftBinIndex > m_NumControlColors - 1)
+    {
+      leftBinIndex = m_NumControlColors - 1;
+    }
 
-      // Find the fractional distance traveled between the beginning and end of the current color bin
-      float currFraction = 0.0f;
-      if(rightBinIndex < m_BinPoints.size())
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
-      }
-      else
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
-      }
+    // Calculate the RGB values
+    rgb[0] = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
+    rgb[1] = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
+    rgb[2] = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
+  }
 
-      // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
-      // to the last control color.
-      if(leftBinIndex > m_NumControlColors - 1)
+  void convert(size_t start, size_t end) const
+  {
+    if(m_Table != nullptr)
+    {
+      for(size_t i = start; i < end; i++)
       {
-        leftBinIndex = m_NumControlColors - 1;
+        const uint8_t* entry = m_Table + 3 * static_cast<size_t>(m_Data[i] - m_ArrayMin);
+        m_Colors[3 * i + 0] = entry[0];
+        m_Colors[3 * i + 1] = entry[1];
+        m_Colors[3 * i + 2] = entry[2];
       }
+      return;
+    }
 
-      // Calculate the RGB values
-      unsigned char r = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
-      unsigned char g = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
-      unsigned char b = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
-
-      m_ColorArray->setComponent(i, 0, r);
-      m_ColorArray->setComponent(i, 1, g);
-      m_ColorArray->setComponent(i, 2, b);
+    for(size_t i = start; i < end; i++)
+    {
+      computeColor(m_Data[i], m_Colors + 3 * i);
     }
   }
 
@@ -142,13 +210,14 @@ public:
   }
 
 private:
-  typename DataArray<T>::Pointer m_ArrayPtr;
-  std::vector<float> m_BinPoints;
+  const T* m_Data = nullptr;
+  const std::vector<float>& m_BinPoints;
   T m_ArrayMin;
   T m_ArrayMax;
   int m_NumControlColors;
-  std::vector<std::vector<double>> m_ControlPoints;
-  UInt8ArrayType::Pointer m_ColorArray;
+  const std::vector<std::vector<double>>& m_ControlPoints;
+  uint8_t* m_Colors = nullptr;
+  const uint8_t* m_Table = nullptr;
 };
 
 // -----------------------------------------------------------------------------
@@ -202,9 +271,50 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
     return;
   }
 
+  const size_t numValues = arrayPtr->getNumberOfTuples();
+  const T* data = arrayPtr->getPointer(0);
+
+  // Find the range of the data with a blocked parallel reduction
+  const size_t numBlocks = (numValues + k_MinMaxBlockSize - 1) / k_MinMaxBlockSize;
+  std::vector<T> blockMin(numBlocks);
+  std::vector<T> blockMax(numBlocks);
+  ParallelDataAlgorithm minMaxAlg;
+  minMaxAlg.setRange(0, numBlocks);
+  minMaxAlg.execute(ColorTableMinMaxImpl<T>(data, numValues, blockMin.data(), blockMax.data()));
+
+  T arrayMin = data[0];
+  T arrayMax = data[0];
+  for(size_t block = 0; block < numBlocks; block++)
+  {
+    if(blockMin[block] < arrayMin)
+    {
+      arrayMin = blockMin[block];
+    }
+    if(blockMax[block] > arrayMax)
+    {
+      arrayMax = blockMax[block];
+    }
+  }
+
+  // Small integer ranges are colored once per possible value and then copied out of the table
+  std::vector<uint8_t> table;
+  if constexpr(std::is_integral<T>::value)
+  {
+    const uint64_t tableSize = static_cast<uint64_t>(arrayMax) - static_cast<uint64_t>(arrayMin) + 1;
+    if(tableSize <= k_MaxDirectTableSize)
+    {
+      GenerateColorTableImpl<T> tableImpl(data, arrayMin, arrayMax, binPoints, controlPoints, numControlColors, nullptr);
+      table.resize(3 * tableSize);
+      for(uint64_t i = 0; i < tableSize; i++)
+      {
+        tableImpl.computeColor(static_cast<T>(arrayMin + static_cast<T>(i)), table.data() + 3 * i);
+      }
+    }
+  }
+
   ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0, arrayPtr->getNumberOfTuples());
-  dataAlg.execute(GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray));
+  dataAlg.setRange(0, numValues);
+  dataAlg.execute(GenerateColorTableImpl<T>(data, arrayMin, arrayMax, binPoints, controlPoints, numControlColors, colorArray->getPointer(0), table.empty() ? nullptr : table.data()));
 }
 
 // -----------------------------------------------------------------------------
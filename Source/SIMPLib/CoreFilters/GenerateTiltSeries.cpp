@@ -32,7 +32,10 @@
 
 #include "GenerateTiltSeries.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <thread>
 
 #define GTS_GENERATE_DEBUG_ARRAYS 0
@@ -48,8 +51,10 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -59,6 +64,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #ifndef DREAM3D_PASSIVE_ROTATION
 #define DREAM3D_PASSIVE_ROTATION 1
@@ -87,6 +93,71 @@ namespace Detail
 
 const QString k_AttributeMatrixName("Slice Data");
 
+/**
+ * @brief Multiplies a coordinate by a row major 3x3 orientation matrix
+ */
+template <typename T, typename K>
+K transformCoordinate(const T& orientationMatrix, const K& coord)
+{
+  K outCoord = {0, 0, 0};
+
+  outCoord[0] = orientationMatrix[0] * coord[0] + orientationMatrix[1] * coord[1] + orientationMatrix[2] * coord[2];
+  outCoord[1] = orientationMatrix[3] * coord[0] + orientationMatrix[4] * coord[1] + orientationMatrix[5] * coord[2];
+  outCoord[2] = orientationMatrix[6] * coord[0] + orientationMatrix[7] * coord[1] + orientationMatrix[8] * coord[2];
+
+  return outCoord;
+}
+
+/**
+ * @brief Converts an axis-angle (x, y, z, radians) into a row major 3x3 orientation matrix
+ */
+template <typename InputType, typename OutputType>
+OutputType ax2om(const InputType& a)
+{
+  OutputType res(9);
+  typename OutputType::value_type q = 0.0L;
+  typename OutputType::value_type c = 0.0L;
+  typename OutputType::value_type s = 0.0L;
+  typename OutputType::value_type omc = 0.0L;
+
+  c = cos(a[3]);
+  s = sin(a[3]);
+
+  omc = 1.0f - c;
+
+  res[0] = a[0] * a[0] * omc + c;
+  res[4] = a[1] * a[1] * omc + c;
+  res[8] = a[2] * a[2] * omc + c;
+  size_t _01 = 1;
+  size_t _10 = 3;
+  size_t _12 = 5;
+  size_t _21 = 7;
+  size_t _02 = 2;
+  size_t _20 = 6;
+  // Check to see if we need to transpose
+  if(Rotations::Constants::epsijk == 1.0f)
+  {
+    _01 = 3;
+    _10 = 1;
+    _12 = 7;
+    _21 = 5;
+    _02 = 6;
+    _20 = 2;
+  }
+
+  q = omc * a[0] * a[1];
+  res[_01] = q + s * a[2];
+  res[_10] = q - s * a[2];
+  q = omc * a[1] * a[2];
+  res[_12] = q + s * a[0];
+  res[_21] = q - s * a[0];
+  q = omc * a[2] * a[0];
+  res[_02] = q - s * a[1];
+  res[_20] = q + s * a[1];
+
+  return res;
+}
+
 class ResampleGrid
 {
 public:
@@ -240,75 +311,281 @@ public:
 #endif
   }
 
-  template <typename T, typename K>
-  K transformCoordinate(const T& orientationMatrix, const K& coord) const
+private:
+  GenerateTiltSeries* m_Filter = nullptr;
+  FloatArrayType::Pointer m_Coords;
+  DataContainer::Pointer m_OutputDC;
+  std::array<float, 4> m_RotationAxis;
+#if GTS_GENERATE_DEBUG_ARRAYS
+  size_t m_GridIndex = 0;
+#endif
+};
+
+/**
+ * @brief Index of the axis the beam travels along before the tilt is applied, i.e. the normal of the sampling plane
+ */
+inline size_t BeamAxis(int32_t rotationAxis)
+{
+  return (rotationAxis == GenerateTiltSeries::k_YAxis) ? 0 : (rotationAxis == GenerateTiltSeries::k_ZAxis) ? 1 : 2;
+}
+
+/**
+ * @brief Index of the in-plane axis perpendicular to the rotation axis; grid points along it are contiguous
+ */
+inline size_t DetectorRowAxis(int32_t rotationAxis)
+{
+  return (rotationAxis == GenerateTiltSeries::k_YAxis) ? 2 : (rotationAxis == GenerateTiltSeries::k_ZAxis) ? 0 : 1;
+}
+
+/**
+ * @brief The untilted start points of the rays, shared by every tilt: each grid point moved to firstOffset
+ * along the beam axis, relative to the center of the volume.
+ */
+struct ProjectionGrid
+{
+  const float* coords = nullptr;
+  FloatVec3Type center;
+  size_t beamAxis = 0;
+  float firstOffset = 0.0f;
+};
+
+/**
+ * @brief The rays of one tilt: the row major rotation that is applied to the grid and the rotated step
+ * along the beam direction. Every ray of a tilt shares the same step.
+ */
+struct ProjectionTilt
+{
+  std::array<float, 9> rotation;
+  FloatVec3Type step;
+  float* output = nullptr;
+};
+
+/**
+ * @brief The ProjectRowsImpl class ray marches one detector row of one tilt per index of its range.
+ *
+ * The rays of a row are advanced together: the outer loop walks along the beam and the inner loop runs
+ * over the row's pixels on structure-of-arrays coordinate buffers, so the position update and the voxel
+ * index arithmetic vectorize. Samples outside of the volume contribute nothing.
+ */
+template <typename T>
+class ProjectRowsImpl
+{
+public:
+  ProjectRowsImpl(const T* input, size_t numComps, const SizeVec3Type& dims, const FloatVec3Type& origin, const FloatVec3Type& spacing, const ProjectionGrid& grid,
+                  const std::vector<ProjectionTilt>& tilts, const std::vector<size_t>& outputIndices, size_t rowLength, size_t numSteps, float stepLength, int32_t mode, bool trilinear)
+  : m_Input(input)
+  , m_NumComps(numComps)
+  , m_Dims(dims)
+  , m_Origin(origin)
+  , m_Spacing(spacing)
+  , m_Grid(grid)
+  , m_Tilts(tilts)
+  , m_OutputIndices(outputIndices)
+  , m_RowLength(rowLength)
+  , m_NumSteps(numSteps)
+  , m_StepLength(stepLength)
+  , m_Mode(mode)
+  , m_Trilinear(trilinear)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
   {
-    K outCoord = {0, 0, 0};
+    const size_t numPixels = m_OutputIndices.size();
+    const size_t numRows = (numPixels + m_RowLength - 1) / m_RowLength;
 
-    outCoord[0] = orientationMatrix[0] * coord[0] + orientationMatrix[1] * coord[1] + orientationMatrix[2] * coord[2];
-    outCoord[1] = orientationMatrix[3] * coord[0] + orientationMatrix[4] * coord[1] + orientationMatrix[5] * coord[2];
-    outCoord[2] = orientationMatrix[6] * coord[0] + orientationMatrix[7] * coord[1] + orientationMatrix[8] * coord[2];
+    std::vector<float> x(m_RowLength);
+    std::vector<float> y(m_RowLength);
+    std::vector<float> z(m_RowLength);
+    std::vector<float> accumulator(m_RowLength * m_NumComps);
+    std::vector<uint8_t> hit(m_RowLength);
 
-    return outCoord;
+    for(size_t index = range.min(); index < range.max(); index++)
+    {
+      const ProjectionTilt& tilt = m_Tilts[index / numRows];
+      const size_t firstPixel = (index % numRows) * m_RowLength;
+      const size_t rowPixels = std::min(m_RowLength, numPixels - firstPixel);
+
+      initializeRays(tilt, firstPixel, rowPixels, x.data(), y.data(), z.data());
+      std::fill(accumulator.begin(), accumulator.end(), (m_Mode == GenerateTiltSeries::k_MaximumProjection) ? std::numeric_limits<float>::lowest() : 0.0f);
+      std::fill(hit.begin(), hit.end(), static_cast<uint8_t>(0));
+
+      for(size_t s = 0; s < m_NumSteps; s++)
+      {
+        if(m_Trilinear)
+        {
+          sampleTrilinear(x.data(), y.data(), z.data(), rowPixels, accumulator.data(), hit.data());
+        }
+        else
+        {
+          sampleNearest(x.data(), y.data(), z.data(), rowPixels, accumulator.data(), hit.data());
+        }
+        for(size_t p = 0; p < rowPixels; p++)
+        {
+          x[p] += tilt.step[0];
+          y[p] += tilt.step[1];
+          z[p] += tilt.step[2];
+        }
+      }
+
+      for(size_t p = 0; p < rowPixels; p++)
+      {
+        const size_t outputIndex = m_OutputIndices[firstPixel + p];
+        if(outputIndex == std::numeric_limits<size_t>::max())
+        {
+          continue;
+        }
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          float value = accumulator[p * m_NumComps + c];
+          if(m_Mode == GenerateTiltSeries::k_MaximumProjection)
+          {
+            value = (hit[p] != 0) ? value : 0.0f;
+          }
+          else
+          {
+            // Turn the sum of samples into a line integral in the units of the geometry
+            value *= m_StepLength;
+          }
+          tilt.output[outputIndex * m_NumComps + c] = value;
+        }
+      }
+    }
   }
 
-  template <typename InputType, typename OutputType>
-  OutputType ax2om(const InputType& a) const
+private:
+  /**
+   * @brief Rotates the start points of a row's rays with the tilt. They are computed here rather than
+   * stored per tilt so that memory does not grow with the number of tilts.
+   */
+  void initializeRays(const ProjectionTilt& tilt, size_t firstPixel, size_t rowPixels, float* x, float* y, float* z) const
   {
-    OutputType res(9);
-    typename OutputType::value_type q = 0.0L;
-    typename OutputType::value_type c = 0.0L;
-    typename OutputType::value_type s = 0.0L;
-    typename OutputType::value_type omc = 0.0L;
+    const std::array<float, 9>& om = tilt.rotation;
+    const FloatVec3Type& center = m_Grid.center;
+    for(size_t p = 0; p < rowPixels; p++)
+    {
+      const float* coord = m_Grid.coords + 3 * (firstPixel + p);
+      std::array<float, 3> relative = {coord[0] - center[0], coord[1] - center[1], coord[2] - center[2]};
+      relative[m_Grid.beamAxis] = m_Grid.firstOffset;
+      x[p] = om[0] * relative[0] + om[1] * relative[1] + om[2] * relative[2] + center[0];
+      y[p] = om[3] * relative[0] + om[4] * relative[1] + om[5] * relative[2] + center[1];
+      z[p] = om[6] * relative[0] + om[7] * relative[1] + om[8] * relative[2] + center[2];
+    }
+  }
 
-    c = cos(a[3]);
-    s = sin(a[3]);
+  /**
+   * @brief Continuous voxel coordinate of a position along one axis; the volume covers [0, dim)
+   */
+  float toVoxel(float position, size_t axis) const
+  {
+    return (position - m_Origin[axis]) / m_Spacing[axis];
+  }
 
-    omc = 1.0f - c;
+  void accumulate(float* accumulator, size_t p, size_t c, float value) const
+  {
+    float& target = accumulator[p * m_NumComps + c];
+    if(m_Mode == GenerateTiltSeries::k_MaximumProjection)
+    {
+      target = std::max(target, value);
+    }
+    else
+    {
+      target += value;
+    }
+  }
 
-    res[0] = a[0] * a[0] * omc + c;
-    res[4] = a[1] * a[1] * omc + c;
-    res[8] = a[2] * a[2] * omc + c;
-    size_t _01 = 1;
-    size_t _10 = 3;
-    size_t _12 = 5;
-    size_t _21 = 7;
-    size_t _02 = 2;
-    size_t _20 = 6;
-    // Check to see if we need to transpose
-    if(Rotations::Constants::epsijk == 1.0f)
+  void sampleNearest(const float* x, const float* y, const float* z, size_t rowPixels, float* accumulator, uint8_t* hit) const
+  {
+    for(size_t p = 0; p < rowPixels; p++)
     {
-      _01 = 3;
-      _10 = 1;
-      _12 = 7;
-      _21 = 5;
-      _02 = 6;
-      _20 = 2;
+      const float u = toVoxel(x[p], 0);
+      const float v = toVoxel(y[p], 1);
+      const float w = toVoxel(z[p], 2);
+      if(u < 0.0f || v < 0.0f || w < 0.0f || u >= static_cast<float>(m_Dims[0]) || v >= static_cast<float>(m_Dims[1]) || w >= static_cast<float>(m_Dims[2]))
+      {
+        continue;
+      }
+      const size_t voxel = (static_cast<size_t>(w) * m_Dims[1] + static_cast<size_t>(v)) * m_Dims[0] + static_cast<size_t>(u);
+      hit[p] = 1;
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        accumulate(accumulator, p, c, static_cast<float>(m_Input[voxel * m_NumComps + c]));
+      }
     }
+  }
 
-    q = omc * a[0] * a[1];
-    res[_01] = q + s * a[2];
-    res[_10] = q - s * a[2];
-    q = omc * a[1] * a[2];
-    res[_12] = q + s * a[0];
-    res[_21] = q - s * a[0];
-    q = omc * a[2] * a[0];
-    res[_02] = q - s * a[1];
-    res[_20] = q + s * a[1];
+  void sampleTrilinear(const float* x, const float* y, const float* z, size_t rowPixels, float* accumulator, uint8_t* hit) const
+  {
+    for(size_t p = 0; p < rowPixels; p++)
+    {
+      const std::array<float, 3> voxel = {toVoxel(x[p], 0), toVoxel(y[p], 1), toVoxel(z[p], 2)};
+      if(voxel[0] < 0.0f || voxel[1] < 0.0f || voxel[2] < 0.0f || voxel[0] >= static_cast<float>(m_Dims[0]) || voxel[1] >= static_cast<float>(m_Dims[1]) ||
+         voxel[2] >= static_cast<float>(m_Dims[2]))
+      {
+        continue;
+      }
+
+      // Values sit at the cell centers; neighbours are clamped to the volume at its edges
+      std::array<size_t, 3> lower = {0, 0, 0};
+      std::array<size_t, 3> upper = {0, 0, 0};
+      std::array<float, 3> fraction = {0.0f, 0.0f, 0.0f};
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        const float centered = voxel[axis] - 0.5f;
+        const float floored = std::floor(centered);
+        fraction[axis] = centered - floored;
+        const int64_t index = static_cast<int64_t>(floored);
+        lower[axis] = static_cast<size_t>(std::max<int64_t>(index, 0));
+        upper[axis] = static_cast<size_t>(std::min<int64_t>(index + 1, static_cast<int64_t>(m_Dims[axis]) - 1));
+      }
 
-    return res;
+      hit[p] = 1;
+      const size_t dimX = m_Dims[0];
+      const size_t dimXY = m_Dims[0] * m_Dims[1];
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        auto value = [&](size_t i, size_t j, size_t k) { return static_cast<float>(m_Input[(k * dimXY + j * dimX + i) * m_NumComps + c]); };
+        const float c00 = value(lower[0], lower[1], lower[2]) * (1.0f - fraction[0]) + value(upper[0], lower[1], lower[2]) * fraction[0];
+        const float c10 = value(lower[0], upper[1], lower[2]) * (1.0f - fraction[0]) + value(upper[0], upper[1], lower[2]) * fraction[0];
+        const float c01 = value(lower[0], lower[1], upper[2]) * (1.0f - fraction[0]) + value(upper[0], lower[1], upper[2]) * fraction[0];
+        const float c11 = value(lower[0], upper[1], upper[2]) * (1.0f - fraction[0]) + value(upper[0], upper[1], upper[2]) * fraction[0];
+        const float c0 = c00 * (1.0f - fraction[1]) + c10 * fraction[1];
+        const float c1 = c01 * (1.0f - fraction[1]) + c11 * fraction[1];
+        accumulate(accumulator, p, c, c0 * (1.0f - fraction[2]) + c1 * fraction[2]);
+      }
+    }
   }
 
-private:
-  GenerateTiltSeries* m_Filter = nullptr;
-  FloatArrayType::Pointer m_Coords;
-  DataContainer::Pointer m_OutputDC;
-  std::array<float, 4> m_RotationAxis;
-#if GTS_GENERATE_DEBUG_ARRAYS
-  size_t m_GridIndex = 0;
-#endif
+  const T* m_Input = nullptr;
+  size_t m_NumComps = 1;
+  SizeVec3Type m_Dims;
+  FloatVec3Type m_Origin;
+  FloatVec3Type m_Spacing;
+  ProjectionGrid m_Grid;
+  const std::vector<ProjectionTilt>& m_Tilts;
+  const std::vector<size_t>& m_OutputIndices;
+  size_t m_RowLength = 1;
+  size_t m_NumSteps = 0;
+  float m_StepLength = 1.0f;
+  int32_t m_Mode = GenerateTiltSeries::k_SumProjection;
+  bool m_Trilinear = false;
 };
 
+/**
+ * @brief Runs ProjectRowsImpl over every row of every tilt
+ */
+template <typename T>
+void ProjectTilts(const IDataArray::Pointer& inputData, const SizeVec3Type& dims, const FloatVec3Type& origin, const FloatVec3Type& spacing, const ProjectionGrid& grid,
+                  const std::vector<ProjectionTilt>& tilts, const std::vector<size_t>& outputIndices, size_t rowLength, size_t numSteps, float stepLength, int32_t mode, bool trilinear)
+{
+  typename DataArray<T>::Pointer typedInput = std::dynamic_pointer_cast<DataArray<T>>(inputData);
+  const size_t numRows = (outputIndices.size() + rowLength - 1) / rowLength;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRows * tilts.size());
+  dataAlg.execute(ProjectRowsImpl<T>(typedInput->getPointer(0), typedInput->getNumberOfComponents(), dims, origin, spacing, grid, tilts, outputIndices, rowLength, numSteps, stepLength, mode, trilinear));
+}
+
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -357,6 +634,22 @@ void GenerateTiltSeries::setupFilterParameters()
   }
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Rotation Limits (Start, Stop, Increment) Degrees", RotationLimits, FilterParameter::Category::Parameter, GenerateTiltSeries));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resample Spacing", Spacing, FilterParameter::Category::Parameter, GenerateTiltSeries));
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Projection Mode");
+    parameter->setPropertyName("ProjectionMode");
+
+    std::vector<QString> choices;
+    choices.push_back("Resampled Slice");
+    choices.push_back("Sum Projection");
+    choices.push_back("Maximum Projection");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(GenerateTiltSeries, this, ProjectionMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(GenerateTiltSeries, this, ProjectionMode));
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Trilinear Interpolation", UseTrilinearInterpolation, FilterParameter::Category::Parameter, GenerateTiltSeries));
   //  DataArrayCreationFilterParameter::RequirementType dacReq;
   //  parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Created Array Path", CreatedArrayPath, FilterParameter::Category::Parameter, GenerateTiltSeries, dacReq));
   DataArraySelectionFilterParameter::RequirementType dasReq;
@@ -385,6 +678,19 @@ void GenerateTiltSeries::dataCheck()
     return;
   }
 
+  if(getProjectionMode() < k_ResampledSlice || getProjectionMode() > k_MaximumProjection)
+  {
+    QString ss = QObject::tr("The Projection Mode must be 0 (Resampled Slice), 1 (Sum Projection) or 2 (Maximum Projection)");
+    setErrorCondition(-3000, ss);
+    return;
+  }
+  if(getProjectionMode() != k_ResampledSlice && getSpacing()[Detail::BeamAxis(getRotationAxis())] <= 0.0f)
+  {
+    QString ss = QObject::tr("The Resample Spacing along the beam direction sets the ray marching step of the projection and must be greater than zero");
+    setErrorCondition(-3001, ss);
+    return;
+  }
+
   // Generate Data Structure
   std::pair<FloatArrayType::Pointer, ImageGeom::Pointer> gridPair;
   if(getRotationAxis() == k_XAxis)
@@ -419,8 +725,16 @@ void GenerateTiltSeries::dataCheck()
     AttributeMatrix::Pointer cellAttr = AttributeMatrix::New({gridDims[0], gridDims[1], gridDims[2]}, Detail::k_AttributeMatrixName, AttributeMatrix::Type::Cell);
     gridDC->insertOrAssign(cellAttr);
 
-    IDataArray::Pointer outputData =
-        inputData->createNewArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    // Projections are line integrals or maxima of the sampled values, so they are always stored as float
+    IDataArray::Pointer outputData;
+    if(getProjectionMode() == k_ResampledSlice)
+    {
+      outputData = inputData->createNewArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    }
+    else
+    {
+      outputData = FloatArrayType::CreateArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    }
     cellAttr->insertOrAssign(outputData);
     getDataContainerArray()->insertOrAssign(gridDC);
 
@@ -463,6 +777,12 @@ void GenerateTiltSeries::execute()
   ImageGeom::Pointer gridGeometry = gridPair.second;
   DataContainerArray::Pointer dca = getDataContainerArray();
 
+  if(getProjectionMode() != k_ResampledSlice)
+  {
+    executeProjections(gridCoords, gridGeometry);
+    return;
+  }
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   std::shared_ptr<tbb::task_group> g(new tbb::task_group);
   // C++11 RIGHT HERE....
@@ -548,6 +868,81 @@ void GenerateTiltSeries::execute()
 #endif
 }
 
+// -----------------------------------------------------------------------------
+void GenerateTiltSeries::executeProjections(const FloatArrayType::Pointer& gridCoords, const ImageGeom::Pointer& gridGeometry)
+{
+  DataContainerArray::Pointer dca = getDataContainerArray();
+  IDataArray::Pointer inputData = dca->getAttributeMatrix(getInputDataArrayPath())->getOwnedAttributeArray(getInputDataArrayPath().getDataArrayName());
+  ImageGeom::Pointer inputImageGeom = dca->getDataContainer(getInputDataArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
+  SizeVec3Type dims = inputImageGeom->getDimensions();
+  FloatVec3Type origin = inputImageGeom->getOrigin();
+  FloatVec3Type spacing = inputImageGeom->getSpacing();
+  FloatVec6Type bounds = inputImageGeom->getBoundingBox();
+  FloatVec3Type center((bounds[1] - bounds[0]) / 2.0f + bounds[0], (bounds[3] - bounds[2]) / 2.0f + bounds[2], (bounds[5] - bounds[4]) / 2.0f + bounds[4]);
+
+  const size_t beamAxis = Detail::BeamAxis(getRotationAxis());
+  const size_t rowAxis = Detail::DetectorRowAxis(getRotationAxis());
+  const SizeVec3Type gridDims = gridGeometry->getDimensions();
+  const size_t rowLength = gridDims[rowAxis];
+  const size_t numPixels = gridCoords->getNumberOfTuples();
+
+  // Every ray is long enough to cross the volume at any tilt and is centered on the plane through the volume center
+  const float stepLength = getSpacing()[beamAxis];
+  const float diagonal = std::sqrt((bounds[1] - bounds[0]) * (bounds[1] - bounds[0]) + (bounds[3] - bounds[2]) * (bounds[3] - bounds[2]) + (bounds[5] - bounds[4]) * (bounds[5] - bounds[4]));
+  const size_t numSteps = static_cast<size_t>(std::ceil(diagonal / stepLength));
+  const float firstOffset = -static_cast<float>(numSteps) * stepLength / 2.0f + stepLength / 2.0f;
+
+  // The detector pixel that each grid point writes into is the same for every tilt
+  std::vector<size_t> outputIndices(numPixels, std::numeric_limits<size_t>::max());
+  for(size_t pixel = 0; pixel < numPixels; pixel++)
+  {
+    size_t outputIndex = 0;
+    if(gridGeometry->computeCellIndex(gridCoords->getTuplePointer(pixel), outputIndex) == ImageGeom::ErrorType::NoError)
+    {
+      outputIndices[pixel] = outputIndex;
+    }
+  }
+
+  FloatVec3Type beamDirection(0.0f, 0.0f, 0.0f);
+  beamDirection[beamAxis] = 1.0f;
+
+  std::vector<Detail::ProjectionTilt> tilts;
+  size_t gridIndex = 0;
+  for(float currentDeg = m_RotationLimits[0]; currentDeg < m_RotationLimits[1]; currentDeg += m_RotationLimits[2])
+  {
+    std::array<float, 4> rotationAxis = {0.0f, 0.0f, 0.0f, currentDeg * static_cast<float>(SIMPLib::Constants::k_PiOver180D)};
+    rotationAxis[getRotationAxis()] = 1.0f;
+    std::vector<float> om = Detail::ax2om<std::array<float, 4>, std::vector<float>>(rotationAxis);
+
+    Detail::ProjectionTilt tilt;
+    FloatVec3Type step = Detail::transformCoordinate<std::vector<float>, FloatVec3Type>(om, beamDirection);
+    tilt.step = FloatVec3Type(step[0] * stepLength, step[1] * stepLength, step[2] * stepLength);
+    std::copy_n(om.begin(), tilt.rotation.size(), tilt.rotation.begin());
+
+    DataContainer::Pointer gridDC = dca->getDataContainer(m_OutputPrefix + QString::number(gridIndex));
+    FloatArrayType::Pointer outputData = gridDC->getAttributeMatrix(Detail::k_AttributeMatrixName)->getAttributeArrayAs<FloatArrayType>(getInputDataArrayPath().getDataArrayName());
+    outputData->initializeWithZeros();
+    tilt.output = outputData->getPointer(0);
+    tilts.push_back(std::move(tilt));
+    gridIndex++;
+  }
+
+  if(tilts.empty() || rowLength == 0)
+  {
+    return;
+  }
+
+  Detail::ProjectionGrid grid;
+  grid.coords = gridCoords->getPointer(0);
+  grid.center = center;
+  grid.beamAxis = beamAxis;
+  grid.firstOffset = firstOffset;
+
+  notifyStatusMessage(QString("Projecting %1 Tilts").arg(tilts.size()));
+  EXECUTE_FUNCTION_TEMPLATE(this, Detail::ProjectTilts, inputData, inputData, dims, origin, spacing, grid, tilts, outputIndices, rowLength, numSteps, stepLength, getProjectionMode(),
+                            getUseTrilinearInterpolation());
+}
+
 // -----------------------------------------------------------------------------
 std::pair<FloatArrayType::Pointer, ImageGeom::Pointer> GenerateTiltSeries::generateZAxisGrid()
 {
@@ -953,6 +1348,30 @@ int GenerateTiltSeries::getRotationAxis() const
   return m_RotationAxis;
 }
 
+// -----------------------------------------------------------------------------
+void GenerateTiltSeries::setProjectionMode(int value)
+{
+  m_ProjectionMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int GenerateTiltSeries::getProjectionMode() const
+{
+  return m_ProjectionMode;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateTiltSeries::setUseTrilinearInterpolation(bool value)
+{
+  m_UseTrilinearInterpolation = value;
+}
+
+// -----------------------------------------------------------------------------
+bool GenerateTiltSeries::getUseTrilinearInterpolation() const
+{
+  return m_UseTrilinearInterpolation;
+}
+
 // -----------------------------------------------------------------------------
 void GenerateTiltSeries::setRotationLimits(const FloatVec3Type& value)
 {
@@ -58,6 +58,8 @@ class SIMPLib_EXPORT GenerateTiltSeries : public AbstractFilter
   PYB11_PROPERTY(float Spacing READ getSpacing WRITE setSpacing)
   PYB11_PROPERTY(DataArrayPath InputDataArrayPath READ getInputDataArrayPath WRITE setInputDataArrayPath)
   PYB11_PROPERTY(QString OutputPrefix READ getOutputPrefix WRITE setOutputPrefix)
+  PYB11_PROPERTY(int ProjectionMode READ getProjectionMode WRITE setProjectionMode)
+  PYB11_PROPERTY(bool UseTrilinearInterpolation READ getUseTrilinearInterpolation WRITE setUseTrilinearInterpolation)
   PYB11_END_BINDINGS()
   // clang-format on
   // End Python bindings declarations
@@ -88,6 +90,10 @@ public:
   static constexpr int32_t k_YAxis = 1;
   static constexpr int32_t k_ZAxis = 2;
 
+  static constexpr int32_t k_ResampledSlice = 0;
+  static constexpr int32_t k_SumProjection = 1;
+  static constexpr int32_t k_MaximumProjection = 2;
+
   /**
    * @brief Setter property for RotationAxis
    */
@@ -148,6 +154,30 @@ public:
 
   Q_PROPERTY(QString OutputPrefix READ getOutputPrefix WRITE setOutputPrefix)
 
+  /**
+   * @brief Setter property for ProjectionMode
+   */
+  void setProjectionMode(int value);
+  /**
+   * @brief Getter property for ProjectionMode
+   * @return Value of ProjectionMode
+   */
+  int getProjectionMode() const;
+
+  Q_PROPERTY(int ProjectionMode READ getProjectionMode WRITE setProjectionMode)
+
+  /**
+   * @brief Setter property for UseTrilinearInterpolation
+   */
+  void setUseTrilinearInterpolation(bool value);
+  /**
+   * @brief Getter property for UseTrilinearInterpolation
+   * @return Value of UseTrilinearInterpolation
+   */
+  bool getUseTrilinearInterpolation() const;
+
+  Q_PROPERTY(bool UseTrilinearInterpolation READ getUseTrilinearInterpolation WRITE setUseTrilinearInterpolation)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -220,12 +250,21 @@ protected:
   std::pair<FloatArrayType::Pointer, ImageGeom::Pointer> generateYAxisGrid();
   std::pair<FloatArrayType::Pointer, ImageGeom::Pointer> generateZAxisGrid();
 
+  /**
+   * @brief Computes the sum or maximum intensity projection of every tilt into the output DataContainers
+   * @param gridCoords
+   * @param gridGeometry
+   */
+  void executeProjections(const FloatArrayType::Pointer& gridCoords, const ImageGeom::Pointer& gridGeometry);
+
 private:
   int m_RotationAxis = 0;
   FloatVec3Type m_RotationLimits = FloatVec3Type{0.0f, 180.f, 10.0f};
   FloatVec3Type m_Spacing = FloatVec3Type(1.0, 1.0, 1.0);
   DataArrayPath m_InputDataArrayPath = DataArrayPath("DataContainer", "AttributeMatrix", "FeatureIds");
   QString m_OutputPrefix = {"Rotation_"};
+  int m_ProjectionMode = k_ResampledSlice;
+  bool m_UseTrilinearInterpolation = false;
 
   static constexpr unsigned Dimension = 3;
 
@@ -381,7 +381,7 @@ void InitializeData::execute()
 
   for(const QString& name : voxelArrayNames)
   {
-    IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(name);
+    IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getOwnedAttributeArray(name);
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     g->run(InitializeDataImpl(this, p, dims, bounds, m_InitType, m_InvertData, m_InitValue, m_InitRange));
 #else
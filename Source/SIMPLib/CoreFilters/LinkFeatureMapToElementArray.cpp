@@ -38,6 +38,7 @@
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/Algorithms/FeatureDataMapper.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -167,18 +168,13 @@ void LinkFeatureMapToElementArray::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
   size_t totalPoints = m_SelectedCellDataPtr.lock()->getNumberOfTuples();
 
-  int32_t maxIndex = 0;
-  std::vector<bool> active;
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    int32_t index = m_SelectedCellData[i];
-    if((index + 1) > maxIndex)
-    {
-      active.resize(index + 1);
-      active[index] = true;
-      maxIndex = index + 1;
-    }
-  }
+  FeatureDataMapper mapper(m_SelectedCellData, totalPoints);
+  int32_t maxIndex = mapper.findMaxFeatureId() + 1;
+
+  // A Feature is active if at least one element references it
+  std::vector<int64_t> firstElement;
+  std::vector<int64_t> lastElement;
+  mapper.findElementRanges(static_cast<size_t>(maxIndex), firstElement, lastElement);
 
   std::vector<size_t> tDims(1, maxIndex);
   m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
@@ -186,7 +182,7 @@ void LinkFeatureMapToElementArray::execute()
 
   for(int32_t i = 0; i < maxIndex; i++)
   {
-    m_Active[i] = active[i];
+    m_Active[i] = (lastElement[i] >= 0);
   }
 }
 
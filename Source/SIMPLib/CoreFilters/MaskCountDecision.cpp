@@ -35,6 +35,8 @@
 
 #include "MaskCountDecision.h"
 
+#include <algorithm>
+
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
 
@@ -61,6 +63,7 @@ void MaskCountDecision::setupFilterParameters()
 {
   FilterParameterVectorType parameters = getFilterParameters();
   DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+  req.daTypes.push_back(SIMPL::TypeNames::BitMaskArray);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::Category::RequiredArray, MaskCountDecision, req));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of True Instances", NumberOfTrues, FilterParameter::Category::Parameter, MaskCountDecision, {0}));
   setFilterParameters(parameters);
@@ -93,6 +96,19 @@ void MaskCountDecision::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
+  IDataArray::Pointer maskArray = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getMaskArrayPath());
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  // A packed mask is counted directly, anything else must be a single component bool array
+  m_BitMaskPtr = std::dynamic_pointer_cast<BitMaskArray>(maskArray);
+  if(nullptr != m_BitMaskPtr.lock())
+  {
+    return;
+  }
+
   std::vector<size_t> cDims(1, 1);
 
   m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getMaskArrayPath(), cDims);
@@ -113,34 +129,45 @@ void MaskCountDecision::execute()
     return;
   }
 
-  size_t numTuples = m_MaskPtr.lock()->getNumberOfTuples();
+  BitMaskArray::Pointer bitMask = m_BitMaskPtr.lock();
+  size_t numTuples = (nullptr != bitMask) ? bitMask->getNumberOfTuples() : m_MaskPtr.lock()->getNumberOfTuples();
 
-  int32_t trueCount = 0;
   bool dm = true;
 
   qDebug() << "NumberOfTrues: " << m_NumberOfTrues;
 
-  for(size_t i = 0; i < numTuples; i++)
+  if(m_NumberOfTrues > 0)
   {
-    if(m_NumberOfTrues < 0 && !m_Mask[i])
+    // Count the whole mask in one pass instead of testing the running total after every tuple
+    size_t trueCount = (nullptr != bitMask) ? bitMask->countTrue() : static_cast<size_t>(std::count(m_Mask, m_Mask + numTuples, true));
+    if(trueCount >= static_cast<size_t>(m_NumberOfTrues))
     {
-      qDebug() << "First if check: " << dm;
+      dm = false;
+      qDebug() << "Second if check: " << dm;
+
+      int32_t targetCount = m_NumberOfTrues;
       Q_EMIT decisionMade(dm);
+      Q_EMIT targetValue(targetCount);
       return;
     }
-    if(m_Mask[i])
-    {
-      trueCount++;
-    }
-    if(trueCount >= m_NumberOfTrues)
+  }
+  else if(numTuples > 0)
+  {
+    // With zero or a negative count the decision is made by the first tuple
+    bool firstValue = (nullptr != bitMask) ? bitMask->getValue(0) : m_Mask[0];
+    if(m_NumberOfTrues < 0 && !firstValue)
     {
-      dm = false;
-      qDebug() << "Second if check: " << dm;
-
+      qDebug() << "First if check: " << dm;
       Q_EMIT decisionMade(dm);
-      Q_EMIT targetValue(trueCount);
       return;
     }
+    dm = false;
+    qDebug() << "Second if check: " << dm;
+
+    int32_t targetCount = firstValue ? 1 : 0;
+    Q_EMIT decisionMade(dm);
+    Q_EMIT targetValue(targetCount);
+    return;
   }
 
   qDebug() << "Fell through: " << dm;
@@ -39,15 +39,17 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/ScalarTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ComparisonEvaluator.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -57,25 +59,10 @@ enum createdPathID : RenameDataPath::DataID_t
 namespace Detail
 {
 template <typename T>
-void initializeDestinationArray(const BoolArrayType& thresholdArray, IDataArray::Pointer iDestinationArray)
+void evaluateIntoDestinationArray(const ComparisonEvaluator& evaluator, IDataArray::Pointer iDestinationArray)
 {
   typename DataArray<T>::Pointer destinationArray = std::dynamic_pointer_cast<DataArray<T>>(iDestinationArray);
-  size_t thresholdSize = thresholdArray.getNumberOfTuples();
-  bool* threshold = thresholdArray.getPointer(0);
-  T* dest = destinationArray->getPointer(0);
-  for(int64_t p = 0; p < thresholdSize; p++)
-  {
-    if constexpr(std::is_same<T, bool>::value)
-    {
-      // Boolean case
-      dest[p] = threshold[p];
-    }
-    else
-    {
-      // Non-boolean case
-      dest[p] = (threshold[p] ? static_cast<T>(1) : static_cast<T>(0));
-    }
-  }
+  evaluator.evaluate(destinationArray->getPointer(0), destinationArray->getNumberOfTuples());
 }
 } // namespace Detail
 
@@ -107,6 +94,7 @@ void MultiThresholdObjects2::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_SCALARTYPE_FP("Output Scalar Type", ScalarType, FilterParameter::Category::Parameter, MultiThresholdObjects2));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store as Bit Mask", StoreAsBitMask, FilterParameter::Category::Parameter, MultiThresholdObjects2));
   parameters.push_back(SIMPL_NEW_DA_FROM_ADV_COMPARISON_FP("Output Attribute Array", DestinationArrayName, SelectedThresholds, FilterParameter::Category::CreatedArray, MultiThresholdObjects2));
   setFilterParameters(parameters);
 }
@@ -119,6 +107,7 @@ void MultiThresholdObjects2::readFilterParameters(AbstractFilterParametersReader
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
   setSelectedThresholds(reader->readComparisonInputsAdvanced("SelectedThresholds", getSelectedThresholds()));
+  setStoreAsBitMask(reader->readValue("StoreAsBitMask", getStoreAsBitMask()));
   reader->closeFilterGroup();
 }
 
@@ -165,7 +154,15 @@ void MultiThresholdObjects2::dataCheck()
     std::vector<size_t> cDims(1, 1);
     DataArrayPath tempPath(dcName, amName, getDestinationArrayName());
 
-    m_DestinationPtr = TemplateHelpers::CreateNonPrereqArrayFromTypeEnum()(this, tempPath, cDims, static_cast<int>(getScalarType()), 0, ThresholdArrayID);
+    if(m_StoreAsBitMask)
+    {
+      // One bit per tuple; the Output Scalar Type does not apply
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitMaskArray>(this, tempPath, false, cDims, "", ThresholdArrayID);
+    }
+    else
+    {
+      m_DestinationPtr = TemplateHelpers::CreateNonPrereqArrayFromTypeEnum()(this, tempPath, cDims, static_cast<int>(getScalarType()), 0, ThresholdArrayID);
+    }
     if(getErrorCode() < 0)
     {
       return;
@@ -227,257 +224,63 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  bool invert = m_SelectedThresholds.shouldInvert();
-
-  int64_t thresholdSize;
-  BoolArrayType::Pointer thresholdArray;
-
-  createBoolArray(thresholdSize, thresholdArray);
-  bool firstValueFound = false;
-
-  int32_t err = 0;
-
-  // Loop on the remaining Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
+  // Every comparison of the tree is evaluated in a single pass that writes straight into the destination array
+  ComparisonEvaluator evaluator;
+  if(evaluator.compile(m_SelectedThresholds, *m->getAttributeMatrix(amName)) < 0)
   {
-    if(std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-    {
-      ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-      thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-    {
-      ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-      thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
+    DataArrayPath tempPath(dcName, amName, evaluator.getInvalidArrayName());
+    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+    setErrorCondition(-13002, ss);
+    return;
   }
 
-  if(invert)
+  IDataArray::Pointer destinationArray = m_DestinationPtr.lock();
+  if(m_StoreAsBitMask)
   {
-    invertThreshold(thresholdSize, thresholdArray);
+    evaluator.evaluate(*std::dynamic_pointer_cast<BitMaskArray>(destinationArray));
+    return;
   }
-
   switch(m_ScalarType)
   {
   case SIMPL::ScalarTypes::Type::Int8:
-    Detail::initializeDestinationArray<int8_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<int8_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Int16:
-    Detail::initializeDestinationArray<int16_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<int16_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Int32:
-    Detail::initializeDestinationArray<int32_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<int32_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Int64:
-    Detail::initializeDestinationArray<int64_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<int64_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::UInt8:
-    Detail::initializeDestinationArray<uint8_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<uint8_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::UInt16:
-    Detail::initializeDestinationArray<uint16_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<uint16_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::UInt32:
-    Detail::initializeDestinationArray<uint32_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<uint32_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::UInt64:
-    Detail::initializeDestinationArray<uint64_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<uint64_t>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Float:
-    Detail::initializeDestinationArray<float>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<float>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Double:
-    Detail::initializeDestinationArray<double>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<double>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::Bool:
-    Detail::initializeDestinationArray<bool>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<bool>(evaluator, destinationArray);
     break;
   case SIMPL::ScalarTypes::Type::SizeT:
-    Detail::initializeDestinationArray<size_t>(*thresholdArray, m_DestinationPtr.lock());
+    Detail::evaluateIntoDestinationArray<size_t>(evaluator, destinationArray);
     break;
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if(SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonSet)
-  {
-    return;
-  }
-
-  if(inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for(int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if(std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    {
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if(std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if(err < 0)
-    {
-      return;
-    }
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  // bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()), currentArrayPtr.get());
-  if(err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002, ss);
-    return;
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -613,3 +416,15 @@ SIMPL::ScalarTypes::Type MultiThresholdObjects2::getScalarType() const
 {
   return m_ScalarType;
 }
+
+// -----------------------------------------------------------------------------
+void MultiThresholdObjects2::setStoreAsBitMask(bool value)
+{
+  m_StoreAsBitMask = value;
+}
+
+// -----------------------------------------------------------------------------
+bool MultiThresholdObjects2::getStoreAsBitMask() const
+{
+  return m_StoreAsBitMask;
+}
@@ -30,6 +30,8 @@
 
 #include "PadImageGeometry.h"
 
+#include <array>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -38,14 +40,11 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec2FilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/task_group.h>
-#endif
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -76,6 +75,10 @@ void PadImageGeometry::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
 
+  {
+    std::vector<QString> choices = {"Pad", "Crop"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Operation", Operation, FilterParameter::Category::Parameter, PadImageGeometry, choices, false));
+  }
   parameters.push_back(SIMPL_NEW_INT_VEC2_FP("X Min & Max Padding (in voxels)", XMinMax, FilterParameter::Category::Parameter, PadImageGeometry));
   parameters.push_back(SIMPL_NEW_INT_VEC2_FP("Y Min & Max Padding (in voxels)", YMinMax, FilterParameter::Category::Parameter, PadImageGeometry));
   parameters.push_back(SIMPL_NEW_INT_VEC2_FP("Z Min & Max Padding (in voxels)", ZMinMax, FilterParameter::Category::Parameter, PadImageGeometry));
@@ -154,17 +157,38 @@ void PadImageGeometry::dataCheck()
   m_OldAttrMatrix = attrMatrix;
   m_OldGeometry = imageGeom;
 
-  SizeVec3Type newDims = imageGeom->getDimensions();
-  newDims[0] += (m_XMinMax.getX() + m_XMinMax.getY());
-  newDims[1] += (m_YMinMax.getX() + m_YMinMax.getY());
-  newDims[2] += (m_ZMinMax.getX() + m_ZMinMax.getY());
+  SizeVec3Type oldDims = imageGeom->getDimensions();
+  if(m_Operation == Crop)
+  {
+    const std::array<IntVec2Type, 3> minMax = {m_XMinMax, m_YMinMax, m_ZMinMax};
+    const std::array<QString, 3> axisNames = {"X", "Y", "Z"};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(static_cast<size_t>(minMax[i].getX()) + static_cast<size_t>(minMax[i].getY()) >= oldDims[i])
+      {
+        QString ss = QObject::tr("%1 Min & Max: Cropping %2 voxels would remove all %3 voxels along the %1 axis.")
+                         .arg(axisNames[i])
+                         .arg(minMax[i].getX() + minMax[i].getY())
+                         .arg(oldDims[i]);
+        setErrorCondition(ErrorCodes::CROP_EXCEEDS_DIMENSIONS, ss);
+        return;
+      }
+    }
+  }
+
+  m_Box = createBox(oldDims);
+  SizeVec3Type newDims = m_Box.destDims;
 
+  // Cropping moves the first voxel in the opposite direction of padding. The origin is in physical
+  // units, so the voxel counts are scaled by the spacing.
+  const float originSign = (m_Operation == Crop) ? -1.0f : 1.0f;
   FloatVec3Type newOrigin = imageGeom->getOrigin();
   if(m_UpdateOrigin)
   {
-    newOrigin[0] -= m_XMinMax.getX();
-    newOrigin[1] -= m_YMinMax.getX();
-    newOrigin[2] -= m_ZMinMax.getX();
+    const FloatVec3Type spacing = imageGeom->getSpacing();
+    newOrigin[0] -= originSign * static_cast<float>(m_XMinMax.getX()) * spacing[0];
+    newOrigin[1] -= originSign * static_cast<float>(m_YMinMax.getX()) * spacing[1];
+    newOrigin[2] -= originSign * static_cast<float>(m_ZMinMax.getX()) * spacing[2];
   }
 
   ImageGeom::Pointer newGeometry = ImageGeom::CreateGeometry(imageGeom->getName());
@@ -203,24 +227,16 @@ void PadImageGeometry::execute()
   ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
   AttributeMatrix::Pointer attrMatrix = dc->getAttributeMatrix(m_AttributeMatrixPath.getAttributeMatrixName());
   QList<QString> voxelArrayNames = attrMatrix->getAttributeArrayNames();
-  IntVec3Type minPadding = {m_XMinMax[0], m_YMinMax[0], m_ZMinMax[0]};
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-#endif
 
+  // Each array is copied row-parallel by ImageBoxCopy, so the arrays themselves are processed one at a time
   for(const QString& name : voxelArrayNames)
   {
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    g->run(PadImageGeometryImpl(this, *m_OldAttrMatrix, *attrMatrix, name, m_DefaultFillValue, minPadding));
-#else
-    PadImageGeometryImpl(this, *m_OldAttrMatrix, *attrMatrix, name, m_DefaultFillValue, minPadding)();
-#endif
+    PadImageGeometryImpl(this, *m_OldAttrMatrix, *attrMatrix, name, m_DefaultFillValue, m_Box)();
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
   }
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  // This will spill over if the number of arrays to process does not divide evenly by the number of threads.
-  g->wait();
-#endif
 
   // Clean up old geometry and attribute matrix
   m_OldAttrMatrix.reset();
@@ -229,6 +245,18 @@ void PadImageGeometry::execute()
 
 // -----------------------------------------------------------------------------
 //
+// -----------------------------------------------------------------------------
+ImageBoxCopy::Box PadImageGeometry::createBox(const SizeVec3Type& oldDims) const
+{
+  SizeVec3Type minVoxels = {static_cast<size_t>(m_XMinMax.getX()), static_cast<size_t>(m_YMinMax.getX()), static_cast<size_t>(m_ZMinMax.getX())};
+  SizeVec3Type maxVoxels = {static_cast<size_t>(m_XMinMax.getY()), static_cast<size_t>(m_YMinMax.getY()), static_cast<size_t>(m_ZMinMax.getY())};
+  if(m_Operation == Crop)
+  {
+    return ImageBoxCopy::Crop(oldDims, minVoxels, maxVoxels);
+  }
+  return ImageBoxCopy::Pad(oldDims, minVoxels, maxVoxels);
+}
+
 // -----------------------------------------------------------------------------
 AbstractFilter::Pointer PadImageGeometry::newFilterInstance(bool copyFilterParameters) const
 {
@@ -388,6 +416,18 @@ bool PadImageGeometry::getUpdateOrigin() const
   return m_UpdateOrigin;
 }
 
+// -----------------------------------------------------------------------------
+void PadImageGeometry::setOperation(const int& value)
+{
+  m_Operation = value;
+}
+
+// -----------------------------------------------------------------------------
+int PadImageGeometry::getOperation() const
+{
+  return m_Operation;
+}
+
 // -----------------------------------------------------------------------------
 QString PadImageGeometry::getOldGeometryInformation()
 {
@@ -33,6 +33,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/ImageBoxCopy.hpp"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 /**
@@ -66,7 +67,18 @@ public:
     X_VALUES_NEGATIVE = -3000,
     Y_VALUES_NEGATIVE = -3001,
     Z_VALUES_NEGATIVE = -3002,
-    MISSING_IMG_GEOMETRY = -3003
+    MISSING_IMG_GEOMETRY = -3003,
+    CROP_EXCEEDS_DIMENSIONS = -3004
+  };
+
+  /**
+   * @brief The values of the Operation property. Pad adds the Min & Max voxels around the volume,
+   * Crop removes them from its sides.
+   */
+  enum OperationType
+  {
+    Pad = 0,
+    Crop = 1
   };
 
   /**
@@ -129,6 +141,18 @@ public:
   bool getUpdateOrigin() const;
   Q_PROPERTY(bool UpdateOrigin READ getUpdateOrigin WRITE setUpdateOrigin)
 
+  /**
+   * @brief Setter property for Operation
+   */
+  void setOperation(const int& value);
+
+  /**
+   * @brief Getter property for Operation
+   * @return Value of Operation
+   */
+  int getOperation() const;
+  Q_PROPERTY(int Operation READ getOperation WRITE setOperation)
+
   /**
    * @brief Getter property for OldGeometryInformation
    * @return Value of OldGeometryInformation
@@ -234,16 +258,24 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Returns the box that maps the old volume onto the padded or cropped volume
+   * @param oldDims
+   */
+  ImageBoxCopy::Box createBox(const SizeVec3Type& oldDims) const;
+
 private:
   IntVec2Type m_XMinMax = {0, 0};
   IntVec2Type m_YMinMax = {0, 0};
   IntVec2Type m_ZMinMax = {0, 0};
   int m_DefaultFillValue = 0;
   bool m_UpdateOrigin = {false};
+  int m_Operation = {Pad};
   DataArrayPath m_AttributeMatrixPath = {"", "", ""};
 
   AttributeMatrix::Pointer m_OldAttrMatrix = AttributeMatrix::NullPointer();
   ImageGeom::Pointer m_OldGeometry = ImageGeom::NullPointer();
+  ImageBoxCopy::Box m_Box;
 
 public:
   PadImageGeometry(const PadImageGeometry&) = delete;            // Copy Constructor Not Implemented
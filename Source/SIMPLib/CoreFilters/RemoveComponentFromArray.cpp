@@ -39,6 +39,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/ComponentCopy.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -177,79 +178,40 @@ void RemoveComponentFromArray::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void extractComponent(IDataArray::Pointer inputData, IDataArray::Pointer newData, IDataArray::Pointer reducedData, int compNumber)
+void removeComponent(IDataArray::Pointer inputData, IDataArray::Pointer newData, IDataArray::Pointer reducedData, int compNumber)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inputData);
   typename DataArray<T>::Pointer newArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(newData);
   typename DataArray<T>::Pointer reducedArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(reducedData);
 
-  if(nullptr == inputArrayPtr || nullptr == newArrayPtr)
+  if(nullptr == inputArrayPtr || nullptr == reducedArrayPtr)
   {
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
-  T* newArray = newArrayPtr->getPointer(0);
+  const T* inputArray = inputArrayPtr->getPointer(0);
   T* reducedArray = reducedArrayPtr->getPointer(0);
 
   size_t numPoints = inputArrayPtr->getNumberOfTuples();
   size_t numComps = inputArrayPtr->getNumberOfComponents();
+  size_t comp = static_cast<size_t>(compNumber);
 
-  for(size_t i = 0; i < numPoints; i++)
+  // The components before and after the removed one each become a single slice of the reduced array
+  std::vector<ComponentCopy::ComponentSlice<T>> slices;
+  if(comp > 0)
   {
-    for(size_t j = 0; j < numComps; j++)
-    {
-      if(j == compNumber)
-      {
-        newArray[i] = inputArray[numComps * i + j];
-      }
-      else if(j > compNumber)
-      {
-        reducedArray[(numComps - 1) * i + j - 1] = inputArray[numComps * i + j];
-      }
-      else if(j < compNumber)
-      {
-        reducedArray[(numComps - 1) * i + j] = inputArray[numComps * i + j];
-      }
-    }
+    slices.push_back({inputArray, numComps, reducedArray, numComps - 1, comp});
   }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void reduceArrayOnly(IDataArray::Pointer inputData, IDataArray::Pointer reducedData, int compNumber)
-{
-  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inputData);
-  typename DataArray<T>::Pointer reducedArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(reducedData);
-
-  if(nullptr == inputArrayPtr)
+  if(comp + 1 < numComps)
   {
-    return;
+    slices.push_back({inputArray + comp + 1, numComps, reducedArray + comp, numComps - 1, numComps - comp - 1});
   }
-
-  T* inputArray = inputArrayPtr->getPointer(0);
-  T* reducedArray = reducedArrayPtr->getPointer(0);
-
-  size_t numPoints = inputArrayPtr->getNumberOfTuples();
-  size_t numComps = inputArrayPtr->getNumberOfComponents();
-
-  for(size_t i = 0; i < numPoints; i++)
+  if(nullptr != newArrayPtr)
   {
-    for(size_t j = 0; j < numComps; j++)
-    {
-
-      if(j > compNumber)
-      {
-        reducedArray[(numComps - 1) * i + j - 1] = inputArray[numComps * i + j];
-      }
-      else if(j < compNumber)
-      {
-        reducedArray[(numComps - 1) * i + j] = inputArray[numComps * i + j];
-      }
-    }
+    slices.push_back({inputArray + comp, numComps, newArrayPtr->getPointer(0), 1, 1});
   }
+
+  ComponentCopy::CopyComponents(slices, numPoints);
 }
 
 // -----------------------------------------------------------------------------
@@ -263,14 +225,8 @@ void RemoveComponentFromArray::execute()
     return;
   }
 
-  if(m_SaveRemovedComponent)
-  {
-    EXECUTE_FUNCTION_TEMPLATE(this, extractComponent, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_NewArrayPtr.lock(), m_ReducedArrayPtr.lock(), m_CompNumber)
-  }
-  else if(!m_SaveRemovedComponent)
-  {
-    EXECUTE_FUNCTION_TEMPLATE(this, reduceArrayOnly, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_ReducedArrayPtr.lock(), m_CompNumber)
-  }
+  IDataArray::Pointer newArray = m_SaveRemovedComponent ? m_NewArrayPtr.lock() : IDataArray::NullPointer();
+  EXECUTE_FUNCTION_TEMPLATE(this, removeComponent, m_InArrayPtr.lock(), m_InArrayPtr.lock(), newArray, m_ReducedArrayPtr.lock(), m_CompNumber)
 }
 
 // -----------------------------------------------------------------------------
@@ -39,6 +39,7 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/CoreFilters/Algorithms/ArrayTransformKernels.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -137,16 +138,13 @@ void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, double
   T removeVal = static_cast<T>(removeValue);
   T replaceVal = static_cast<T>(replaceValue);
 
-  T* inData = inputArrayPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
-
-  for(size_t iter = 0; iter < numTuples; iter++)
+  if(numTuples == 0)
   {
-    if(inData[iter] == removeVal)
-    {
-      inData[iter] = replaceVal;
-    }
+    return;
   }
+
+  ArrayTransformKernels::Replace<T>(inputArrayPtr->getPointer(0), numTuples, removeVal, replaceVal);
 }
 
 // -----------------------------------------------------------------------------
@@ -39,7 +39,6 @@
 #include <chrono>
 #include <cmath>
 #include <iostream>
-#include <thread>
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range3d.h>
@@ -64,10 +63,7 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/task_group.h>
-#endif
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 namespace ImageRotationUtilities
 {
@@ -339,13 +335,6 @@ struct RotateSampleRefFrame::Impl
   }
 };
 
-namespace RotateSampleRefFrameProgress
-{
-static size_t s_InstanceIndex = 0;
-static std::map<size_t, int64_t> s_ProgressValues;
-static std::map<size_t, int64_t> s_LastProgressInt;
-} // namespace RotateSampleRefFrameProgress
-
 using Vector3s = Eigen::Array<size_t, 1, 3>;
 using Vector3i64 = Eigen::Array<int64_t, 1, 3>;
 
@@ -356,13 +345,14 @@ class RotateSampleRefFrameImpl
 {
 public:
   RotateSampleRefFrameImpl(RotateSampleRefFrame* filter, IDataArray::Pointer& sourceArray, IDataArray::Pointer& targetArray, const ImageRotationUtilities::RotateArgs& args,
-                           const Matrix4fR& rotationMatrix, bool sliceBySlice)
+                           const Matrix4fR& rotationMatrix, bool sliceBySlice, ProgressTracker* progress)
   : m_Filter(filter)
   , m_SourceArray(sourceArray)
   , m_TargetArray(targetArray)
   , m_SliceBySlice(sliceBySlice)
   , m_Params(args)
   , m_TransformationMatrix(rotationMatrix)
+  , m_Progress(progress)
   {
   }
 
@@ -391,7 +381,6 @@ public:
       }
       int64_t ktot = (m_Params.xpNew * m_Params.ypNew) * k;
 
-      m_Filter->sendThreadSafeProgressMessage(QString("%1: Copying values for slice '%2/%3'").arg(m_SourceArray->getName()).arg(k).arg(m_Params.zpNew));
       for(int64_t j = 0; j < m_Params.ypNew; j++)
       {
         int64_t jtot = (m_Params.xpNew) * j;
@@ -432,6 +421,7 @@ public:
           }
         }
       }
+      m_Progress->increment(1);
     }
 
     m_SourceArray->resizeTuples(0);
@@ -451,6 +441,7 @@ private:
   bool m_SliceBySlice = false;
   ImageRotationUtilities::RotateArgs m_Params;
   Matrix4fR m_TransformationMatrix;
+  ProgressTracker* m_Progress = nullptr;
 };
 
 // -----------------------------------------------------------------------------
@@ -721,21 +712,12 @@ void RotateSampleRefFrame::execute()
 
   QList<QString> voxelArrayNames = targetAttributeMatrix->getAttributeArrayNames();
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-  // C++11 RIGHT HERE....
-  int32_t nthreads = static_cast<int32_t>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
-  int32_t threadCount = 0;
-#endif
+  // Each array is one unit of the overall progress and reports its slices through a child tracker
+  ProgressTracker progress(voxelArrayNames.size(), [this](int32_t percent) { notifyStatusMessage(QObject::tr("Transforming || %1% Completed").arg(percent)); });
 
+  ParallelTaskAlgorithm taskAlg;
   for(const auto& attrArrayName : voxelArrayNames)
   {
-    // Needed for Threaded Progress Messages
-    m_InstanceIndex = ++RotateSampleRefFrameProgress::s_InstanceIndex;
-    RotateSampleRefFrameProgress::s_ProgressValues[m_InstanceIndex] = 0;
-    RotateSampleRefFrameProgress::s_LastProgressInt[m_InstanceIndex] = 0;
-    m_TotalElements = newNumCellTuples;
-
     //    auto start = std::chrono::steady_clock::now();
     notifyStatusMessage(QString("Rotating DataArray '%1'").arg(attrArrayName));
     IDataArray::Pointer sourceArray = m_SourceAttributeMatrix->getAttributeArray(attrArrayName);
@@ -745,59 +727,21 @@ void RotateSampleRefFrame::execute()
     targetArray->resizeTuples(1);                // Allocate the memory for this data array
     targetArray->resizeTuples(newNumCellTuples); // Allocate the memory for this data array
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    g->run(RotateSampleRefFrameImpl(this, sourceArray, targetArray, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice));
-    threadCount++;
-    if(threadCount == nthreads)
-    {
-      g->wait();
-      threadCount = 0;
-    }
-#else
-    RotateSampleRefFrameImpl impl(this, sourceArray, targetArray, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice);
-    impl();
-#endif
+    ProgressTracker* arrayProgress = progress.createChild(p_Impl->m_Params.zpNew, 1);
+    taskAlg.execute(RotateSampleRefFrameImpl(this, sourceArray, targetArray, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice, arrayProgress));
   }
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
-  g->wait();
-#endif
-}
-
-// -----------------------------------------------------------------------------
-void RotateSampleRefFrame::sendThreadSafeProgressMessage(int64_t counter)
-{
-  std::lock_guard<std::mutex> guard(m_ProgressMessage_Mutex);
-
-  int64_t& progCounter = RotateSampleRefFrameProgress::s_ProgressValues[m_InstanceIndex];
-  progCounter += counter;
-  int64_t progressInt = static_cast<int64_t>((static_cast<float>(progCounter) / m_TotalElements) * 100.0f);
-
-  int64_t progIncrement = m_TotalElements / 100;
-  int64_t prog = 1;
-
-  int64_t& lastProgressInt = RotateSampleRefFrameProgress::s_LastProgressInt[m_InstanceIndex];
-
-  if(progCounter > prog && lastProgressInt != progressInt)
-  {
-    QString ss = QObject::tr("Transforming || %1% Completed").arg(progressInt);
-    notifyStatusMessage(ss);
-    prog += progIncrement;
-  }
+  taskAlg.wait();
 
-  lastProgressInt = progressInt;
+  progress.flush();
 }
 
 // -----------------------------------------------------------------------------
 void RotateSampleRefFrame::sendThreadSafeProgressMessage(const QString& message)
 {
-  static std::mutex mutex;
-  std::lock_guard<std::mutex> lock(mutex);
-  qint64 currentMillis = QDateTime::currentMSecsSinceEpoch();
-  if(currentMillis - m_Millis > 1000)
+  if(m_MessageRateLimiter.tryAcquire())
   {
     notifyStatusMessage(message);
-    m_Millis = QDateTime::currentMSecsSinceEpoch();
   }
 }
 
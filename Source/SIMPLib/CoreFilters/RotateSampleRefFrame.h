@@ -37,7 +37,6 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
@@ -45,8 +44,8 @@
 #include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
 
-#include <QtCore/QDateTime>
 
 /**
  * @brief The RotateSampleRefFrame class. See [Filter documentation](@ref rotatesamplerefframe) for details.
@@ -271,11 +270,10 @@ public:
   void execute() override;
 
   /**
-   * @brief sendThreadSafeProgressMessage
-   * @param counter
+   * @brief Emits the message as a status message unless another message was emitted within
+   * the last second.  This function does not lock and can be called from any thread.
+   * @param message
    */
-  void sendThreadSafeProgressMessage(int64_t counter);
-
   void sendThreadSafeProgressMessage(const QString& message);
 
 protected:
@@ -311,10 +309,7 @@ private:
   AttributeMatrix::Pointer m_SourceAttributeMatrix;
 
   // Threadsafe Progress Message
-  mutable std::mutex m_ProgressMessage_Mutex;
-  size_t m_InstanceIndex = {0};
-  int64_t m_TotalElements = {};
-  qint64 m_Millis = QDateTime::currentMSecsSinceEpoch();
+  ProgressRateLimiter m_MessageRateLimiter{std::chrono::milliseconds(1000)};
 
   /**
    * @brief This is an alternate version of the execute that attempted to parallelize over each DataArray. Turns out this was
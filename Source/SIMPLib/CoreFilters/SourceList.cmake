@@ -220,6 +220,8 @@ ADD_SIMPL_SUPPORT_SOURCE(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/util FloorOpe
 ADD_SIMPL_SUPPORT_HEADER(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/util CeilOperator.h)
 ADD_SIMPL_SUPPORT_SOURCE(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/util CeilOperator.cpp)
 
+ADD_SIMPL_SUPPORT_HEADER(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/Algorithms ArrayTransformKernels.hpp)
+ADD_SIMPL_SUPPORT_CLASS(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/Algorithms FeatureDataMapper)
 ADD_SIMPL_SUPPORT_CLASS(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/Algorithms InitializeDataImpl)
 ADD_SIMPL_SUPPORT_CLASS(${SIMPLib_SOURCE_DIR} ${_filterGroupName}/Algorithms PadImageGeometryImpl)
 
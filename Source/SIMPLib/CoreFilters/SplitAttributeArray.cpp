@@ -40,6 +40,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -123,6 +124,28 @@ void SplitAttributeArray::dataCheck()
 
     std::vector<size_t> cDims(1, 1);
 
+    if(!getInPreflight())
+    {
+      // During execute the split arrays are zero-copy views of the input components that execute()
+      // inserts, so only make sure that they can be inserted.
+      AttributeMatrix::Pointer attrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, getInputArrayPath(), -11002);
+      if(getErrorCode() < 0)
+      {
+        return;
+      }
+      for(int32_t i = 0; i < numComps; i++)
+      {
+        QString arrayName = getInputArrayPath().getDataArrayName() + getSplitArraysSuffix() + QString::number(i);
+        if(attrMat->doesAttributeArrayExist(arrayName))
+        {
+          QString ss = QObject::tr("AttributeMatrix:'%1' An Attribute Array already exists with the name %2.").arg(attrMat->getName()).arg(arrayName);
+          setErrorCondition(-10002, ss);
+          return;
+        }
+      }
+      return;
+    }
+
     for(int32_t i = 0; i < numComps; i++)
     {
       QString arrayName = getInputArrayPath().getDataArrayName() + getSplitArraysSuffix() + QString::number(i);
@@ -151,28 +174,25 @@ void SplitAttributeArray::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void splitMulticomponentArray(IDataArray::Pointer inputArray, std::vector<IDataArray::Pointer>& splitArrays)
+void splitMulticomponentArray(IDataArray::Pointer inputArray, const AttributeMatrix::Pointer& attrMat, const QString& suffix, std::vector<IDataArray::Pointer>& splitArrays)
 {
   typename DataArray<T>::Pointer inputPtr = std::dynamic_pointer_cast<DataArray<T>>(inputArray);
-  T* iPtr = inputPtr->getPointer(0);
-  std::vector<T*> downcastPtrs;
-
-  for(auto&& ptr : splitArrays)
+  if(nullptr == inputPtr)
   {
-    auto tmp = std::dynamic_pointer_cast<DataArray<T>>(ptr);
-    T* tmpPtr = tmp->getPointer(0);
-    downcastPtrs.push_back(tmpPtr);
+    return;
   }
 
-  size_t numTuples = inputPtr->getNumberOfTuples();
-  int32_t numComps = inputPtr->getNumberOfComponents();
-
-  for(size_t i = 0; i < numTuples; i++)
+  size_t numComps = static_cast<size_t>(inputPtr->getNumberOfComponents());
+  for(size_t j = 0; j < numComps; j++)
   {
-    for(int32_t j = 0; j < numComps; j++)
+    QString arrayName = inputPtr->getName() + suffix + QString::number(j);
+    typename StridedDataArrayView<T>::Pointer view = StridedDataArrayView<T>::Create(inputPtr, j, 1, arrayName);
+    if(nullptr == view)
     {
-      downcastPtrs[j][i] = iPtr[numComps * i + j];
+      return;
     }
+    attrMat->insertOrAssign(view);
+    splitArrays.push_back(view);
   }
 }
 
@@ -187,7 +207,16 @@ void SplitAttributeArray::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, splitMulticomponentArray, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), m_SplitArraysPtrVector)
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getInputArrayPath());
+  EXECUTE_FUNCTION_TEMPLATE(this, splitMulticomponentArray, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), attrMat, getSplitArraysSuffix(), m_SplitArraysPtrVector)
+
+  if(m_SplitArraysPtrVector.size() != static_cast<size_t>(m_InputArrayPtr.lock()->getNumberOfComponents()))
+  {
+    QString ss = QObject::tr("The number of created arrays %1 does not match the number of components %2")
+                     .arg(m_SplitArraysPtrVector.size())
+                     .arg(m_InputArrayPtr.lock()->getNumberOfComponents());
+    setErrorCondition(-11001, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -37,6 +37,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "SIMPLib/SIMPLib.h"
@@ -571,6 +572,35 @@ public:
     TestConversion<double, bool>(filter, "DataArray", SIMPL::NumericTypes::Type::Bool, "NewArrayBool", 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFloatToIntClamping()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(SIMPL::NumericTypes::Type::Float);
+    AttributeMatrix::Pointer am = dca->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+    FloatArrayType::Pointer dataArray = getDataArray<float>(am, "DataArray");
+    DREAM3D_REQUIRE(nullptr != dataArray.get());
+    dataArray->setValue(0, 1000.0f);
+    dataArray->setValue(1, -1000.0f);
+    dataArray->setValue(2, std::numeric_limits<float>::quiet_NaN());
+    dataArray->setValue(3, -12.75f);
+
+    ConvertData::Pointer filter = createFilter();
+    filter->setDataContainerArray(dca);
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::Int8, "NewArrayChar");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+
+    Int8ArrayType::Pointer convertedDataArray = getDataArray<int8_t>(am, "NewArrayChar");
+    DREAM3D_REQUIRE(nullptr != convertedDataArray.get());
+    // Out of range values clamp to the destination limits, NaN becomes zero and in range values truncate
+    DREAM3D_REQUIRE_EQUAL(convertedDataArray->getValue(0), std::numeric_limits<int8_t>::max());
+    DREAM3D_REQUIRE_EQUAL(convertedDataArray->getValue(1), std::numeric_limits<int8_t>::lowest());
+    DREAM3D_REQUIRE_EQUAL(convertedDataArray->getValue(2), 0);
+    DREAM3D_REQUIRE_EQUAL(convertedDataArray->getValue(3), -12);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -638,6 +668,8 @@ public:
     DREAM3D_REGISTER_TEST(TestUInt64Signed());
     DREAM3D_REGISTER_TEST(TestUInt64Unsigned());
 
+    DREAM3D_REGISTER_TEST(TestFloatToIntClamping());
+
     DREAM3D_REGISTER_TEST(TestFloat());
     DREAM3D_REGISTER_TEST(TestDouble());
 
@@ -157,6 +157,16 @@ public:
         DREAM3D_REQUIRE_EQUAL(propWasSet, true)
 
         createFeatureArrayFromElementArrayFilter->execute();
+        DREAM3D_REQUIRE_EQUAL(createFeatureArrayFromElementArrayFilter->getWarningCode(), -1000)
+
+        // Each Feature holds the value of its last element and Feature 0 has no elements
+        FloatArrayType::Pointer createdArray = featureAttr->getAttributeArrayAs<FloatArrayType>(createdName);
+        DREAM3D_REQUIRE_VALID_POINTER(createdArray.get())
+        DREAM3D_REQUIRE_EQUAL(createdArray->getValue(0), 0.0f)
+        DREAM3D_REQUIRE_EQUAL(createdArray->getValue(1), cellDataArray->getValue(5))
+        DREAM3D_REQUIRE_EQUAL(createdArray->getValue(2), cellDataArray->getValue(7))
+        DREAM3D_REQUIRE_EQUAL(createdArray->getValue(3), cellDataArray->getValue(13))
+        DREAM3D_REQUIRE_EQUAL(createdArray->getValue(4), cellDataArray->getValue(15))
       }
       else
       {
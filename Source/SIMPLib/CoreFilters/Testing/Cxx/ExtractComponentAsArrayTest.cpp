@@ -36,6 +36,7 @@
 #include "SIMPLib/CoreFilters/ExtractComponentAsArray.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -133,8 +134,20 @@ public:
     DataArray<int>::Pointer da = std::dynamic_pointer_cast<DataArray<int>>(am->getAttributeArray("DataArray"));
     DREAM3D_REQUIRE(nullptr != da.get());
 
-    DataArray<int>::Pointer copiedArray = std::dynamic_pointer_cast<DataArray<int>>(am->getAttributeArray(newArrayName));
+    // The filter stores a zero-copy view of the component
+    StridedDataArrayView<int>::Pointer view = std::dynamic_pointer_cast<StridedDataArrayView<int>>(am->getAttributeArray(newArrayName));
+    DREAM3D_REQUIRE(nullptr != view.get());
+    DREAM3D_REQUIRE(view->getBaseArray() == da);
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfComponents(), 1);
+    for(size_t i = 0; i < da->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(da->getComponent(i, component), view->getComponent(i, 0));
+    }
+
+    // Asking for the typed array materializes the view in place
+    DataArray<int>::Pointer copiedArray = am->getAttributeArrayAs<DataArray<int>>(newArrayName);
     DREAM3D_REQUIRE(nullptr != copiedArray.get());
+    DREAM3D_REQUIRE(am->getAttributeArray(newArrayName) == copiedArray);
 
     for(size_t i = 0; i < da->getNumberOfTuples(); i++)
     {
@@ -487,6 +487,25 @@ public:
     validateDerivativeValues(quad, faceOutPath_Q, derivativeName);
     FDTEST_SET_PROPERTIES_AND_CHECK_EQ(filter, tet, facePathD_Tet, cellOutPath_Tet, data);
     validateDerivativeValues(tet, cellOutPath_Tet, derivativeName);
+
+    // Succeed with single precision output
+    propWasSet = filter->setProperty("UseFloatOutput", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    DataArrayPath floatOutPath_I("ImageDC", "AttrMatType3", "FloatDerivatives");
+    var.setValue(fltPath_I);
+    filter->setProperty("SelectedArrayPath", var);
+    var.setValue(floatOutPath_I);
+    filter->setProperty("DerivativesArrayPath", var);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    FloatArrayType::Pointer floatDerivs = image->getAttributeMatrix(floatOutPath_I.getAttributeMatrixName())->getAttributeArrayAs<FloatArrayType>(floatOutPath_I.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(floatDerivs.get())
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(floatDerivs->getNumberOfComponents()), 3 * cDims[0])
+    for(size_t i = 0; i < floatDerivs->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(floatDerivs->getValue(i), 0.0f);
+    }
+    filter->setProperty("UseFloatOutput", false);
   }
 
   // -----------------------------------------------------------------------------
@@ -541,6 +560,36 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestUnsupportedDerivativeTypes()
+  {
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(3, 3, 3));
+    std::vector<size_t> cDims(1, 1);
+    FloatArrayType::Pointer field = FloatArrayType::CreateArray(27, cDims, "Field", true);
+    field->initializeWithValue(1.0f);
+    std::vector<size_t> derivDims(1, 3);
+    Int32ArrayType::Pointer intDerivs = Int32ArrayType::CreateArray(27, derivDims, "Derivatives", true);
+    DoubleArrayType::Pointer doubleField = DoubleArrayType::CreateArray(27, cDims, "Field", true);
+    doubleField->initializeWithValue(1.0);
+    DoubleArrayType::Pointer doubleDerivs = DoubleArrayType::CreateArray(27, derivDims, "Derivatives", true);
+    doubleDerivs->initializeWithValue(5.0);
+
+    DREAM3D_REQUIRED(image->findDerivatives(field, intDerivs, nullptr), <, 0)
+
+    // The IGeometry default only accepts double arrays
+    DREAM3D_REQUIRED(image->IGeometry::findDerivatives(field, doubleDerivs, nullptr), <, 0)
+    DREAM3D_REQUIRE_EQUAL(image->IGeometry::findDerivatives(doubleField, doubleDerivs, nullptr), 0)
+    for(size_t i = 0; i < doubleDerivs->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(doubleDerivs->getValue(i), 0.0)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //  Use test framework
   // -----------------------------------------------------------------------------
@@ -552,6 +601,7 @@ public:
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(TestFindDerivatives());
+    DREAM3D_REGISTER_TEST(TestUnsupportedDerivativeTypes());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
@@ -41,6 +41,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
@@ -74,6 +75,7 @@ bool dataArrayEqual(const T& a, const T& b)
 class GenerateTiltSeriesTest
 {
   const DataArrayPath k_CellDataArray = DataArrayPath("SyntheticVolumeDataContainer", "CellData", "FeatureIds");
+  const DataArrayPath k_ProjectionArray = DataArrayPath("ProjectionVolume", "CellData", "Density");
   const QString k_RotationBaseString = QString("Rotation_%1_%2");
   const QString k_FeatureIdsName = QString("FeatureIds");
   const QString k_SliceDataName = QString("Slice Data");
@@ -167,6 +169,86 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createProjectionVolume()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_ProjectionArray.getDataContainerName());
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(SizeVec3Type(10, 20, 30));
+    imageGeom->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    imageGeom->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(imageGeom);
+    dca->addOrReplaceDataContainer(dc);
+
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New({10, 20, 30}, k_ProjectionArray.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+    FloatArrayType::Pointer density = FloatArrayType::CreateArray(cellAttrMat->getNumberOfTuples(), {1}, k_ProjectionArray.getDataArrayName(), true);
+    density->initializeWithValue(1.0f);
+    cellAttrMat->insertOrAssign(density);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestProjections()
+  {
+    // The X axis grid is 10 x 37 pixels; pixel (5, 18) looks through the center of the volume. At 0 degrees
+    // the beam crosses the 30 voxels along Z and at 90 degrees the 20 voxels along Y.
+    const size_t centerPixel = 18 * 10 + 5;
+    const std::array<float, 2> pathLengths = {30.0f, 20.0f};
+
+    for(bool trilinear : {false, true})
+    {
+      for(int mode : {GenerateTiltSeries::k_SumProjection, GenerateTiltSeries::k_MaximumProjection})
+      {
+        DataContainerArray::Pointer dca = createProjectionVolume();
+
+        GenerateTiltSeries::Pointer generateTiltSeries = GenerateTiltSeries::New();
+        generateTiltSeries->setDataContainerArray(dca);
+        generateTiltSeries->setRotationAxis(GenerateTiltSeries::k_XAxis);
+        generateTiltSeries->setRotationLimits(FloatVec3Type(0.0f, 91.0f, 90.0f));
+        generateTiltSeries->setSpacing(FloatVec3Type(1.0f, 1.0f, 0.5f));
+        generateTiltSeries->setInputDataArrayPath(k_ProjectionArray);
+        generateTiltSeries->setOutputPrefix("Projection_");
+        generateTiltSeries->setProjectionMode(mode);
+        generateTiltSeries->setUseTrilinearInterpolation(trilinear);
+        generateTiltSeries->execute();
+        int err = generateTiltSeries->getErrorCode();
+        DREAM3D_REQUIRED(err, >=, 0)
+
+        for(size_t i = 0; i < pathLengths.size(); i++)
+        {
+          DataArrayPath projectionPath(QString("Projection_%1").arg(i), k_SliceDataName, k_ProjectionArray.getDataArrayName());
+          FloatArrayType::Pointer projection = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, projectionPath);
+          DREAM3D_REQUIRE_VALID_POINTER(projection)
+          DREAM3D_REQUIRE_EQUAL(projection->getNumberOfTuples(), 370)
+
+          float expected = (mode == GenerateTiltSeries::k_SumProjection) ? pathLengths[i] : 1.0f;
+          DREAM3D_REQUIRE(std::abs(projection->getValue(centerPixel) - expected) < 1.0f)
+          // The first pixel of the row lies outside of the volume at 0 degrees
+          if(i == 0)
+          {
+            DREAM3D_REQUIRE_EQUAL(projection->getValue(0), 0.0f)
+          }
+        }
+      }
+    }
+
+    GenerateTiltSeries::Pointer generateTiltSeries = GenerateTiltSeries::New();
+    generateTiltSeries->setDataContainerArray(createProjectionVolume());
+    generateTiltSeries->setInputDataArrayPath(k_ProjectionArray);
+    generateTiltSeries->setSpacing(FloatVec3Type(1.0f, 1.0f, 0.0f));
+    generateTiltSeries->setProjectionMode(GenerateTiltSeries::k_SumProjection);
+    generateTiltSeries->preflight();
+    DREAM3D_REQUIRE_EQUAL(generateTiltSeries->getErrorCode(), -3001)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -175,6 +257,7 @@ public:
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestGenerateTiltSeriesTest())
+    DREAM3D_REGISTER_TEST(TestProjections())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -38,6 +38,7 @@
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -352,6 +353,95 @@ public:
     compSet->setInvertComparison(true);
     ComparisonSetTest(filter, compSet, SIMPL::GeneralData::ThresholdArray + QString::number(3), expectedOutput);
 
+    // Nested, inverted set merged into a set whose first clause is all false for most values:
+    // (x == 3) OR NOT(x > 4 AND x < 15) AND (x != 0)
+    ComparisonSet::Pointer outerSet = ComparisonSet::New();
+    ComparisonValue::Pointer comp3 = ComparisonValue::New();
+    comp3->setAttributeArrayName(path.getDataArrayName());
+    comp3->setCompOperator(SIMPL::Comparison::Operator_Equal);
+    comp3->setCompValue(3);
+    outerSet->addComparison(comp3);
+
+    ComparisonSet::Pointer innerSet = ComparisonSet::New();
+    innerSet->setUnionOperator(SIMPL::Union::Operator_Or);
+    innerSet->setInvertComparison(true);
+    ComparisonValue::Pointer comp4 = ComparisonValue::New();
+    comp4->setAttributeArrayName(path.getDataArrayName());
+    comp4->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp4->setCompValue(4);
+    innerSet->addComparison(comp4);
+    ComparisonValue::Pointer comp5 = ComparisonValue::New();
+    comp5->setUnionOperator(SIMPL::Union::Operator_And);
+    comp5->setAttributeArrayName(path.getDataArrayName());
+    comp5->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp5->setCompValue(15);
+    innerSet->addComparison(comp5);
+    outerSet->addComparison(innerSet);
+
+    ComparisonValue::Pointer comp6 = ComparisonValue::New();
+    comp6->setUnionOperator(SIMPL::Union::Operator_And);
+    comp6->setAttributeArrayName(path.getDataArrayName());
+    comp6->setCompOperator(SIMPL::Comparison::Operator_NotEqual);
+    comp6->setCompValue(0);
+    outerSet->addComparison(comp6);
+
+    bool expectedOutput3[20];
+    for(int i = 0; i < 20; i++)
+    {
+      expectedOutput3[i] = ((i == 3) || !(i > 4 && i < 15)) && (i != 0);
+    }
+    ComparisonSetTest(filter, outerSet, SIMPL::GeneralData::ThresholdArray + QString::number(4), expectedOutput3);
+
+    return 1;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunBitMaskTest()
+  {
+    AbstractFilter::Pointer filter = CreateFilter();
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+
+    ComparisonValue::Pointer comp0 = ComparisonValue::New();
+    comp0->setAttributeArrayName("TestArrayInt");
+    comp0->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp0->setCompValue(4);
+    ComparisonValue::Pointer comp1 = ComparisonValue::New();
+    comp1->setUnionOperator(SIMPL::Union::Operator_And);
+    comp1->setAttributeArrayName("TestArrayInt");
+    comp1->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp1->setCompValue(15);
+
+    ComparisonInputsAdvanced comp;
+    comp.setDataContainerName("dc");
+    comp.setAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName);
+    comp.addInput(comp0);
+    comp.addInput(comp1);
+
+    QVariant var;
+    var.setValue(comp);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedThresholds", var), true)
+    var.setValue(QString("BitMask"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("DestinationArrayName", var), true)
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("StoreAsBitMask", var), true)
+
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    DataArrayPath path("dc", SIMPL::Defaults::CellAttributeMatrixName, "BitMask");
+    BitMaskArray::Pointer mask = dca->getAttributeMatrix(path)->getAttributeArrayAs<BitMaskArray>(path.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 20)
+    for(size_t i = 0; i < 20; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), (i > 4 && i < 15))
+    }
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 10)
+
     return 1;
   }
 
@@ -364,6 +454,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(RunComparisonValueTests())
     DREAM3D_REGISTER_TEST(RunComparisonSetTests())
+    DREAM3D_REGISTER_TEST(RunBitMaskTest())
   }
 
 private:
@@ -78,7 +78,7 @@ public:
 
   // -----------------------------------------------------------------------------
   template <typename T, size_t N>
-  DataContainerArray::Pointer createDataStructure(T arrayInitValue, const FloatVec3Type& origin)
+  DataContainerArray::Pointer createDataStructure(T arrayInitValue, const FloatVec3Type& origin, const FloatVec3Type& spacing = {1, 1, 1})
   {
     DataContainerArray::Pointer dca = DataContainerArray::New();
 
@@ -87,7 +87,7 @@ public:
     imageGeom->setName(k_ImageGeomName);
     imageGeom->setDimensions(k_TupleDims);
     imageGeom->setOrigin(origin);
-    imageGeom->setSpacing({1, 1, 1});
+    imageGeom->setSpacing(spacing);
     dc->setGeometry(imageGeom);
     dca->addOrReplaceDataContainer(dc);
 
@@ -473,6 +473,122 @@ public:
     executeInvalid_WrongGeometry_TestPrimitives<bool>({2, 2}, {2, 2}, {2, 2}, true, 0, false);
   }
 
+  // -----------------------------------------------------------------------------
+  // execute_ramp: Pads or crops a 2 component ramp and checks that every voxel landed in the right place
+  void execute_ramp(int operation, const IntVec2Type& xMinMax, const IntVec2Type& yMinMax, const IntVec2Type& zMinMax, int arrayPaddingValue, bool updateOrigin,
+                    const FloatVec3Type& spacing = {1, 1, 1})
+  {
+    const FloatVec3Type origin = {1.0f, 2.0f, 3.0f};
+    DataContainerArray::Pointer dca = createDataStructure<int32_t, 2>(0, origin, spacing);
+    {
+      Int32ArrayType::Pointer ramp = dca->getDataContainer(k_DataArrayPath.getDataContainerName())
+                                         ->getAttributeMatrix(k_DataArrayPath.getAttributeMatrixName())
+                                         ->getAttributeArrayAs<Int32ArrayType>(k_DataArrayPath.getDataArrayName());
+      for(size_t i = 0; i < ramp->getSize(); i++)
+      {
+        ramp->setValue(i, static_cast<int32_t>(i));
+      }
+    }
+
+    PadImageGeometry::Pointer filter = PadImageGeometry::New();
+    filter->setDataContainerArray(dca);
+    filter->setAttributeMatrixPath(k_DataArrayPath);
+    filter->setOperation(operation);
+    filter->setXMinMax(xMinMax);
+    filter->setYMinMax(yMinMax);
+    filter->setZMinMax(zMinMax);
+    filter->setDefaultFillValue(arrayPaddingValue);
+    filter->setUpdateOrigin(updateOrigin);
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    // Signed voxel offset of the new volume's first voxel relative to the old one
+    const int sign = (operation == PadImageGeometry::Crop) ? 1 : -1;
+    const std::array<int, 3> shift = {sign * xMinMax[0], sign * yMinMax[0], sign * zMinMax[0]};
+    const std::array<int, 3> change = {-sign * (xMinMax[0] + xMinMax[1]), -sign * (yMinMax[0] + yMinMax[1]), -sign * (zMinMax[0] + zMinMax[1])};
+
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataArrayPath.getDataContainerName());
+    ImageGeom::Pointer geom = dc->getGeometryAs<ImageGeom>();
+    SizeVec3Type newDims = geom->getDimensions();
+    for(size_t i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(static_cast<int>(newDims[i]), static_cast<int>(k_TupleDims[i]) + change[i])
+    }
+
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(k_DataArrayPath.getAttributeMatrixName());
+    Int32ArrayType::Pointer da = am->getAttributeArrayAs<Int32ArrayType>(k_DataArrayPath.getDataArrayName());
+    DREAM3D_REQUIRE_EQUAL(da->getNumberOfTuples(), newDims[0] * newDims[1] * newDims[2])
+    for(size_t z = 0; z < newDims[2]; z++)
+    {
+      for(size_t y = 0; y < newDims[1]; y++)
+      {
+        for(size_t x = 0; x < newDims[0]; x++)
+        {
+          const size_t index = (z * newDims[1] + y) * newDims[0] + x;
+          const int oldX = static_cast<int>(x) + shift[0];
+          const int oldY = static_cast<int>(y) + shift[1];
+          const int oldZ = static_cast<int>(z) + shift[2];
+          const bool insideOld = isPointInsideBox(oldX, oldY, oldZ, {0, static_cast<int>(k_TupleDims[0])}, {0, static_cast<int>(k_TupleDims[1])}, {0, static_cast<int>(k_TupleDims[2])});
+          for(size_t c = 0; c < 2; c++)
+          {
+            int32_t expected = arrayPaddingValue;
+            if(insideOld)
+            {
+              const size_t oldIndex = (static_cast<size_t>(oldZ) * k_TupleDims[1] + static_cast<size_t>(oldY)) * k_TupleDims[0] + static_cast<size_t>(oldX);
+              expected = static_cast<int32_t>(oldIndex * 2 + c);
+            }
+            DREAM3D_REQUIRE_EQUAL(da->getValue(index * 2 + c), expected)
+          }
+        }
+      }
+    }
+
+    // The kept voxels stay at the same physical position
+    if(updateOrigin)
+    {
+      FloatVec3Type newOrigin = geom->getOrigin();
+      DREAM3D_REQUIRE_EQUAL(newOrigin[0], origin[0] + shift[0] * spacing[0])
+      DREAM3D_REQUIRE_EQUAL(newOrigin[1], origin[1] + shift[1] * spacing[1])
+      DREAM3D_REQUIRE_EQUAL(newOrigin[2], origin[2] + shift[2] * spacing[2])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // testCase10: This tests that padding and cropping move every voxel, and the origin, to the right place
+  void testCase10()
+  {
+    execute_ramp(PadImageGeometry::Pad, {1, 3}, {0, 2}, {4, 0}, -7, false);
+    execute_ramp(PadImageGeometry::Pad, {0, 0}, {0, 0}, {0, 0}, -7, true);
+    execute_ramp(PadImageGeometry::Crop, {2, 3}, {0, 4}, {1, 1}, -7, false);
+    execute_ramp(PadImageGeometry::Crop, {9, 0}, {0, 9}, {4, 5}, -7, true);
+    execute_ramp(PadImageGeometry::Crop, {0, 0}, {0, 0}, {0, 0}, -7, true);
+    execute_ramp(PadImageGeometry::Pad, {1, 3}, {0, 2}, {4, 0}, -7, true, {0.5f, 2.0f, 0.25f});
+    execute_ramp(PadImageGeometry::Crop, {9, 0}, {1, 8}, {4, 5}, -7, true, {0.5f, 2.0f, 0.25f});
+  }
+
+  // -----------------------------------------------------------------------------
+  // testCase11: This tests cropping away every voxel along an axis (should fail)
+  void testCase11()
+  {
+    std::vector<std::array<IntVec2Type, 3>> invalidCrops = {{IntVec2Type(10, 0), IntVec2Type(0, 0), IntVec2Type(0, 0)},
+                                                            {IntVec2Type(0, 0), IntVec2Type(5, 5), IntVec2Type(0, 0)},
+                                                            {IntVec2Type(0, 0), IntVec2Type(0, 0), IntVec2Type(3, 20)}};
+    for(const auto& crop : invalidCrops)
+    {
+      DataContainerArray::Pointer dca = createDataStructure<int32_t, 1>(1, {0, 0, 0});
+      PadImageGeometry::Pointer filter = PadImageGeometry::New();
+      filter->setDataContainerArray(dca);
+      filter->setAttributeMatrixPath(k_DataArrayPath);
+      filter->setOperation(PadImageGeometry::Crop);
+      filter->setXMinMax(crop[0]);
+      filter->setYMinMax(crop[1]);
+      filter->setZMinMax(crop[2]);
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), PadImageGeometry::ErrorCodes::CROP_EXCEEDS_DIMENSIONS)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
@@ -490,6 +606,8 @@ public:
     DREAM3D_REGISTER_TEST(testCase7())
     DREAM3D_REGISTER_TEST(testCase8())
     DREAM3D_REGISTER_TEST(testCase9())
+    DREAM3D_REGISTER_TEST(testCase10())
+    DREAM3D_REGISTER_TEST(testCase11())
   }
 
 private:
@@ -0,0 +1,800 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BitMaskArray.h"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <numeric>
+
+#include <QtCore/QLocale>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+using namespace H5Support;
+
+namespace
+{
+/**
+ * @brief Packs whole words of a byte-per-value boolean buffer
+ */
+class PackBoolsImpl
+{
+public:
+  PackBoolsImpl(const bool* source, size_t numTuples, uint64_t* words)
+  : m_Source(source)
+  , m_NumTuples(numTuples)
+  , m_Words(words)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t w = range.min(); w < range.max(); w++)
+    {
+      const size_t start = w * BitMaskArray::k_BitsPerWord;
+      const size_t count = std::min(BitMaskArray::k_BitsPerWord, m_NumTuples - start);
+      const bool* source = m_Source + start;
+      uint64_t word = 0;
+      for(size_t b = 0; b < count; b++)
+      {
+        word |= static_cast<uint64_t>(source[b]) << b;
+      }
+      m_Words[w] = word;
+    }
+  }
+
+private:
+  const bool* m_Source = nullptr;
+  size_t m_NumTuples = 0;
+  uint64_t* m_Words = nullptr;
+};
+
+/**
+ * @brief Expands whole words into a byte-per-value boolean buffer
+ */
+class UnpackBoolsImpl
+{
+public:
+  UnpackBoolsImpl(const uint64_t* words, size_t numTuples, bool* destination)
+  : m_Words(words)
+  , m_NumTuples(numTuples)
+  , m_Destination(destination)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t w = range.min(); w < range.max(); w++)
+    {
+      const size_t start = w * BitMaskArray::k_BitsPerWord;
+      const size_t count = std::min(BitMaskArray::k_BitsPerWord, m_NumTuples - start);
+      const uint64_t word = m_Words[w];
+      bool* destination = m_Destination + start;
+      for(size_t b = 0; b < count; b++)
+      {
+        destination[b] = ((word >> b) & 1ULL) != 0;
+      }
+    }
+  }
+
+private:
+  const uint64_t* m_Words = nullptr;
+  size_t m_NumTuples = 0;
+  bool* m_Destination = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray(size_t numTuples, const QString& name, bool allocate)
+: IDataArray(name)
+, m_NumTuples(numTuples)
+, m_IsAllocated(allocate)
+{
+  if(m_IsAllocated)
+  {
+    allocateWords(WordCount(m_NumTuples));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::~BitMaskArray()
+{
+  deallocate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return NullPointer();
+  }
+  Pointer ptr(new BitMaskArray(numTuples, name, allocate));
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+{
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::FromBoolArray(const bool* data, size_t numTuples, const QString& name)
+{
+  Pointer mask = CreateArray(numTuples, name, true);
+  if(nullptr == mask || nullptr == data)
+  {
+    return mask;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, mask->m_NumWords);
+  dataAlg.execute(PackBoolsImpl(data, numTuples, mask->m_Words));
+  return mask;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::FromBoolArray(const BoolArrayType& boolArray)
+{
+  if(!boolArray.isAllocated())
+  {
+    return CreateArray(boolArray.getSize(), boolArray.getName(), false);
+  }
+  return FromBoolArray(boolArray.getPointer(0), boolArray.getSize(), boolArray.getName());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, int rank, const size_t* dims, const QString& name, bool allocate) const
+{
+  return BitMaskArray::CreateArray(numElements, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate) const
+{
+  return BitMaskArray::CreateArray(numElements, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::isAllocated() const
+{
+  return m_IsAllocated;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) const
+{
+  xdmfTypeName = getNameOfClass();
+  precision = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getTypeAsString() const
+{
+  return SIMPL::TypeNames::BitMaskArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getFullNameOfClass() const
+{
+  return "BitMaskArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::takeOwnership()
+{
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::releaseOwnership()
+{
+  m_OwnsData = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitMaskArray::getVoidPointer(size_t i)
+{
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getSize() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::getNumberOfComponents() const
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> BitMaskArray::getComponentDimensions() const
+{
+  return {1};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getTypeSize() const
+{
+  return sizeof(value_type);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::eraseTuples(const std::vector<size_t>& idxs)
+{
+  if(!m_IsAllocated || idxs.empty())
+  {
+    return 0;
+  }
+  if(idxs.size() >= m_NumTuples)
+  {
+    resizeTuples(0);
+    return 0;
+  }
+  for(const auto& value : idxs)
+  {
+    if(value >= m_NumTuples)
+    {
+      return -100;
+    }
+  }
+
+  std::vector<size_t> sortedIdxs = idxs;
+  std::sort(sortedIdxs.begin(), sortedIdxs.end());
+  sortedIdxs.erase(std::unique(sortedIdxs.begin(), sortedIdxs.end()), sortedIdxs.end());
+
+  // Compact the surviving values towards the front of the array
+  size_t dest = 0;
+  size_t next = 0;
+  for(size_t i = 0; i < m_NumTuples; i++)
+  {
+    if(next < sortedIdxs.size() && sortedIdxs[next] == i)
+    {
+      next++;
+      continue;
+    }
+    setValue(dest, getValue(i));
+    dest++;
+  }
+  resizeTuples(dest);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(!m_IsAllocated || currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  setValue(newPos, getValue(currentPos));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(!m_IsAllocated || nullptr == sourceArray || !sourceArray->isAllocated())
+  {
+    return false;
+  }
+  if(destTupleOffset >= m_NumTuples || totalSrcTuples + destTupleOffset > m_NumTuples)
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+
+  if(const Self* source = dynamic_cast<const Self*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, source->getValue(srcTupleOffset + i));
+    }
+    return true;
+  }
+
+  const BoolArrayType* boolSource = dynamic_cast<const BoolArrayType*>(sourceArray.get());
+  if(nullptr == boolSource || boolSource->getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+  const bool* source = boolSource->getPointer(srcTupleOffset);
+  for(size_t i = 0; i < totalSrcTuples; i++)
+  {
+    setValue(destTupleOffset + i, source[i]);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeTuple(size_t pos, const void* value)
+{
+  setValue(pos, *(reinterpret_cast<const bool*>(value)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithZeros()
+{
+  std::fill(m_Words, m_Words + m_NumWords, word_type(0));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::setInitValue(bool initValue)
+{
+  m_InitValue = initValue;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithValue(bool value)
+{
+  std::fill(m_Words, m_Words + m_NumWords, value ? ~word_type(0) : word_type(0));
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::deepCopy(bool forceNoAllocate) const
+{
+  bool allocate = m_IsAllocated && !forceNoAllocate;
+  BitMaskArray::Pointer daCopy = BitMaskArray::CreateArray(m_NumTuples, getName(), allocate);
+  if(allocate)
+  {
+    std::copy(m_Words, m_Words + m_NumWords, daCopy->m_Words);
+  }
+  return daCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::resizeTotalElements(size_t size)
+{
+  resizeTuples(size);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::resizeTuples(size_t numTuples)
+{
+  const size_t oldNumTuples = m_NumTuples;
+  m_NumTuples = numTuples;
+  if(m_IsAllocated)
+  {
+    const size_t numWords = WordCount(m_NumTuples);
+    if(numWords != m_NumWords)
+    {
+      word_type* oldWords = m_Words;
+      const size_t oldNumWords = m_NumWords;
+      const bool ownedOldWords = m_OwnsData;
+      m_Words = nullptr;
+      allocateWords(numWords);
+      if(nullptr != oldWords)
+      {
+        std::copy(oldWords, oldWords + std::min(oldNumWords, numWords), m_Words);
+        if(ownedOldWords)
+        {
+          delete[] oldWords;
+        }
+      }
+    }
+    clearTrailingBits();
+    if(m_InitValue)
+    {
+      for(size_t i = oldNumTuples; i < m_NumTuples; i++)
+      {
+        setValue(i, true);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printTuple(QTextStream& out, size_t i, char delimiter) const
+{
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printComponent(QTextStream& out, size_t i, int j) const
+{
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  if(!m_IsAllocated)
+  {
+    return -85;
+  }
+
+  // An empty dataset can not be written so always store at least one (zeroed) word
+  std::vector<word_type> zeroWord(1, 0);
+  const word_type* words = (m_NumWords == 0) ? zeroWord.data() : m_Words;
+  hsize_t h5Dims[1] = {static_cast<hsize_t>(std::max(m_NumWords, static_cast<size_t>(1)))};
+
+  int err = 0;
+  if(!QH5Lite::datasetExists(parentId, getName()))
+  {
+    err = QH5Lite::writePointerDataset(parentId, getName(), 1, h5Dims, words);
+  }
+  else
+  {
+    err = QH5Lite::replacePointerDataset(parentId, getName(), 1, h5Dims, words);
+  }
+  if(err < 0)
+  {
+    return err;
+  }
+
+  return H5DataArrayWriter::writeDataArrayAttributes<BitMaskArray>(parentId, this, tDims, getComponentDimensions());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::readH5Data(hid_t parentId)
+{
+  std::vector<size_t> tDims;
+  int err = QH5Lite::readVectorAttribute(parentId, getName(), SIMPL::HDF5::TupleDimensions, tDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+  QVector<hsize_t> dims;
+  H5T_class_t typeClass;
+  size_t typeSize = 0;
+  err = QH5Lite::getDatasetInfo(parentId, getName(), dims, typeClass, typeSize);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(dims.size() != 1 || typeSize != sizeof(word_type) || dims[0] < WordCount(numTuples))
+  {
+    return -86;
+  }
+
+  std::vector<word_type> words(static_cast<size_t>(dims[0]), 0);
+  err = QH5Lite::readPointerDataset(parentId, getName(), words.data());
+  if(err < 0)
+  {
+    return err;
+  }
+  allocateWords(WordCount(numTuples));
+  std::copy(words.begin(), words.begin() + m_NumWords, m_Words);
+  m_NumTuples = numTuples;
+  m_IsAllocated = true;
+  clearTrailingBits();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb) const
+{
+  out << "<!-- Xdmf is not supported for " << getNameOfClass() << " with type " << getTypeAsString() << " --> ";
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getInfoString(SIMPL::InfoStringFormat format) const
+{
+  if(format == SIMPL::HtmlFormat)
+  {
+    return getToolTipGenerator().generateHTML();
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ToolTipGenerator BitMaskArray::getToolTipGenerator() const
+{
+  ToolTipGenerator toolTipGen;
+  QLocale usa(QLocale::English, QLocale::UnitedStates);
+
+  toolTipGen.addTitle("Attribute Array Info");
+  toolTipGen.addValue("Name", getName());
+  toolTipGen.addValue("Type", getTypeAsString());
+  toolTipGen.addValue("Number of Tuples", usa.toString(static_cast<qlonglong>(getNumberOfTuples())));
+  toolTipGen.addValue("Number of Components", "1");
+  toolTipGen.addValue("Total Memory Required", usa.toString(static_cast<qlonglong>(m_NumWords * sizeof(word_type))));
+
+  return toolTipGen;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::countTrue() const
+{
+  size_t count = 0;
+  for(size_t w = 0; w < m_NumWords; w++)
+  {
+    count += std::bitset<k_BitsPerWord>(m_Words[w]).count();
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseAnd(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_NumWords != m_NumWords)
+  {
+    return false;
+  }
+  const size_t numWords = m_NumWords;
+  for(size_t w = 0; w < numWords; w++)
+  {
+    m_Words[w] &= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseOr(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_NumWords != m_NumWords)
+  {
+    return false;
+  }
+  const size_t numWords = m_NumWords;
+  for(size_t w = 0; w < numWords; w++)
+  {
+    m_Words[w] |= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::bitwiseNot()
+{
+  for(size_t w = 0; w < m_NumWords; w++)
+  {
+    m_Words[w] = ~m_Words[w];
+  }
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::copyToBoolArray(bool* destination) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_NumWords);
+  dataAlg.execute(UnpackBoolsImpl(m_Words, m_NumTuples, destination));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitMaskArray::toBoolArray() const
+{
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, getName(), m_IsAllocated);
+  if(m_IsAllocated && m_NumTuples > 0)
+  {
+    copyToBoolArray(boolArray->getPointer(0));
+  }
+  return boolArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfWords() const
+{
+  return m_NumWords;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::word_type* BitMaskArray::getWordPointer(size_t w)
+{
+  return m_Words + w;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const BitMaskArray::word_type* BitMaskArray::getWordPointer(size_t w) const
+{
+  return m_Words + w;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::clearTrailingBits()
+{
+  const size_t usedBits = m_NumTuples % k_BitsPerWord;
+  if(usedBits != 0 && m_NumWords != 0)
+  {
+    m_Words[m_NumWords - 1] &= (word_type(1) << usedBits) - 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::allocateWords(size_t numWords)
+{
+  deallocate();
+  if(numWords > 0)
+  {
+    m_Words = new word_type[numWords]();
+  }
+  m_NumWords = numWords;
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::deallocate()
+{
+  if(nullptr != m_Words && m_OwnsData)
+  {
+    delete[] m_Words;
+  }
+  m_Words = nullptr;
+  m_NumWords = 0;
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::New()
+{
+  Pointer sharedPtr(new(BitMaskArray));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getNameOfClass() const
+{
+  return QString("BitMaskArray");
+}
+
+// -----------------------------------------------------------------------------
+QString BitMaskArray::ClassName()
+{
+  return QString("BitMaskArray");
+}
+
+// -----------------------------------------------------------------------------
+int BitMaskArray::getClassVersion() const
+{
+  return 1;
+}
@@ -0,0 +1,389 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @class BitMaskArray BitMaskArray.h SIMPLib/DataArrays/BitMaskArray.h
+ * @brief Stores a single component boolean array packed 64 values to a 64 bit word.
+ *
+ * Compared to DataArray<bool> the packed layout uses 1/8th of the memory and allows whole
+ * words to be processed at a time: counting uses popcount, the logical operations combine
+ * 64 tuples per instruction and iterating the set indices skips empty words entirely.
+ * Bits past the last tuple in the final word are always kept cleared.
+ *
+ * The packed words can not be addressed per tuple, so getVoidPointer() always returns nullptr and generic
+ * code that copies raw memory through it has to skip this class. getTypeSize() is the size of the logical
+ * bool value; the words themselves are reached through getWordPointer().
+ */
+class SIMPLib_EXPORT BitMaskArray : public IDataArray
+{
+public:
+  using Self = BitMaskArray;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  using value_type = bool;
+  using word_type = uint64_t;
+
+  static constexpr size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief Returns the name of the class for BitMaskArray
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for BitMaskArray
+   */
+  static QString ClassName();
+
+  int getClassVersion() const override;
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param compDims NOT USED. The array always has a single component.
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Packs a byte-per-value boolean buffer into a new BitMaskArray
+   * @param data
+   * @param numTuples
+   * @param name
+   * @return
+   */
+  static Pointer FromBoolArray(const bool* data, size_t numTuples, const QString& name);
+
+  /**
+   * @brief Packs a DataArray<bool> into a new BitMaskArray with the same name. All components
+   * of the source array are packed as consecutive values.
+   * @param boolArray
+   * @return
+   */
+  static Pointer FromBoolArray(const BoolArrayType& boolArray);
+
+  IDataArrayShPtrType createNewArray(size_t numElements, int rank, const size_t* dims, const QString& name, bool allocate = true) const override;
+
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate = true) const override;
+
+  ~BitMaskArray() override;
+
+  bool isAllocated() const override;
+
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) const override;
+
+  QString getTypeAsString() const override;
+
+  QString getFullNameOfClass() const;
+
+  /**
+   * @brief Makes this array responsible for freeing the packed words
+   */
+  void takeOwnership() override;
+
+  /**
+   * @brief This array will NOT free the packed words when it is destroyed or reallocated. The caller takes over
+   * the buffer returned by getWordPointer(0) and must release it with delete[].
+   */
+  void releaseOwnership() override;
+
+  /**
+   * @brief Always returns nullptr; the tuples are bits and have no address of their own. Use getWordPointer()
+   * to reach the packed words.
+   * @param i
+   * @return
+   */
+  void* getVoidPointer(size_t i) override;
+
+  size_t getNumberOfTuples() const override;
+
+  size_t getSize() const override;
+
+  int getNumberOfComponents() const override;
+
+  std::vector<size_t> getComponentDimensions() const override;
+
+  /**
+   * @brief Returns the size in bytes of the logical value type, i.e. sizeof(bool). The memory actually used is
+   * getNumberOfWords() * sizeof(word_type).
+   */
+  size_t getTypeSize() const override;
+
+  int eraseTuples(const std::vector<size_t>& idxs) override;
+
+  int copyTuple(size_t currentPos, size_t newPos) override;
+
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Copies totalSrcTuples values starting at srcTupleOffset from sourceArray into this
+   * array starting at destTupleOffset. The source may be a BitMaskArray or a single component
+   * DataArray<bool>.
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Sets the value at pos from a pointer to a bool
+   * @param pos
+   * @param value
+   */
+  void initializeTuple(size_t pos, const void* value) override;
+
+  void initializeWithZeros() override;
+
+  /**
+   * @brief Sets the value that the tuples added by resizeTuples() are initialized with
+   * @param initValue
+   */
+  void setInitValue(bool initValue);
+
+  /**
+   * @brief Sets every tuple to value
+   * @param value
+   */
+  void initializeWithValue(bool value);
+
+  IDataArrayShPtrType deepCopy(bool forceNoAllocate = false) const override;
+
+  int32_t resizeTotalElements(size_t size) override;
+
+  void resizeTuples(size_t numTuples) override;
+
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
+
+  void printComponent(QTextStream& out, size_t i, int j) const override;
+
+  /**
+   * @brief Writes the packed words along with the usual DataArray attributes. The tuple
+   * dimensions attribute holds the logical (unpacked) dimensions.
+   */
+  int writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override;
+
+  int readH5Data(hid_t parentId) override;
+
+  int writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb) const override;
+
+  QString getInfoString(SIMPL::InfoStringFormat format) const override;
+
+  ToolTipGenerator getToolTipGenerator() const override;
+
+  /**
+   * @brief getValue
+   * @param i
+   * @return
+   */
+  bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1ULL) != 0;
+  }
+
+  /**
+   * @brief setValue
+   * @param i
+   * @param value
+   */
+  void setValue(size_t i, bool value)
+  {
+    const word_type bit = 1ULL << (i % k_BitsPerWord);
+    if(value)
+    {
+      m_Words[i / k_BitsPerWord] |= bit;
+    }
+    else
+    {
+      m_Words[i / k_BitsPerWord] &= ~bit;
+    }
+  }
+
+  /**
+   * @brief Returns the number of tuples that are set to true
+   * @return
+   */
+  size_t countTrue() const;
+
+  /**
+   * @brief In place logical AND with another mask of the same length
+   * @param other
+   * @return false if the tuple counts differ
+   */
+  bool bitwiseAnd(const BitMaskArray& other);
+
+  /**
+   * @brief In place logical OR with another mask of the same length
+   * @param other
+   * @return false if the tuple counts differ
+   */
+  bool bitwiseOr(const BitMaskArray& other);
+
+  /**
+   * @brief In place logical NOT of every tuple
+   */
+  void bitwiseNot();
+
+  /**
+   * @brief Unpacks the mask into a byte-per-value boolean buffer of getNumberOfTuples() elements
+   * @param destination
+   */
+  void copyToBoolArray(bool* destination) const;
+
+  /**
+   * @brief Unpacks the mask into a new DataArray<bool> with the same name
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray() const;
+
+  /**
+   * @brief Calls func(index) for every tuple that is set, in increasing index order. Words
+   * that are entirely false are skipped without touching their bits.
+   * @param func
+   */
+  template <typename Func>
+  void forEachSetIndex(Func&& func) const
+  {
+    const size_t numWords = m_NumWords;
+    for(size_t w = 0; w < numWords; w++)
+    {
+      word_type word = m_Words[w];
+      const size_t base = w * k_BitsPerWord;
+      while(word != 0)
+      {
+        func(base + CountTrailingZeros(word));
+        word &= word - 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of packed words
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Returns a pointer to the packed word w
+   * @param w
+   * @return
+   */
+  word_type* getWordPointer(size_t w);
+  const word_type* getWordPointer(size_t w) const;
+
+  /**
+   * @brief Returns the number of words needed to hold numTuples values
+   * @param numTuples
+   * @return
+   */
+  static size_t WordCount(size_t numTuples)
+  {
+    return (numTuples + k_BitsPerWord - 1) / k_BitsPerWord;
+  }
+
+  /**
+   * @brief Returns the index of the lowest set bit. The word must not be zero.
+   * @param word
+   * @return
+   */
+  static size_t CountTrailingZeros(word_type word)
+  {
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward64(&index, word);
+    return static_cast<size_t>(index);
+#else
+    return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+  }
+
+protected:
+  BitMaskArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  BitMaskArray();
+
+private:
+  word_type* m_Words = nullptr;
+  size_t m_NumWords = 0;
+  size_t m_NumTuples = 0;
+  bool m_InitValue = false;
+  bool m_IsAllocated = false;
+  bool m_OwnsData = true;
+
+  /**
+   * @brief Clears the unused bits of the final word so whole-word operations stay exact
+   */
+  void clearTrailingBits();
+
+  /**
+   * @brief Replaces the words with a zeroed buffer of numWords words that this array owns
+   */
+  void allocateWords(size_t numWords);
+
+  /**
+   * @brief Frees the words if this array owns them
+   */
+  void deallocate();
+
+public:
+  BitMaskArray(const BitMaskArray&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArray(BitMaskArray&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArray& operator=(const BitMaskArray&) = delete; // Copy Assignment Not Implemented
+  BitMaskArray& operator=(BitMaskArray&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,177 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Cache blocked copies of component ranges between interleaved arrays. They are shared by the
+ * filters that split, combine or trim arrays and by the zero-copy array views when they materialize.
+ */
+namespace ComponentCopy
+{
+/**
+ * @brief Describes the copy of numComps consecutive components of every tuple from one interleaved
+ * array into another. source and destination point at the first copied component of tuple 0 and
+ * the strides are the number of components per tuple of each array, so splitting an array (AoS to
+ * SoA), combining arrays (SoA to AoS) and dropping components are all sets of slices.
+ */
+template <typename T>
+struct ComponentSlice
+{
+  const T* source = nullptr;
+  size_t sourceStride = 1;
+  T* destination = nullptr;
+  size_t destinationStride = 1;
+  size_t numComps = 1;
+};
+
+/**
+ * @brief Copies the tuples [start, end) of a slice whose component count is known at compile time
+ */
+template <typename T, size_t NumComps>
+inline void CopyComponentTile(const ComponentSlice<T>& slice, size_t start, size_t end)
+{
+  const size_t sourceStride = slice.sourceStride;
+  const size_t destinationStride = slice.destinationStride;
+  const T* source = slice.source + start * sourceStride;
+  T* destination = slice.destination + start * destinationStride;
+  const size_t count = end - start;
+  if(sourceStride == NumComps && destinationStride == NumComps)
+  {
+    std::copy(source, source + count * NumComps, destination);
+    return;
+  }
+  for(size_t t = 0; t < count; t++)
+  {
+    for(size_t k = 0; k < NumComps; k++)
+    {
+      destination[t * destinationStride + k] = source[t * sourceStride + k];
+    }
+  }
+}
+
+/**
+ * @brief Copies the tuples [start, end) of a slice, specialised for the common component counts
+ */
+template <typename T>
+inline void CopyComponentTile(const ComponentSlice<T>& slice, size_t start, size_t end)
+{
+  switch(slice.numComps)
+  {
+  case 1:
+    CopyComponentTile<T, 1>(slice, start, end);
+    break;
+  case 2:
+    CopyComponentTile<T, 2>(slice, start, end);
+    break;
+  case 3:
+    CopyComponentTile<T, 3>(slice, start, end);
+    break;
+  case 4:
+    CopyComponentTile<T, 4>(slice, start, end);
+    break;
+  case 6:
+    CopyComponentTile<T, 6>(slice, start, end);
+    break;
+  case 9:
+    CopyComponentTile<T, 9>(slice, start, end);
+    break;
+  default:
+    for(size_t t = start; t < end; t++)
+    {
+      std::copy_n(slice.source + t * slice.sourceStride, slice.numComps, slice.destination + t * slice.destinationStride);
+    }
+    break;
+  }
+}
+
+/**
+ * @brief Copies a set of component slices that cover the same tuples. Each task walks its tuples in
+ * tiles sized so that the tile of the widest array stays in cache while every slice of the tile is
+ * copied, which turns the strided side of each slice into cache hits instead of memory traffic.
+ */
+template <typename T>
+class CopyComponentsImpl
+{
+public:
+  CopyComponentsImpl(const ComponentSlice<T>* slices, size_t numSlices)
+  : m_Slices(slices)
+  , m_NumSlices(numSlices)
+  {
+    size_t maxStride = 1;
+    for(size_t i = 0; i < numSlices; i++)
+    {
+      maxStride = std::max(maxStride, std::max(slices[i].sourceStride, slices[i].destinationStride));
+    }
+    m_TileTuples = std::max<size_t>(64, k_TileBytes / (maxStride * sizeof(T)));
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t tileStart = range.min(); tileStart < range.max(); tileStart += m_TileTuples)
+    {
+      const size_t tileEnd = std::min(tileStart + m_TileTuples, range.max());
+      for(size_t i = 0; i < m_NumSlices; i++)
+      {
+        CopyComponentTile<T>(m_Slices[i], tileStart, tileEnd);
+      }
+    }
+  }
+
+private:
+  static constexpr size_t k_TileBytes = 32768;
+
+  const ComponentSlice<T>* m_Slices = nullptr;
+  size_t m_NumSlices = 0;
+  size_t m_TileTuples = 64;
+};
+
+/**
+ * @brief Copies, in parallel and tile by tile, every slice over numTuples tuples. The slices must not
+ * write to overlapping components.
+ */
+template <typename T>
+void CopyComponents(const std::vector<ComponentSlice<T>>& slices, size_t numTuples)
+{
+  if(slices.empty() || numTuples == 0)
+  {
+    return;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(CopyComponentsImpl<T>(slices.data(), slices.size()));
+}
+} // namespace ComponentCopy
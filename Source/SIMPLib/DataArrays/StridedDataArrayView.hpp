@@ -0,0 +1,707 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/ComponentCopy.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The IDataArrayView class is the type agnostic interface for arrays that read their values
+ * out of the storage of another array instead of owning a buffer of their own. Code that needs a
+ * contiguous, owning array asks the view to materialize() itself.
+ */
+class IDataArrayView : public IDataArray
+{
+public:
+  using Self = IDataArrayView;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+
+  ~IDataArrayView() override = default;
+
+  /**
+   * @brief Returns the array whose storage is being viewed or a null pointer once the view has
+   * taken a private copy of its values.
+   * @return
+   */
+  virtual IDataArray::Pointer getBaseArray() const = 0;
+
+  /**
+   * @brief Returns an owning DataArray with the same name, tuples and components as this view. The
+   * AttributeMatrix swaps this array in for the view when an owning array is requested for the view,
+   * or for the array it reads from (getOwnedAttributeArray and the typed getters).
+   * @return
+   */
+  virtual IDataArray::Pointer materialize() const = 0;
+
+  /**
+   * @brief Materializes the given views, which read from the same base array as this view, in one
+   * pass over that base array. Views that do not share the base array are materialized on their own.
+   * @param views
+   * @return The owning arrays, in the order of views
+   */
+  virtual std::vector<IDataArray::Pointer> materializeSiblings(const std::vector<IDataArrayView::Pointer>& views) const = 0;
+
+protected:
+  explicit IDataArrayView(const QString& name)
+  : IDataArray(name)
+  {
+  }
+
+public:
+  IDataArrayView(const IDataArrayView&) = delete;            // Copy Constructor Not Implemented
+  IDataArrayView(IDataArrayView&&) = delete;                 // Move Constructor Not Implemented
+  IDataArrayView& operator=(const IDataArrayView&) = delete; // Copy Assignment Not Implemented
+  IDataArrayView& operator=(IDataArrayView&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The StridedDataArrayView class exposes a contiguous range of components of an interleaved
+ * DataArray<T> as an array of its own without copying any values. Element (tuple, comp) of the view
+ * is element (tuple, componentOffset + comp) of the base array.
+ *
+ * The view is read only. Any call that needs writable or contiguous storage (getVoidPointer, resizing,
+ * erasing, reading from HDF5, ...) first copies the viewed values into a private DataArray<T> and the
+ * view then behaves exactly like that array ("copy on write"). Writing the view to HDF5 and deep copies
+ * go through a temporary materialized array so the view itself stays zero-copy.
+ */
+template <typename T>
+class StridedDataArrayView : public IDataArrayView
+{
+public:
+  using Self = StridedDataArrayView<T>;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer()
+  {
+    return Pointer(static_cast<Self*>(nullptr));
+  }
+
+  using ArrayType = DataArray<T>;
+  using value_type = T;
+
+  /**
+   * @brief Returns the name of the class for AbstractMessage
+   */
+  QString getNameOfClass() const override
+  {
+    return QString("StridedDataArrayView<T>");
+  }
+  /**
+   * @brief Returns the name of the class for AbstractMessage
+   */
+  static QString ClassName()
+  {
+    return QString("StridedDataArrayView<T>");
+  }
+
+  /**
+   * @brief Returns the version of this class.
+   * @return
+   */
+  int32_t getClassVersion() const override
+  {
+    return 2;
+  }
+
+  /**
+   * @brief Static constructor
+   * @param baseArray The interleaved array to view. It must be allocated.
+   * @param componentOffset The first component of the base array that is part of the view
+   * @param numComponents The number of consecutive components that make up each tuple of the view
+   * @param name The name of the view
+   * @return Null pointer if the component range does not fit inside the base array
+   */
+  static Pointer Create(const typename ArrayType::Pointer& baseArray, size_t componentOffset, size_t numComponents, const QString& name)
+  {
+    if(nullptr == baseArray || !baseArray->isAllocated() || name.isEmpty() || numComponents == 0)
+    {
+      return NullPointer();
+    }
+    if(componentOffset + numComponents > static_cast<size_t>(baseArray->getNumberOfComponents()))
+    {
+      return NullPointer();
+    }
+    return Pointer(new Self(baseArray, componentOffset, numComponents, name));
+  }
+
+  ~StridedDataArrayView() override = default;
+
+  /**
+   * @brief Returns the typed base array or a null pointer once the view owns a private copy.
+   * @return
+   */
+  typename ArrayType::Pointer getBaseDataArray() const
+  {
+    return m_Base;
+  }
+
+  /**
+   * @brief getBaseArray
+   * @return
+   */
+  IDataArray::Pointer getBaseArray() const override
+  {
+    return m_Base;
+  }
+
+  /**
+   * @brief Returns true while the view still reads from its base array.
+   * @return
+   */
+  bool isView() const
+  {
+    return nullptr != m_Base;
+  }
+
+  /**
+   * @brief Returns the first base component covered by the view.
+   * @return
+   */
+  size_t getComponentOffset() const
+  {
+    return m_ComponentOffset;
+  }
+
+  /**
+   * @brief Returns the distance, in elements, between two consecutive tuples of the view.
+   * @return
+   */
+  size_t getStride() const
+  {
+    return isView() ? static_cast<size_t>(m_Base->getNumberOfComponents()) : m_NumComponents;
+  }
+
+  /**
+   * @brief Returns the value at element i of the view where i = tuple * numComponents + component.
+   * @param i
+   * @return
+   */
+  T getValue(size_t i) const
+  {
+    if(!isView())
+    {
+      return m_Owned->getValue(i);
+    }
+    return m_Base->getValue((i / m_NumComponents) * getStride() + m_ComponentOffset + (i % m_NumComponents));
+  }
+
+  /**
+   * @brief Returns component j of tuple i.
+   * @param i
+   * @param j
+   * @return
+   */
+  T getComponent(size_t i, int32_t j) const
+  {
+    return getValue(i * m_NumComponents + static_cast<size_t>(j));
+  }
+
+  /**
+   * @brief Copies the viewed values into a contiguous destination buffer that holds at least getSize() elements.
+   * @param destination
+   */
+  void copyTo(T* destination) const
+  {
+    if(!isView())
+    {
+      const T* source = m_Owned->getPointer(0);
+      std::copy(source, source + m_Owned->getSize(), destination);
+      return;
+    }
+    ComponentCopy::CopyComponents(std::vector<ComponentCopy::ComponentSlice<T>>{slice(destination)}, m_Base->getNumberOfTuples());
+  }
+
+  /**
+   * @brief Returns a DataArray<T> that owns the values of the view. This is a new copy while the
+   * view reads from its base array and the private copy once the view has been written to.
+   * @return
+   */
+  typename ArrayType::Pointer materializeDataArray() const
+  {
+    if(!isView())
+    {
+      m_Owned->setName(getName());
+      return m_Owned;
+    }
+    typename ArrayType::Pointer array = ArrayType::CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), true);
+    if(nullptr != array)
+    {
+      copyTo(array->getPointer(0));
+    }
+    return array;
+  }
+
+  /**
+   * @brief materialize
+   * @return
+   */
+  IDataArray::Pointer materialize() const override
+  {
+    return materializeDataArray();
+  }
+
+  /**
+   * @brief materializeSiblings
+   * @param views
+   * @return
+   */
+  std::vector<IDataArray::Pointer> materializeSiblings(const std::vector<IDataArrayView::Pointer>& views) const override
+  {
+    std::vector<IDataArray::Pointer> arrays(views.size());
+    std::vector<ComponentCopy::ComponentSlice<T>> slices;
+    for(size_t i = 0; i < views.size(); i++)
+    {
+      const Self* sibling = dynamic_cast<const Self*>(views[i].get());
+      if(nullptr == sibling || !sibling->isView() || sibling->m_Base != m_Base)
+      {
+        arrays[i] = views[i]->materialize();
+        continue;
+      }
+      typename ArrayType::Pointer array = ArrayType::CreateArray(sibling->getNumberOfTuples(), sibling->getComponentDimensions(), sibling->getName(), true);
+      if(nullptr != array)
+      {
+        slices.push_back(sibling->slice(array->getPointer(0)));
+      }
+      arrays[i] = array;
+    }
+    // Every slice reads the same base tuples, so they are copied together tile by tile
+    if(!slices.empty())
+    {
+      ComponentCopy::CopyComponents(slices, m_Base->getNumberOfTuples());
+    }
+    return arrays;
+  }
+
+  /**
+   * @brief createNewArray
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, int32_t rank, const size_t* compDims, const QString& name, bool allocate = true) const override
+  {
+    return ArrayType::CreateArray(numElements, rank, compDims, name, allocate);
+  }
+
+  /**
+   * @brief createNewArray
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& compDims, const QString& name, bool allocate = true) const override
+  {
+    return ArrayType::CreateArray(numElements, compDims, name, allocate);
+  }
+
+  /**
+   * @brief isAllocated
+   * @return
+   */
+  bool isAllocated() const override
+  {
+    return storage().isAllocated();
+  }
+
+  /**
+   * @brief takeOwnership
+   */
+  void takeOwnership() override
+  {
+    if(!isView())
+    {
+      m_Owned->takeOwnership();
+    }
+  }
+
+  /**
+   * @brief releaseOwnership
+   */
+  void releaseOwnership() override
+  {
+    if(!isView())
+    {
+      m_Owned->releaseOwnership();
+    }
+  }
+
+  /**
+   * @brief Returns a pointer into contiguous storage. This takes a private copy of the viewed values.
+   * @param i
+   * @return
+   */
+  void* getVoidPointer(size_t i) override
+  {
+    return detach().getVoidPointer(i);
+  }
+
+  /**
+   * @brief getNumberOfTuples
+   * @return
+   */
+  size_t getNumberOfTuples() const override
+  {
+    return storage().getNumberOfTuples();
+  }
+
+  /**
+   * @brief getSize
+   * @return
+   */
+  size_t getSize() const override
+  {
+    return isView() ? m_Base->getNumberOfTuples() * m_NumComponents : m_Owned->getSize();
+  }
+
+  /**
+   * @brief getNumberOfComponents
+   * @return
+   */
+  int32_t getNumberOfComponents() const override
+  {
+    return isView() ? static_cast<int32_t>(m_NumComponents) : m_Owned->getNumberOfComponents();
+  }
+
+  /**
+   * @brief getComponentDimensions
+   * @return
+   */
+  std::vector<size_t> getComponentDimensions() const override
+  {
+    return isView() ? std::vector<size_t>(1, m_NumComponents) : m_Owned->getComponentDimensions();
+  }
+
+  /**
+   * @brief getTypeSize
+   * @return
+   */
+  size_t getTypeSize() const override
+  {
+    return sizeof(T);
+  }
+
+  /**
+   * @brief getXdmfTypeAndSize
+   * @param xdmfTypeName
+   * @param precision
+   */
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const override
+  {
+    storage().getXdmfTypeAndSize(xdmfTypeName, precision);
+  }
+
+  /**
+   * @brief eraseTuples
+   * @param idxs
+   * @return
+   */
+  int32_t eraseTuples(const std::vector<size_t>& idxs) override
+  {
+    return detach().eraseTuples(idxs);
+  }
+
+  /**
+   * @brief copyTuple
+   * @param currentPos
+   * @param newPos
+   * @return
+   */
+  int32_t copyTuple(size_t currentPos, size_t newPos) override
+  {
+    return detach().copyTuple(currentPos, newPos);
+  }
+
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief copyFromArray
+   * @return
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
+  {
+    return detach().copyFromArray(destTupleOffset, sourceArray, srcTupleOffset, totalSrcTuples);
+  }
+
+  /**
+   * @brief initializeTuple
+   * @param pos
+   * @param value
+   */
+  void initializeTuple(size_t pos, const void* value) override
+  {
+    detach().initializeTuple(pos, value);
+  }
+
+  /**
+   * @brief initializeWithZeros
+   */
+  void initializeWithZeros() override
+  {
+    detach().initializeWithZeros();
+  }
+
+  /**
+   * @brief resizeTotalElements
+   * @param size
+   * @return
+   */
+  int32_t resizeTotalElements(size_t size) override
+  {
+    return detach().resizeTotalElements(size);
+  }
+
+  /**
+   * @brief resizeTuples
+   * @param count
+   */
+  void resizeTuples(size_t count) override
+  {
+    detach().resizeTuples(count);
+  }
+
+  /**
+   * @brief printTuple
+   * @param out
+   * @param i
+   * @param delimiter
+   */
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override
+  {
+    if(!isView())
+    {
+      m_Owned->printTuple(out, i, delimiter);
+      return;
+    }
+    int32_t precision = out.realNumberPrecision();
+    if constexpr(std::is_same_v<T, float>)
+    {
+      out.setRealNumberPrecision(8);
+    }
+    else if constexpr(std::is_same_v<T, double>)
+    {
+      out.setRealNumberPrecision(16);
+    }
+    for(size_t j = 0; j < m_NumComponents; ++j)
+    {
+      if(j != 0)
+      {
+        out << delimiter;
+      }
+      out << getValue(i * m_NumComponents + j);
+    }
+    out.setRealNumberPrecision(precision);
+  }
+
+  /**
+   * @brief printComponent
+   * @param out
+   * @param i
+   * @param j
+   */
+  void printComponent(QTextStream& out, size_t i, int32_t j) const override
+  {
+    out << getComponent(i, j);
+  }
+
+  /**
+   * @brief Returns an owning DataArray<T>, never another view.
+   * @param forceNoAllocate
+   * @return
+   */
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) const override
+  {
+    if(forceNoAllocate)
+    {
+      return ArrayType::CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+    }
+    if(!isView())
+    {
+      return m_Owned->deepCopy(false);
+    }
+    return materializeDataArray();
+  }
+
+  /**
+   * @brief Writes the viewed values to HDF5 through a temporary, materialized array.
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override
+  {
+    if(!isView())
+    {
+      return m_Owned->writeH5Data(parentId, tDims);
+    }
+    typename ArrayType::Pointer array = materializeDataArray();
+    if(nullptr == array)
+    {
+      return -1;
+    }
+    return array->writeH5Data(parentId, tDims);
+  }
+
+  /**
+   * @brief readH5Data
+   * @param parentId
+   * @return
+   */
+  int32_t readH5Data(hid_t parentId) override
+  {
+    return detach().readH5Data(parentId);
+  }
+
+  /**
+   * @brief writeXdmfAttribute
+   * @return
+   */
+  int32_t writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const override
+  {
+    if(!isView())
+    {
+      return metaData()->writeXdmfAttribute(out, volDims, hdfFileName, groupPath, label);
+    }
+    // The XDMF description only depends on the name, type and component shape, but DataArray<T>
+    // refuses to describe unallocated arrays so a single tuple stands in for the view.
+    typename ArrayType::Pointer proxy = ArrayType::CreateArray(1, getComponentDimensions(), getName(), true);
+    return proxy->writeXdmfAttribute(out, volDims, hdfFileName, groupPath, label);
+  }
+
+  /**
+   * @brief getTypeAsString
+   * @return
+   */
+  QString getTypeAsString() const override
+  {
+    return storage().getTypeAsString();
+  }
+
+  /**
+   * @brief getInfoString
+   * @param format
+   * @return
+   */
+  QString getInfoString(SIMPL::InfoStringFormat format) const override
+  {
+    return metaData()->getInfoString(format);
+  }
+
+  /**
+   * @brief getToolTipGenerator
+   * @return
+   */
+  ToolTipGenerator getToolTipGenerator() const override
+  {
+    return metaData()->getToolTipGenerator();
+  }
+
+protected:
+  StridedDataArrayView(const typename ArrayType::Pointer& baseArray, size_t componentOffset, size_t numComponents, const QString& name)
+  : IDataArrayView(name)
+  , m_Base(baseArray)
+  , m_ComponentOffset(componentOffset)
+  , m_NumComponents(numComponents)
+  {
+  }
+
+private:
+  typename ArrayType::Pointer m_Base;
+  typename ArrayType::Pointer m_Owned;
+  size_t m_ComponentOffset = 0;
+  size_t m_NumComponents = 1;
+
+  /**
+   * @brief Returns whichever array currently backs the view.
+   * @return
+   */
+  const ArrayType& storage() const
+  {
+    return isView() ? *m_Base : *m_Owned;
+  }
+
+  /**
+   * @brief Describes the copy of the viewed components into a contiguous destination. Only valid while
+   * the view reads from its base array.
+   * @param destination
+   * @return
+   */
+  ComponentCopy::ComponentSlice<T> slice(T* destination) const
+  {
+    return {m_Base->getPointer(0) + m_ComponentOffset, getStride(), destination, m_NumComponents, m_NumComponents};
+  }
+
+  /**
+   * @brief Takes a private copy of the viewed values, if not done already, and drops the base array.
+   * @return
+   */
+  ArrayType& detach()
+  {
+    if(isView())
+    {
+      m_Owned = materializeDataArray();
+      m_Base = nullptr;
+    }
+    m_Owned->setName(getName());
+    return *m_Owned;
+  }
+
+  /**
+   * @brief Returns an array that reports the same name, type and shape as the view. It is only
+   * allocated (and returned directly) once the view owns its values.
+   * @return
+   */
+  typename ArrayType::Pointer metaData() const
+  {
+    if(!isView())
+    {
+      m_Owned->setName(getName());
+      return m_Owned;
+    }
+    return ArrayType::CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+  }
+
+public:
+  StridedDataArrayView(const StridedDataArrayView&) = delete;            // Copy Constructor Not Implemented
+  StridedDataArrayView(StridedDataArrayView&&) = delete;                 // Move Constructor Not Implemented
+  StridedDataArrayView& operator=(const StridedDataArrayView&) = delete; // Copy Assignment Not Implemented
+  StridedDataArrayView& operator=(StridedDataArrayView&&) = delete;      // Move Assignment Not Implemented
+};
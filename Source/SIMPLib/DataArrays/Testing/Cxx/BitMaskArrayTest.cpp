@@ -0,0 +1,312 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+using namespace H5Support;
+
+namespace
+{
+const QString k_ArrayName("Mask");
+// Deliberately not a multiple of 64 so the partial final word is exercised
+constexpr size_t k_NumTuples = 203;
+
+bool ExpectedValue(size_t i)
+{
+  return (i % 3 == 0) || (i % 7 == 5);
+}
+} // namespace
+
+class BitMaskArrayTest
+{
+public:
+  BitMaskArrayTest() = default;
+  virtual ~BitMaskArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::BitMaskArrayTest::TestFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BitMaskArray::Pointer createMask()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_NumTuples, k_ArrayName, true);
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 4)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfComponents(), 1)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      mask->setValue(i, ::ExpectedValue(i));
+    }
+    return mask;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t expectedCount()
+  {
+    size_t count = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      count += ::ExpectedValue(i) ? 1 : 0;
+    }
+    return count;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCountAndIteration()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), expectedCount())
+
+    std::vector<size_t> setIndices;
+    mask->forEachSetIndex([&](size_t idx) { setIndices.push_back(idx); });
+    DREAM3D_REQUIRE_EQUAL(setIndices.size(), expectedCount())
+    size_t next = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(::ExpectedValue(i))
+      {
+        DREAM3D_REQUIRE_EQUAL(setIndices[next], i)
+        next++;
+      }
+    }
+
+    mask->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), k_NumTuples)
+    mask->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLogicalOperations()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    BitMaskArray::Pointer other = BitMaskArray::CreateArray(k_NumTuples, k_ArrayName, true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      other->setValue(i, i % 2 == 0);
+    }
+
+    BitMaskArray::Pointer andMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(andMask->bitwiseAnd(*other), true)
+    BitMaskArray::Pointer orMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(orMask->bitwiseOr(*other), true)
+    BitMaskArray::Pointer notMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    notMask->bitwiseNot();
+
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(andMask->getValue(i), ::ExpectedValue(i) && (i % 2 == 0))
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), ::ExpectedValue(i) || (i % 2 == 0))
+      DREAM3D_REQUIRE_EQUAL(notMask->getValue(i), !::ExpectedValue(i))
+    }
+    // The bits past the last tuple must stay cleared after a NOT
+    DREAM3D_REQUIRE_EQUAL(notMask->countTrue(), k_NumTuples - expectedCount())
+
+    BitMaskArray::Pointer shorter = BitMaskArray::CreateArray(k_NumTuples - 1, k_ArrayName, true);
+    DREAM3D_REQUIRE_EQUAL(mask->bitwiseAnd(*shorter), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoolConversion()
+  {
+    BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(k_NumTuples, k_ArrayName, true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      boolArray->setValue(i, ::ExpectedValue(i));
+    }
+
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(*boolArray);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), expectedCount())
+
+    BoolArrayType::Pointer roundTrip = mask->toBoolArray();
+    DREAM3D_REQUIRE_EQUAL(roundTrip->getNumberOfTuples(), k_NumTuples)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(roundTrip->getValue(i), ::ExpectedValue(i))
+    }
+
+    // Copying from a DataArray<bool> source
+    BitMaskArray::Pointer copy = BitMaskArray::CreateArray(10, k_ArrayName, true);
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(0, boolArray, 100, 10), true)
+    for(size_t i = 0; i < 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), ::ExpectedValue(100 + i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResizeAndErase()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    mask->initializeWithValue(true);
+    mask->resizeTuples(70);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 70)
+    mask->resizeTuples(130);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 70)
+
+    mask = createMask();
+    std::vector<size_t> idxs = {0, 3, 200};
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples - 3)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(0), ::ExpectedValue(1))
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(1), ::ExpectedValue(2))
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(2), ::ExpectedValue(4))
+
+    idxs = {k_NumTuples};
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(idxs), -100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataArrayContract()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    DREAM3D_REQUIRE_EQUAL(mask->getTypeSize(), sizeof(bool))
+    DREAM3D_REQUIRE(mask->getVoidPointer(0) == nullptr)
+
+    // New tuples take the init value
+    mask->setInitValue(true);
+    mask->resizeTuples(k_NumTuples + 10);
+    for(size_t i = k_NumTuples; i < k_NumTuples + 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), true)
+    }
+
+    // Once ownership is released the caller frees the words
+    BitMaskArray::word_type* words = mask->getWordPointer(0);
+    mask->releaseOwnership();
+    mask = BitMaskArray::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(words[0] & 1ULL, ::ExpectedValue(0) ? 1ULL : 0ULL)
+    delete[] words;
+
+    mask = createMask();
+    mask->releaseOwnership();
+    mask->takeOwnership();
+    mask = BitMaskArray::NullPointer();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHDF5RoundTrip()
+  {
+    QDir dir(UnitTest::BitMaskArrayTest::TestDir);
+    dir.mkpath(".");
+
+    BitMaskArray::Pointer mask = createMask();
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::BitMaskArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0);
+      H5ScopedFileSentinel sentinel(fileId, false);
+      std::vector<size_t> tDims = {k_NumTuples};
+      int err = mask->writeH5Data(fileId, tDims);
+      DREAM3D_REQUIRE(err >= 0);
+    }
+
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::BitMaskArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0);
+      H5ScopedFileSentinel sentinel(fileId, false);
+
+      IDataArray::Pointer metaData = H5DataArrayReader::ReadBitMaskArray(fileId, k_ArrayName, true);
+      DREAM3D_REQUIRE_VALID_POINTER(metaData.get())
+      DREAM3D_REQUIRE_EQUAL(metaData->isAllocated(), false)
+      DREAM3D_REQUIRE_EQUAL(metaData->getNumberOfTuples(), k_NumTuples)
+
+      BitMaskArray::Pointer readMask = std::dynamic_pointer_cast<BitMaskArray>(H5DataArrayReader::ReadBitMaskArray(fileId, k_ArrayName, false));
+      DREAM3D_REQUIRE_VALID_POINTER(readMask.get())
+      DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfTuples(), k_NumTuples)
+      for(size_t i = 0; i < k_NumTuples; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readMask->getValue(i), ::ExpectedValue(i))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BitMaskArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCountAndIteration())
+    DREAM3D_REGISTER_TEST(TestLogicalOperations())
+    DREAM3D_REGISTER_TEST(TestBoolConversion())
+    DREAM3D_REGISTER_TEST(TestResizeAndErase())
+    DREAM3D_REGISTER_TEST(TestDataArrayContract())
+    DREAM3D_REGISTER_TEST(TestHDF5RoundTrip())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  BitMaskArrayTest(const BitMaskArrayTest&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArrayTest(BitMaskArrayTest&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArrayTest& operator=(const BitMaskArrayTest&) = delete; // Copy Assignment Not Implemented
+  BitMaskArrayTest& operator=(BitMaskArrayTest&&) = delete;      // Move Assignment Not Implemented
+};
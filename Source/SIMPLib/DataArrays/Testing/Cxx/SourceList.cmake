@@ -1,7 +1,9 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BitMaskArrayTest
   DataArrayTest
   StringDataArrayTest
+  StridedDataArrayViewTest
   StructArrayTest
 )
 
@@ -0,0 +1,255 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+namespace
+{
+constexpr size_t k_NumTuples = 37;
+constexpr size_t k_NumComps = 4;
+
+Int32ArrayType::Pointer CreateBaseArray()
+{
+  Int32ArrayType::Pointer base = Int32ArrayType::CreateArray(k_NumTuples, std::vector<size_t>(1, k_NumComps), QString("Base"), true);
+  for(size_t t = 0; t < k_NumTuples; t++)
+  {
+    for(size_t c = 0; c < k_NumComps; c++)
+    {
+      base->setComponent(t, static_cast<int32_t>(c), static_cast<int32_t>(t * 10 + c));
+    }
+  }
+  return base;
+}
+} // namespace
+
+class StridedDataArrayViewTest
+{
+public:
+  StridedDataArrayViewTest() = default;
+  virtual ~StridedDataArrayViewTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestViewValues()
+  {
+    Int32ArrayType::Pointer base = ::CreateBaseArray();
+
+    DREAM3D_REQUIRE(nullptr == StridedDataArrayView<int32_t>::Create(base, 3, 2, QString("View")))
+    DREAM3D_REQUIRE(nullptr == StridedDataArrayView<int32_t>::Create(base, 0, 0, QString("View")))
+
+    StridedDataArrayView<int32_t>::Pointer view = StridedDataArrayView<int32_t>::Create(base, 1, 2, QString("View"));
+    DREAM3D_REQUIRE_VALID_POINTER(view.get())
+    DREAM3D_REQUIRE_EQUAL(view->isView(), true)
+    DREAM3D_REQUIRE_EQUAL(view->getStride(), k_NumComps)
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfComponents(), 2)
+    DREAM3D_REQUIRE_EQUAL(view->getSize(), k_NumTuples * 2)
+    DREAM3D_REQUIRE_EQUAL(view->getTypeAsString(), base->getTypeAsString())
+
+    for(size_t t = 0; t < k_NumTuples; t++)
+    {
+      DREAM3D_REQUIRE_EQUAL(view->getComponent(t, 0), base->getComponent(t, 1))
+      DREAM3D_REQUIRE_EQUAL(view->getComponent(t, 1), base->getComponent(t, 2))
+    }
+
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(view->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfComponents(), 2)
+    for(size_t i = 0; i < copy->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), view->getValue(i))
+    }
+    // Deep copies never alias the base array
+    DREAM3D_REQUIRE_EQUAL(view->isView(), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    Int32ArrayType::Pointer base = ::CreateBaseArray();
+    StridedDataArrayView<int32_t>::Pointer view = StridedDataArrayView<int32_t>::Create(base, 2, 1, QString("View"));
+    DREAM3D_REQUIRE_VALID_POINTER(view.get())
+
+    int32_t value = -5;
+    view->initializeTuple(3, &value);
+    DREAM3D_REQUIRE_EQUAL(view->isView(), false)
+    DREAM3D_REQUIRE(nullptr == view->getBaseArray())
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(view->getComponent(3, 0), -5)
+    // The base array is untouched by writes through the view
+    DREAM3D_REQUIRE_EQUAL(base->getComponent(3, 2), 32)
+
+    for(size_t t = 0; t < k_NumTuples; t++)
+    {
+      if(t != 3)
+      {
+        DREAM3D_REQUIRE_EQUAL(view->getComponent(t, 0), base->getComponent(t, 2))
+      }
+    }
+
+    // Once detached the view hands out its private copy instead of copying again
+    IDataArray::Pointer owned = view->materialize();
+    DREAM3D_REQUIRE(owned.get() == view->materialize().get())
+    DREAM3D_REQUIRE_EQUAL(owned->getName(), QString("View"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAttributeMatrixMaterialize()
+  {
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(std::vector<size_t>(1, k_NumTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer base = ::CreateBaseArray();
+    attrMat->insertOrAssign(base);
+    attrMat->insertOrAssign(StridedDataArrayView<int32_t>::Create(base, 0, 1, QString("Component0")));
+    attrMat->insertOrAssign(StridedDataArrayView<int32_t>::Create(base, 1, 1, QString("Component1")));
+
+    // Reading an IDataArray leaves the views in place so read-only consumers stay zero-copy
+    DREAM3D_REQUIRE(nullptr != std::dynamic_pointer_cast<const IDataArrayView>(attrMat->getAttributeArray("Component1")))
+    IDataArray::Pointer prereqView = attrMat->getPrereqIDataArray(nullptr, "Component1", -90000);
+    DREAM3D_REQUIRE(nullptr != std::dynamic_pointer_cast<const IDataArrayView>(prereqView))
+
+    // Asking for an owning array replaces the view, in place, with its materialized copy
+    Int32ArrayType::Pointer comp1 = attrMat->getAttributeArrayAs<Int32ArrayType>("Component1");
+    DREAM3D_REQUIRE_VALID_POINTER(comp1.get())
+    DREAM3D_REQUIRE(attrMat->getAttributeArray("Component1") == comp1)
+    DREAM3D_REQUIRE_EQUAL(attrMat->getAttributeArrayNames().indexOf("Component1"), 2)
+    for(size_t t = 0; t < k_NumTuples; t++)
+    {
+      DREAM3D_REQUIRE_EQUAL(comp1->getValue(t), base->getComponent(t, 1))
+    }
+    DREAM3D_REQUIRE(nullptr != std::dynamic_pointer_cast<const IDataArrayView>(attrMat->getAttributeArray("Component0")))
+
+    // Handing out the base array for writing materializes the remaining views first
+    IDataArray::Pointer rawBase = attrMat->getOwnedAttributeArray("Base");
+    DREAM3D_REQUIRE(rawBase == base)
+    DREAM3D_REQUIRE(nullptr == std::dynamic_pointer_cast<const IDataArrayView>(attrMat->getAttributeArray("Component0")))
+    base->setComponent(0, 0, 1000);
+    Int32ArrayType::Pointer comp0 = attrMat->getAttributeArrayAs<Int32ArrayType>("Component0");
+    DREAM3D_REQUIRE_VALID_POINTER(comp0.get())
+    DREAM3D_REQUIRE_EQUAL(comp0->getValue(0), 0)
+
+    // So does removing the base array from the AttributeMatrix
+    attrMat->insertOrAssign(StridedDataArrayView<int32_t>::Create(base, 3, 1, QString("Component3")));
+    IDataArray::Pointer removed = attrMat->removeAttributeArray("Base");
+    DREAM3D_REQUIRE(removed == base)
+    DREAM3D_REQUIRE(nullptr == std::dynamic_pointer_cast<const IDataArrayView>(attrMat->getAttributeArray("Component3")))
+    base->setComponent(1, 3, -1);
+    DREAM3D_REQUIRE_EQUAL(attrMat->getAttributeArrayAs<Int32ArrayType>("Component3")->getValue(1), 13)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMaterializeSiblings()
+  {
+    Int32ArrayType::Pointer base = ::CreateBaseArray();
+    Int32ArrayType::Pointer other = ::CreateBaseArray();
+    StridedDataArrayView<int32_t>::Pointer first = StridedDataArrayView<int32_t>::Create(base, 0, 1, QString("First"));
+    std::vector<IDataArrayView::Pointer> views = {first, StridedDataArrayView<int32_t>::Create(base, 1, 3, QString("Rest")),
+                                                  StridedDataArrayView<int32_t>::Create(other, 2, 2, QString("Other"))};
+
+    // Views of the base array are copied together, the view of the other array on its own
+    std::vector<IDataArray::Pointer> arrays = first->materializeSiblings(views);
+    DREAM3D_REQUIRE_EQUAL(arrays.size(), views.size())
+    const std::vector<size_t> offsets = {0, 1, 2};
+    for(size_t i = 0; i < arrays.size(); i++)
+    {
+      Int32ArrayType::Pointer array = std::dynamic_pointer_cast<Int32ArrayType>(arrays[i]);
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE_EQUAL(array->getName(), views[i]->getName())
+      DREAM3D_REQUIRE_EQUAL(array->getNumberOfComponents(), views[i]->getNumberOfComponents())
+      Int32ArrayType::Pointer source = (i == 2) ? other : base;
+      for(size_t t = 0; t < k_NumTuples; t++)
+      {
+        for(int32_t c = 0; c < array->getNumberOfComponents(); c++)
+        {
+          DREAM3D_REQUIRE_EQUAL(array->getComponent(t, c), source->getComponent(t, static_cast<int32_t>(offsets[i]) + c))
+        }
+      }
+    }
+
+    // The copies are independent of the base array
+    base->setComponent(0, 1, -5);
+    DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<Int32ArrayType>(arrays[1])->getComponent(0, 0), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestThresholdOnView()
+  {
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(std::vector<size_t>(1, k_NumTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer base = ::CreateBaseArray();
+    attrMat->insertOrAssign(base);
+    attrMat->insertOrAssign(StridedDataArrayView<int32_t>::Create(base, 2, 1, QString("Component2")));
+
+    // Thresholding reads the component straight out of the base array
+    BoolArrayType::Pointer mask = BoolArrayType::CreateArray(k_NumTuples, std::vector<size_t>(1, 1), QString("Mask"), true);
+    ThresholdFilterHelper filter(SIMPL::Comparison::Operator_GreaterThan, 200.0, mask.get());
+    DREAM3D_REQUIRE(filter.execute(attrMat->getAttributeArray("Component2"), mask.get()) >= 0)
+    for(size_t t = 0; t < k_NumTuples; t++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(t), base->getComponent(t, 2) > 200)
+    }
+    DREAM3D_REQUIRE(nullptr != std::dynamic_pointer_cast<const IDataArrayView>(attrMat->getAttributeArray("Component2")))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### StridedDataArrayViewTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestViewValues())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestAttributeMatrixMaterialize())
+    DREAM3D_REGISTER_TEST(TestMaterializeSiblings())
+    DREAM3D_REGISTER_TEST(TestThresholdOnView())
+  }
+
+public:
+  StridedDataArrayViewTest(const StridedDataArrayViewTest&) = delete;            // Copy Constructor Not Implemented
+  StridedDataArrayViewTest(StridedDataArrayViewTest&&) = delete;                 // Move Constructor Not Implemented
+  StridedDataArrayViewTest& operator=(const StridedDataArrayViewTest&) = delete; // Copy Assignment Not Implemented
+  StridedDataArrayViewTest& operator=(StridedDataArrayViewTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -53,6 +53,7 @@ using namespace H5Support;
 // DREAM3D Includes
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
@@ -331,6 +332,8 @@ IDataArray::Pointer AttributeMatrix::removeAttributeArray(const QString& name)
   }
   IDataArray::Pointer p = (*it);
   erase(it);
+  // The array may be written once it is handed out, so views of it stop sharing its storage
+  materializeViewsOf(p);
   return p;
 }
 
@@ -590,6 +593,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
       dPtr->resizeTuples(getNumberOfTuples());
     }
   }
+  else if(classType.compare("BitMaskArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitMaskArray(gid, name, preflight);
+    if(preflight && nullptr != dPtr)
+    {
+      dPtr->resizeTuples(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -647,6 +658,10 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
     }
+    else if(classType.compare("BitMaskArray") == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitMaskArray(amGid, daToRead.getName(), preflight);
+    }
     else if(classType.compare("vector") == 0)
     {
     }
@@ -994,6 +1009,66 @@ IDataArrayShPtrType AttributeMatrix::getAttributeArray(const DataArrayPath& path
   return getAttributeArray(path.getDataArrayName());
 }
 
+// -----------------------------------------------------------------------------
+IDataArrayShPtrType AttributeMatrix::getOwnedAttributeArray(const QString& name) const
+{
+  // Swapping a view for its materialized array does not change the observable contents of the
+  // AttributeMatrix, only how the values are stored, so it is allowed through the const interface.
+  auto* self = const_cast<AttributeMatrix*>(this);
+
+  auto iter = self->find(name);
+  if(iter == self->end())
+  {
+    return IDataArrayShPtrType();
+  }
+
+  IDataArrayView::Pointer view = std::dynamic_pointer_cast<IDataArrayView>(*iter);
+  if(nullptr != view)
+  {
+    IDataArrayShPtrType owned = view->materialize();
+    if(nullptr != owned)
+    {
+      self->replace(iter, owned);
+    }
+    return owned;
+  }
+
+  // The caller may write into this array so any view reading from it takes its own copy first
+  IDataArrayShPtrType array = *iter;
+  self->materializeViewsOf(array);
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+void AttributeMatrix::materializeViewsOf(const IDataArrayShPtrType& array)
+{
+  std::vector<size_t> indices;
+  std::vector<IDataArrayView::Pointer> views;
+  for(auto iter = begin(); iter != end(); ++iter)
+  {
+    IDataArrayView::Pointer view = std::dynamic_pointer_cast<IDataArrayView>(*iter);
+    if(nullptr != view && view->getBaseArray() == array)
+    {
+      indices.push_back(static_cast<size_t>(iter - begin()));
+      views.push_back(view);
+    }
+  }
+  if(views.empty())
+  {
+    return;
+  }
+
+  // The views share one base array, so they are copied out of it in a single pass
+  std::vector<IDataArray::Pointer> owned = views.front()->materializeSiblings(views);
+  for(size_t i = 0; i < views.size(); i++)
+  {
+    if(nullptr != owned[i])
+    {
+      replace(begin() + indices[i], owned[i]);
+    }
+  }
+}
+
 bool AttributeMatrix::doesAttributeArrayExist(const QString& name) const
 {
   return contains(name);
@@ -1016,6 +1091,10 @@ IDataArray::Pointer AttributeMatrix::getPrereqIDataArray(AbstractFilter* filter,
     }
     return attributeArray;
   }
+  if(filter)
+  {
+    filter->addPrereqPath(DataArrayPath(getParentPath().getDataContainerName(), getName(), attributeArrayName));
+  }
   // Now ask for the actual AttributeArray from the AttributeMatrix
   if(!doesAttributeArrayExist(attributeArrayName))
   {
@@ -237,7 +237,8 @@ public:
 
   /**
    * @brief Returns the array for a given named array or the equivelant to a
-   * null pointer if the name does not exist.
+   * null pointer if the name does not exist. A zero-copy view (IDataArrayView) is
+   * returned as it is stored, so read-only consumers should use the IDataArray interface.
    * @param name The name of the data array
    */
   IDataArrayShPtrType getAttributeArray(const QString& name) const;
@@ -249,15 +250,24 @@ public:
    */
   IDataArrayShPtrType getAttributeArray(const DataArrayPath& path) const;
 
+  /**
+   * @brief Returns the named array as an owning array the caller may write into. A zero-copy
+   * view (IDataArrayView) stored under that name is replaced in place by an owning copy of its
+   * values, and views in this AttributeMatrix that read from the named array take their own copy
+   * first so a write does not show through them.
+   * @param name The name of the data array
+   */
+  IDataArrayShPtrType getOwnedAttributeArray(const QString& name) const;
+
   /**
    * @brief returns a IDataArray based object that is stored in the attribute matrix by a
-   * given name.
+   * given name. A typed array can be written into, so this goes through getOwnedAttributeArray.
    * @param name The name of the array
    */
   template <class ArrayType>
   typename ArrayType::Pointer getAttributeArrayAs(const QString& name) const
   {
-    IDataArrayShPtrType iDataArray = getAttributeArray(name);
+    IDataArrayShPtrType iDataArray = getOwnedAttributeArray(name);
     return std::dynamic_pointer_cast<ArrayType>(iDataArray);
   }
 
@@ -342,6 +352,10 @@ public:
         filter->setErrorCondition(err, ss);
       }
     }
+    if(filter && !attributeArrayName.isEmpty())
+    {
+      filter->addPrereqPath(DataArrayPath(getParentPath().getDataContainerName(), getName(), attributeArrayName));
+    }
     // Now ask for the actual AttributeArray from the AttributeMatrix
     if(!doesAttributeArrayExist(attributeArrayName))
     {
@@ -364,7 +378,7 @@ public:
       }
     }
 
-    IDataArrayShPtrType iDataArray = getAttributeArray(attributeArrayName);
+    IDataArrayShPtrType iDataArray = getOwnedAttributeArray(attributeArrayName);
     attributeArray = std::dynamic_pointer_cast<ArrayType>(iDataArray);
     if(nullptr == attributeArray.get() && filter)
     {
@@ -377,7 +391,8 @@ public:
   }
 
   /**
-   * @brief getExistingPrereqArray
+   * @brief getExistingPrereqArray Returns the named array for reading. A zero-copy view is returned
+   * as it is stored.
    * @param filter
    * @param attributeArrayName
    * @param err
@@ -479,7 +494,9 @@ public:
   }
 
   /**
-   * @brief dataArrayCompatibility
+   * @brief dataArrayCompatibility Checks the named array against the requested type, the tuple count
+   * of this AttributeMatrix and numComp. The checks go through the IDataArray interface so a zero-copy
+   * view is validated without being materialized.
    * @param arrayName
    * @param numComp
    * @param filter
@@ -489,18 +506,19 @@ public:
   bool dataArrayCompatibility(const QString& arrayName, int numComp, AbstractFilter* filter) const
   {
     // Make sure the types are the same
-    IDataArrayShPtrType ida = getAttributeArray(arrayName);
-    typename ArrayType::Pointer targetDestArray = std::dynamic_pointer_cast<ArrayType>(ida);
-    if(targetDestArray.get() == nullptr)
+    IDataArrayShPtrType targetDestArray = getAttributeArray(arrayName);
+    typename ArrayType::Pointer validTargetArray = ArrayType::CreateArray(1, std::string("JUNK_INTERNAL_ARRAY"), false);
+    if(nullptr == std::dynamic_pointer_cast<ArrayType>(targetDestArray) && targetDestArray->getTypeAsString() != validTargetArray->getTypeAsString())
     {
       if(nullptr != filter)
       {
-        typename ArrayType::Pointer validTargetArray = ArrayType::CreateArray(1, std::string("JUNK_INTERNAL_ARRAY"), false);
-        IDataArrayShPtrType srcArray = getAttributeArray(arrayName);
-        QString srcDesc = srcArray->getTypeAsString();
+        QString srcDesc = targetDestArray->getTypeAsString();
         QString desc = validTargetArray->getTypeAsString();
-        QString ss =
-            QObject::tr("The Filter '%1' requires an array of type '%2' but the data array '%3' has a type of '%4'").arg(filter->getHumanLabel()).arg(desc).arg(srcArray->getName()).arg(srcDesc);
+        QString ss = QObject::tr("The Filter '%1' requires an array of type '%2' but the data array '%3' has a type of '%4'")
+                         .arg(filter->getHumanLabel())
+                         .arg(desc)
+                         .arg(targetDestArray->getName())
+                         .arg(srcDesc);
         filter->setErrorCondition(-501, ss);
       }
       return false;
@@ -535,25 +553,6 @@ public:
       }
       return false;
     }
-    // Make sure we can downcast to the proper type
-    typename ArrayType::Pointer array = std::dynamic_pointer_cast<ArrayType>(targetDestArray);
-    if(nullptr == array.get())
-    {
-      typename ArrayType::Pointer dat = ArrayType::CreateArray(1, std::string("JUNK-INTERNAL-USE-ONLY"), true);
-      QString ss = QObject::tr(" - The filter requested an array named '%1' with type '%2' from the filter '%3'.\n"
-                               "An Array with name '%4' is stored in the %5 but is of type %6\n")
-                       .arg(arrayName)
-                       .arg(dat->getTypeAsString())
-                       .arg(getNameOfClass())
-                       .arg(arrayName)
-                       .arg(getNameOfClass())
-                       .arg(targetDestArray->getTypeAsString());
-      if(nullptr != filter)
-      {
-        filter->setErrorCondition(-504, ss);
-      }
-      return false;
-    }
     return true;
   }
 
@@ -673,6 +672,13 @@ private:
   std::vector<size_t> m_TupleDims;
   AttributeMatrix::Type m_Type = {};
 
+  /**
+   * @brief Replaces every view in this AttributeMatrix that reads from the given array
+   * with an owning copy of its values
+   * @param array
+   */
+  void materializeViewsOf(const IDataArrayShPtrType& array);
+
   AttributeMatrix(const AttributeMatrix&);
   void operator=(const AttributeMatrix&);
 };
@@ -264,13 +264,10 @@ void AttributeMatrixProxy::updatePath(DataArrayPath::RenameType renamePath)
 // -----------------------------------------------------------------------------
 DataArrayProxy& AttributeMatrixProxy::getDataArrayProxy(const QString& name)
 {
-  for(QMap<QString, DataArrayProxy>::iterator iter = m_DataArrays.begin(); iter != m_DataArrays.end(); ++iter) // DataArray Level
+  QMap<QString, DataArrayProxy>::iterator iter = m_DataArrays.find(name);
+  if(iter != m_DataArrays.end())
   {
-    DataArrayProxy& dataArray = iter.value();
-    if(dataArray.getName() == name)
-    {
-      return dataArray;
-    }
+    return iter.value();
   }
 
   DataArrayProxy proxy;
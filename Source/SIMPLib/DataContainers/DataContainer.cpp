@@ -797,6 +797,10 @@ AttributeMatrixShPtr DataContainer::getPrereqAttributeMatrix(AbstractFilter* fil
     }
     return attributeMatrix;
   }
+  if(filter != nullptr)
+  {
+    filter->addPrereqPath(DataArrayPath(getName(), attributeMatrixName, ""));
+  }
   // Now attempt to get the AttributeMatrix which could still come back nullptr because the name does not match.
   attributeMatrix = getAttributeMatrix(attributeMatrixName);
   if(nullptr == attributeMatrix.get())
@@ -762,18 +762,17 @@ DataContainerShPtr DataContainerArray::getPrereqDataContainer(AbstractFilter* fi
 // -----------------------------------------------------------------------------
 DataContainerShPtr DataContainerArray::getPrereqDataContainer(AbstractFilter* filter, const QString& name, bool createIfNotExists)
 {
-  DataContainerShPtr dc = getDataContainer(name);
-  if(nullptr == dc.get() && !createIfNotExists)
+  if(!createIfNotExists)
   {
     if(filter)
     {
-      QString ss = "The DataContainer Object with the specific name '" + name + "' was not available.";
-      filter->setErrorCondition(-999, ss);
+      filter->addPrereqPath(DataArrayPath(name, "", ""));
     }
-    return dc;
+    return findPrereqDataContainer(filter, name);
   }
 
-  if(nullptr != dc && createIfNotExists)
+  DataContainerShPtr dc = getDataContainer(name);
+  if(nullptr != dc)
   {
     DataContainerShPtr dataContainer = DataContainer::New(name); // Create a new Data Container
     addOrReplaceDataContainer(dataContainer);                    // Put the new DataContainer into the array
@@ -783,6 +782,18 @@ DataContainerShPtr DataContainerArray::getPrereqDataContainer(AbstractFilter* fi
   return dc;
 }
 
+// -----------------------------------------------------------------------------
+DataContainerShPtr DataContainerArray::findPrereqDataContainer(AbstractFilter* filter, const QString& name) const
+{
+  DataContainerShPtr dc = getDataContainer(name);
+  if(nullptr == dc.get() && filter)
+  {
+    QString ss = "The DataContainer Object with the specific name '" + name + "' was not available.";
+    filter->setErrorCondition(-999, ss);
+  }
+  return dc;
+}
+
 // -----------------------------------------------------------------------------
 DataContainerShPtr DataContainerArray::createNonPrereqDataContainer(AbstractFilter* filter, const DataArrayPath& dap, RenameDataPath::DataID_t id)
 {
@@ -833,9 +844,13 @@ AttributeMatrix::Pointer DataContainerArray::getPrereqAttributeMatrixFromPath(Ab
 {
   // First try to get the Parent DataContainer. If an error occurs the error message will have been set
   // so just return a nullptr shared pointer
-  DataContainerShPtr dc = getPrereqDataContainer(filter, path.getDataContainerName(), false);
+  DataContainerShPtr dc = findPrereqDataContainer(filter, path.getDataContainerName());
   if(nullptr == dc)
   {
+    if(filter)
+    {
+      filter->addPrereqPath(DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), ""));
+    }
     return AttributeMatrix::NullPointer();
   }
 
@@ -919,6 +934,11 @@ IDataArray::Pointer DataContainerArray::getPrereqIDataArrayFromPath(AbstractFilt
     return dataArray;
   }
 
+  if(filter)
+  {
+    filter->addPrereqPath(path);
+  }
+
   QString dcName = path.getDataContainerName();
   QString amName = path.getAttributeMatrixName();
   QString daName = path.getDataArrayName();
@@ -410,7 +410,7 @@ public:
   typename GeometryType::Pointer getPrereqGeometryFromDataContainer(AbstractFilter* filter, const QString& dcName)
   {
     typename GeometryType::Pointer geom = GeometryType::NullPointer();
-    DataContainerShPtr dc = getPrereqDataContainer(filter, dcName, false);
+    DataContainerShPtr dc = findPrereqDataContainer(filter, dcName);
     if(nullptr == dc)
     {
       return geom;
@@ -430,7 +430,7 @@ public:
   typename GeometryType::Pointer getPrereqGeometryFromDataContainer(AbstractFilter* filter, const DataArrayPath& path)
   {
     typename GeometryType::Pointer geom = GeometryType::NullPointer();
-    DataContainerShPtr dc = getPrereqDataContainer(filter, path.getDataContainerName(), false);
+    DataContainerShPtr dc = findPrereqDataContainer(filter, path.getDataContainerName());
     if(nullptr == dc)
     {
       return geom;
@@ -484,6 +484,11 @@ public:
       return dataArray;
     }
 
+    if(filter)
+    {
+      filter->addPrereqPath(path);
+    }
+
     QString dcName = path.getDataContainerName();
     QString amName = path.getAttributeMatrixName();
     QString daName = path.getDataArrayName();
@@ -677,6 +682,16 @@ private:
    */
   void setMontageTileFromDataContainerName(AbstractFilter* filter, size_t row, size_t col, size_t depth, const GridMontage::Pointer& montage, const QString& dcName);
 
+  /**
+   * @brief Returns the DataContainer with the given name and sets an error on the filter if it does not
+   * exist.  Unlike getPrereqDataContainer, the DataContainer is not recorded as an input of the filter,
+   * so looking up a geometry or one of its AttributeMatrices does not claim all of its arrays.
+   * @param filter
+   * @param name
+   * @return
+   */
+  DataContainerShPtr findPrereqDataContainer(AbstractFilter* filter, const QString& name) const;
+
 public:
   DataContainerArray(const DataContainerArray&) = delete;            // Copy Constructor Not Implemented
   DataContainerArray(DataContainerArray&&) = delete;                 // Move Constructor Not Implemented
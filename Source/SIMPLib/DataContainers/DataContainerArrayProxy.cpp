@@ -429,17 +429,8 @@ DataContainerArrayProxy DataContainerArrayProxy::MergeProxies(DataContainerArray
 // -----------------------------------------------------------------------------
 bool DataContainerArrayProxy::contains(const QString& name)
 {
-  QList<DataContainerProxy> dcProxies = m_DataContainers.values();
-  QListIterator<DataContainerProxy> iter(dcProxies);
-  while(iter.hasNext())
-  {
-    const DataContainerProxy dc = iter.next();
-    if(dc.getName() == name)
-    {
-      return true;
-    }
-  }
-  return false;
+  // DataContainerProxies are keyed by their name
+  return m_DataContainers.contains(name);
 }
 
 // -----------------------------------------------------------------------------
@@ -447,13 +438,10 @@ bool DataContainerArrayProxy::contains(const QString& name)
 // -----------------------------------------------------------------------------
 DataContainerProxy& DataContainerArrayProxy::getDataContainerProxy(const QString& name)
 {
-  for(QMap<QString, DataContainerProxy>::iterator dcIter = m_DataContainers.begin(); dcIter != m_DataContainers.end(); ++dcIter) // DataContainer Level
+  QMap<QString, DataContainerProxy>::iterator dcIter = m_DataContainers.find(name);
+  if(dcIter != m_DataContainers.end())
   {
-    DataContainerProxy& dc = dcIter.value();
-    if(dc.getName() == name)
-    {
-      return dc;
-    }
+    return dcIter.value();
   }
 
   DataContainerProxy proxy(name);
@@ -321,13 +321,10 @@ void DataContainerProxy::toggleFlag()
 // -----------------------------------------------------------------------------
 AttributeMatrixProxy& DataContainerProxy::getAttributeMatrixProxy(const QString& name)
 {
-  for(QMap<QString, AttributeMatrixProxy>::iterator amIter = m_AttributeMatrices.begin(); amIter != m_AttributeMatrices.end(); ++amIter) // AttributeMatrix Level
+  QMap<QString, AttributeMatrixProxy>::iterator amIter = m_AttributeMatrices.find(name);
+  if(amIter != m_AttributeMatrices.end())
   {
-    AttributeMatrixProxy& am = amIter.value();
-    if(am.getName() == name)
-    {
-      return am;
-    }
+    return amIter.value();
   }
 
   AttributeMatrixProxy proxy(name);
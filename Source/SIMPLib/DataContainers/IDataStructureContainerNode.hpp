@@ -38,6 +38,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "IDataStructureNode.h"
@@ -60,6 +61,51 @@ public:
 
 private:
   ChildCollection m_ChildrenNodes;
+  // Maps the name hash of every child to its position in m_ChildrenNodes
+  std::unordered_map<HashType, size_t> m_ChildIndex;
+
+  /**
+   * @brief Returns the position of the child with the given name hash or the number of
+   * children if there is no such child.
+   * @param nameHash
+   * @return
+   */
+  size_t indexOfHash(HashType nameHash) const
+  {
+    auto iter = m_ChildIndex.find(nameHash);
+    if(iter == m_ChildIndex.end())
+    {
+      return m_ChildrenNodes.size();
+    }
+    return iter->second;
+  }
+
+  /**
+   * @brief Rebuilds the lookup entries of the children from the given position on. Needed
+   * after children were removed because the following children moved forward.
+   * @param first
+   */
+  void reindexChildren(size_t first)
+  {
+    for(size_t i = first; i < m_ChildrenNodes.size(); i++)
+    {
+      m_ChildIndex[m_ChildrenNodes[i]->getNameHash()] = i;
+    }
+  }
+
+  /**
+   * @brief Removes the child at the given position from the collection and the lookup.
+   * @param index
+   * @return
+   */
+  ChildShPtr eraseAt(size_t index)
+  {
+    ChildShPtr child = m_ChildrenNodes[index];
+    m_ChildIndex.erase(child->getNameHash());
+    m_ChildrenNodes.erase(m_ChildrenNodes.begin() + index);
+    reindexChildren(index);
+    return child;
+  }
 
 protected:
 public:
@@ -210,7 +256,10 @@ public:
    */
   constexpr void clear() noexcept
   {
-    auto children = getChildren();
+    // Empty the collection first so that each child's removeChildNode callback is a single failed lookup
+    ChildCollection children;
+    children.swap(m_ChildrenNodes);
+    m_ChildIndex.clear();
     for(auto& child : children)
     {
       if(child != nullptr)
@@ -218,7 +267,6 @@ public:
         destroyParentConnection(child.get());
       }
     }
-    m_ChildrenNodes.clear();
   }
 
   /**
@@ -229,16 +277,7 @@ public:
    */
   constexpr iterator find(const QString& name)
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
-    {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
-    }
-
-    return end();
+    return begin() + indexOfHash(CreateStringHash(name));
   }
 
   /**
@@ -249,16 +288,7 @@ public:
    */
   constexpr const_iterator find(const QString& name) const
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
-    {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
-    }
-
-    return cend();
+    return cbegin() + indexOfHash(CreateStringHash(name));
   }
 
   /**
@@ -269,17 +299,12 @@ public:
    */
   constexpr ChildShPtr getChildByName(const QString& name) const
   {
-    HashType nameHash = CreateStringHash(name);
-
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    size_t index = indexOfHash(CreateStringHash(name));
+    if(index == m_ChildrenNodes.size())
     {
-      if(child->checkNameHash(nameHash))
-      {
-        return child;
-      }
+      return nullptr;
     }
-    return nullptr;
+    return m_ChildrenNodes[index];
   }
 
   /**
@@ -290,7 +315,7 @@ public:
    */
   constexpr bool contains(const QString& name) const
   {
-    return getChildByName(name) != nullptr;
+    return m_ChildIndex.count(CreateStringHash(name)) != 0;
   }
 
   /**
@@ -301,15 +326,12 @@ public:
    */
   constexpr bool contains(const ChildShPtr& obj) const
   {
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    if(obj == nullptr)
     {
-      if(child == obj)
-      {
-        return true;
-      }
+      return false;
     }
-    return false;
+    size_t index = indexOfHash(obj->getNameHash());
+    return index != m_ChildrenNodes.size() && m_ChildrenNodes[index] == obj;
   }
 
   /**
@@ -320,12 +342,12 @@ public:
    */
   constexpr int64_t getIndex(const QString& name) const
   {
-    auto iter = find(name);
-    if(iter == cend())
+    size_t index = indexOfHash(CreateStringHash(name));
+    if(index == m_ChildrenNodes.size())
     {
       return -1;
     }
-    return iter - begin();
+    return static_cast<int64_t>(index);
   }
 
   /**
@@ -385,6 +407,7 @@ public:
     }
     typename ChildCollection::size_type size = m_ChildrenNodes.size();
     m_ChildrenNodes.push_back(node);
+    m_ChildIndex[node->getNameHash()] = size;
 
     createParentConnection(node.get(), this);
     return (size != m_ChildrenNodes.size());
@@ -417,19 +440,66 @@ public:
       }
     }
 
+    m_ChildIndex[node->getNameHash()] = m_ChildrenNodes.size();
     m_ChildrenNodes.push_back(node);
     createParentConnection(node.get(), this);
     return true;
   }
 
+  /**
+   * @brief Lists the given IDataStructureNode as a child without becoming its parent.  The node
+   * stays owned by the container it already belongs to, so it can be shared by several containers
+   * without being removed from its own.  Renaming a shared node renames it in its owner.  If a
+   * child already exists with the given name, it is removed.
+   * @param node
+   * @return success
+   */
+  bool insertOrAssignShared(const ChildShPtr& node)
+  {
+    if(node.get() == nullptr)
+    {
+      return false;
+    }
+
+    auto iter = find(node->getName());
+    if(iter != end())
+    {
+      if((*iter) == node)
+      {
+        return true;
+      }
+      erase(iter);
+    }
+
+    m_ChildIndex[node->getNameHash()] = m_ChildrenNodes.size();
+    m_ChildrenNodes.push_back(node);
+    return true;
+  }
+
+  /**
+   * @brief Replaces the child at the given iterator with the given node while keeping its position
+   * in the children collection.
+   * @param iter
+   * @param node
+   */
+  void replace(iterator iter, const ChildShPtr& node)
+  {
+    size_t index = static_cast<size_t>(iter - begin());
+    ChildShPtr child = (*iter);
+    m_ChildIndex.erase(child->getNameHash());
+    (*iter) = node;
+    m_ChildIndex[node->getNameHash()] = index;
+    destroyParentConnection(child.get());
+    createParentConnection(node.get(), this);
+  }
+
   /**
    * @brief Erases the child at the given iterator
    * @param iter
    */
   void erase(iterator iter)
   {
-    ChildShPtr child = (*iter);
-    m_ChildrenNodes.erase(iter);
+    ChildShPtr child = eraseAt(static_cast<size_t>(iter - begin()));
     destroyParentConnection(child.get());
   }
 
@@ -445,16 +515,27 @@ public:
       return NullPointer();
     }
 
-    for(auto iter = m_ChildrenNodes.begin(); iter != m_ChildrenNodes.end(); ++iter)
+    size_t index = indexOfHash(rmChild->getNameHash());
+    if(index == m_ChildrenNodes.size() || m_ChildrenNodes[index].get() != rmChild)
     {
-      if((*iter).get() == rmChild)
-      {
-        ChildShPtr ptr = *iter;
-        m_ChildrenNodes.erase(iter);
-        return ptr;
-      }
+      return NullPointer();
     }
+    return eraseAt(index);
+  }
 
-    return NullPointer();
+  /**
+   * @brief Moves the lookup entry of a renamed child from its old name to its new one.
+   * @param child
+   * @param oldNameHash
+   */
+  void childRenamed(const IDataStructureNode* child, HashType oldNameHash) override
+  {
+    size_t index = indexOfHash(oldNameHash);
+    if(index == m_ChildrenNodes.size() || m_ChildrenNodes[index].get() != child)
+    {
+      return;
+    }
+    m_ChildIndex.erase(oldNameHash);
+    m_ChildIndex[child->getNameHash()] = index;
   }
 };
@@ -36,6 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace
 {
@@ -53,10 +54,10 @@ void checkName(const QString& name)
 // -----------------------------------------------------------------------------
 IDataStructureNode::HashType IDataStructureNode::CreateStringHash(const QString& string)
 {
-  std::hash<std::string> hashFn;
-  std::string stdStr = std::string(string.toStdString());
-  HashType hash = hashFn(stdStr);
-  return hash;
+  // Hash the UTF-16 storage in place; converting to std::string allocated on every lookup
+  std::hash<std::u16string_view> hashFn;
+  std::u16string_view view(reinterpret_cast<const char16_t*>(string.utf16()), static_cast<size_t>(string.size()));
+  return hashFn(view);
 }
 
 // -----------------------------------------------------------------------------
@@ -123,8 +124,10 @@ bool IDataStructureNode::setName(const QString& newName)
   }
   else if(!m_Parent->hasChildWithName(newName))
   {
+    HashType oldNameHash = m_NameHash;
     m_Name = newName;
     updateNameHash();
+    m_Parent->childRenamed(this, oldNameHash);
     return true;
   }
 
@@ -195,7 +198,11 @@ void AbstractDataStructureContainer::createParentConnection(IDataStructureNode*
 // -----------------------------------------------------------------------------
 void AbstractDataStructureContainer::destroyParentConnection(IDataStructureNode* child) const
 {
-  child->clearParentNode();
+  // Children listed through insertOrAssignShared belong to another container
+  if(child->getParentNode() == this)
+  {
+    child->clearParentNode();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -134,6 +134,15 @@ public:
     return m_NameHash == nameHash;
   }
 
+  /**
+   * @brief Returns the hash of the node's name.
+   * @return
+   */
+  HashType getNameHash() const
+  {
+    return m_NameHash;
+  }
+
   /**
    * @brief Returns the node's name.
    * @return
@@ -201,6 +210,14 @@ public:
    */
   virtual bool hasChildWithName(const QString& name) const = 0;
 
+  /**
+   * @brief Called after one of the container's children has been renamed so that
+   * the container can update its name lookup.
+   * @param child
+   * @param oldNameHash The hash of the child's previous name
+   */
+  virtual void childRenamed(const IDataStructureNode* child, HashType oldNameHash) = 0;
+
   /**
    * @brief Removes the target node from the container's list of children.
    * Returns the removed node as a shared pointer.
@@ -219,7 +236,7 @@ protected:
   void createParentConnection(IDataStructureNode* child, AbstractDataStructureContainer* parent) const;
 
   /**
-   * @brief Clears the child's parent pointer.  This does not remove the child from the parent's collection.
+   * @brief Clears the child's parent pointer if this is its parent.  This does not remove the child from the parent's collection.
    * THIS METHOD IS ONLY USED BY IDataStructureNode<T> AND SHOULD NOT BE USED BY ANY CLASS THAT DERIVES FROM IT.
    * @param child
    */
@@ -0,0 +1,191 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataStructureLookupTest
+{
+  const size_t k_NumArrays = 20000;
+
+public:
+  DataStructureLookupTest() = default;
+  virtual ~DataStructureLookupTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure(size_t numArrays)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({1}, "AttributeMatrix", AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(am);
+    for(size_t i = 0; i < numArrays; i++)
+    {
+      am->insertOrAssign(Int32ArrayType::CreateArray(1, QString("Array_%1").arg(i), true));
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every child must be found at the position it occupies in the children collection
+  // -----------------------------------------------------------------------------
+  bool checkChildIndex(const AttributeMatrix::Pointer& am)
+  {
+    const auto& children = am->getChildren();
+    for(size_t i = 0; i < children.size(); i++)
+    {
+      if(am->getIndex(children[i]->getName()) != static_cast<int64_t>(i) || am->getChildByName(children[i]->getName()) != children[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChildIndex()
+  {
+    DataContainerArray::Pointer dca = createDataStructure(10);
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am)
+    DREAM3D_REQUIRE_EQUAL(am->size(), 10)
+    DREAM3D_REQUIRE(checkChildIndex(am))
+
+    // Removing from the middle moves the following children forward
+    IDataArray::Pointer removed = am->removeAttributeArray("Array_3");
+    DREAM3D_REQUIRE_VALID_POINTER(removed)
+    DREAM3D_REQUIRE(!am->contains("Array_3"))
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_4"), 3)
+    DREAM3D_REQUIRE(checkChildIndex(am))
+
+    // Renaming moves the lookup entry
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("Array_5", "Renamed"), SUCCESS)
+    DREAM3D_REQUIRE(!am->contains("Array_5"))
+    DREAM3D_REQUIRE(am->contains("Renamed"))
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("Renamed", "Array_6"), NEW_EXISTS)
+    DREAM3D_REQUIRE(checkChildIndex(am))
+
+    // Replacing an array keeps the name but swaps the child
+    Int32ArrayType::Pointer replacement = Int32ArrayType::CreateArray(1, QString("Array_0"), true);
+    am->insertOrAssign(replacement);
+    DREAM3D_REQUIRE(am->getAttributeArray("Array_0") == replacement)
+    DREAM3D_REQUIRE(checkChildIndex(am))
+
+    // Inserting the array into another container takes it out of this one
+    AttributeMatrix::Pointer other = AttributeMatrix::New({1}, "Other", AttributeMatrix::Type::Generic);
+    IDataArray::Pointer moved = am->getAttributeArray("Array_1");
+    other->insertOrAssign(moved);
+    DREAM3D_REQUIRE(!am->contains("Array_1"))
+    DREAM3D_REQUIRE(other->getAttributeArray("Array_1") == moved)
+    DREAM3D_REQUIRE(checkChildIndex(am))
+
+    am->clear();
+    DREAM3D_REQUIRE_EQUAL(am->size(), 0)
+    DREAM3D_REQUIRE(!am->contains("Array_2"))
+    DREAM3D_REQUIRE(am->insertOrAssign(Int32ArrayType::CreateArray(1, QString("Array_2"), true)))
+    DREAM3D_REQUIRE(checkChildIndex(am))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLookupTiming()
+  {
+    auto start = std::chrono::steady_clock::now();
+    DataContainerArray::Pointer dca = createDataStructure(k_NumArrays);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "\tInserting " << k_NumArrays << " arrays: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " milliseconds" << std::endl;
+
+    // Resolve every path the way preflight does
+    start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for(size_t i = 0; i < k_NumArrays; i++)
+    {
+      DataArrayPath path("DataContainer", "AttributeMatrix", QString("Array_%1").arg(i));
+      if(nullptr != dca->getPrereqIDataArrayFromPath(nullptr, path))
+      {
+        found++;
+      }
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "\tResolving " << k_NumArrays << " DataArrayPaths: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " milliseconds" << std::endl;
+    DREAM3D_REQUIRE_EQUAL(found, k_NumArrays)
+
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < k_NumArrays; i++)
+    {
+      am->renameAttributeArray(QString("Array_%1").arg(i), QString("Renamed_%1").arg(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "\tRenaming " << k_NumArrays << " arrays: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " milliseconds" << std::endl;
+    DREAM3D_REQUIRE(am->contains(QString("Renamed_%1").arg(k_NumArrays - 1)))
+
+    start = std::chrono::steady_clock::now();
+    am->clear();
+    end = std::chrono::steady_clock::now();
+    std::cout << "\tClearing " << k_NumArrays << " arrays: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " milliseconds" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataStructureLookupTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestChildIndex())
+    DREAM3D_REGISTER_TEST(TestLookupTiming())
+  }
+
+private:
+  DataStructureLookupTest(const DataStructureLookupTest&); // Copy Constructor Not Implemented
+  void operator=(const DataStructureLookupTest&);          // Move assignment Not Implemented
+};
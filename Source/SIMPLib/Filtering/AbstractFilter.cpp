@@ -35,6 +35,8 @@
 
 #include "AbstractFilter.h"
 
+#include <algorithm>
+
 #include <QtCore/QDebug>
 #include <QtCore/QTextStream>
 
@@ -313,6 +315,29 @@ std::list<DataArrayPath> AbstractFilter::getDeletedPaths()
   return std::list<DataArrayPath>();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::list<DataArrayPath> AbstractFilter::getPrereqPaths() const
+{
+  return m_PrereqPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::addPrereqPath(const DataArrayPath& path)
+{
+  if(path.getDataContainerName().isEmpty())
+  {
+    return;
+  }
+  if(std::find(m_PrereqPaths.begin(), m_PrereqPaths.end(), path) == m_PrereqPaths.end())
+  {
+    m_PrereqPaths.push_back(path);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -621,6 +646,14 @@ void AbstractFilter::clearRenamedPaths()
   m_RenamedPaths.clear();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::clearPrereqPaths()
+{
+  m_PrereqPaths.clear();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -417,6 +417,21 @@ public:
    */
   virtual std::list<DataArrayPath> getDeletedPaths();
 
+  /**
+   * @brief Returns the DataArrayPaths the filter requested through the getPrereq* methods of the
+   * DataContainerArray, DataContainer and AttributeMatrix, whether or not they existed.
+   * This method requires preflight() or execute() to have already run.
+   * @return
+   */
+  std::list<DataArrayPath> getPrereqPaths() const;
+
+  /**
+   * @brief Records a DataArrayPath the filter requested as an input.  This is called by the
+   * getPrereq* methods of the data structure.
+   * @param path
+   */
+  void addPrereqPath(const DataArrayPath& path);
+
   /**
    * @brief Returns a list of DataArrayPaths that have been renamed along with their corresponding renamed value
    * @return
@@ -482,6 +497,11 @@ public:
    */
   void clearRenamedPaths();
 
+  /**
+   * @brief Clears the prerequisite paths recorded for the filter instance.
+   */
+  void clearPrereqPaths();
+
 Q_SIGNALS:
   /**
    * @brief Signal is emitted when filter has completed the execute() method
@@ -596,6 +616,7 @@ private:
 
   std::map<RenameDataPath::DataID_t, DataArrayPath> m_CreatedPaths;
   DataArrayPath::RenameContainer m_RenamedPaths;
+  std::list<DataArrayPath> m_PrereqPaths;
 
 public:
   AbstractFilter(const AbstractFilter&) = delete;            // Copy Constructor Not Implemented
@@ -0,0 +1,284 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ComparisonEvaluator.h"
+
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/Filtering/ComparisonSet.h"
+#include "SIMPLib/Filtering/ComparisonValue.h"
+#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+
+namespace
+{
+/**
+ * @brief Creates the kernel comparing the array against a value if the array holds values of type T. The
+ * value is cast to the array type first, the same way ThresholdFilterHelper does.
+ * @return false if the array is not a DataArray<T>
+ */
+template <typename T>
+bool CreateLeafKernel(const IDataArray::Pointer& inputArray, SIMPL::Comparison::Enumeration compType, double compValue, std::function<void(size_t, size_t, uint8_t*)>& kernel)
+{
+  size_t stride = 1;
+  const T* data = ThresholdFilterHelper::GetScalarData<T>(inputArray, stride);
+  if(nullptr == data)
+  {
+    return false;
+  }
+  T value = static_cast<T>(compValue);
+  kernel = [data, stride, compType, value](size_t start, size_t count, uint8_t* output) {
+    ThresholdFilterHelper::CompareStridedRange(compType, value, data + start * stride, stride, count, output);
+  };
+  return true;
+}
+
+/**
+ * @brief Returns true if every value of the block equals 0, or every value equals 1 when ones is true
+ */
+bool IsUniform(const uint8_t* mask, size_t count, bool ones)
+{
+  uint8_t acc = ones ? 1 : 0;
+  if(ones)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      acc &= mask[i];
+    }
+    return acc == 1;
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    acc |= mask[i];
+  }
+  return acc == 0;
+}
+
+/**
+ * @brief Flips every value of the block
+ */
+void InvertBlock(uint8_t* mask, size_t count)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    mask[i] ^= 1;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComparisonEvaluator::ComparisonEvaluator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComparisonEvaluator::~ComparisonEvaluator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComparisonEvaluator::compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix& attrMat)
+{
+  m_Nodes.clear();
+  m_Depth = 0;
+  m_InvalidArrayName.clear();
+  m_Invert = inputs.shouldInvert();
+  return compileComparisons(inputs.getInputs(), attrMat, m_Nodes, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComparisonEvaluator::compileComparisons(const QVector<AbstractComparison::Pointer>& comparisons, const AttributeMatrix& attrMat, std::vector<Node>& nodes, size_t depth)
+{
+  m_Depth = std::max(m_Depth, depth);
+  for(const AbstractComparison::Pointer& comparison : comparisons)
+  {
+    if(ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
+    {
+      Node node;
+      node.unionOperator = comparisonSet->getUnionOperator();
+      node.invert = comparisonSet->getInvertComparison();
+      int32_t err = compileComparisons(comparisonSet->getComparisons(), attrMat, node.children, depth + 1);
+      if(err < 0)
+      {
+        return err;
+      }
+      nodes.push_back(std::move(node));
+    }
+    else if(ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison))
+    {
+      IDataArray::Pointer inputArray = attrMat.getAttributeArray(comparisonValue->getAttributeArrayName());
+      if(nullptr == inputArray)
+      {
+        m_InvalidArrayName = comparisonValue->getAttributeArrayName();
+        return -1;
+      }
+
+      Node node;
+      node.unionOperator = comparisonValue->getUnionOperator();
+      auto compType = static_cast<SIMPL::Comparison::Enumeration>(comparisonValue->getCompOperator());
+      double compValue = comparisonValue->getCompValue();
+      bool created = CreateLeafKernel<float>(inputArray, compType, compValue, node.leaf) || CreateLeafKernel<double>(inputArray, compType, compValue, node.leaf) ||
+                     CreateLeafKernel<int8_t>(inputArray, compType, compValue, node.leaf) || CreateLeafKernel<uint8_t>(inputArray, compType, compValue, node.leaf) ||
+                     CreateLeafKernel<int16_t>(inputArray, compType, compValue, node.leaf) || CreateLeafKernel<uint16_t>(inputArray, compType, compValue, node.leaf) ||
+                     CreateLeafKernel<int32_t>(inputArray, compType, compValue, node.leaf) || CreateLeafKernel<uint32_t>(inputArray, compType, compValue, node.leaf) ||
+                     CreateLeafKernel<int64_t>(inputArray, compType, compValue, node.leaf) || CreateLeafKernel<uint64_t>(inputArray, compType, compValue, node.leaf) ||
+                     CreateLeafKernel<bool>(inputArray, compType, compValue, node.leaf);
+      if(!created)
+      {
+        m_InvalidArrayName = comparisonValue->getAttributeArrayName();
+        return -1;
+      }
+      nodes.push_back(std::move(node));
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ComparisonEvaluator::getInvalidArrayName() const
+{
+  return m_InvalidArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComparisonEvaluator::evaluate(BitMaskArray& output) const
+{
+  const size_t numTuples = output.getNumberOfTuples();
+  BitMaskArray::word_type* words = output.getWordPointer(0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, output.getNumberOfWords());
+  dataAlg.execute([this, words, numTuples](const SIMPLRange& range) {
+    static_assert(k_BlockSize % BitMaskArray::k_BitsPerWord == 0, "Blocks must cover whole words");
+    std::vector<uint8_t> buffer(k_BlockSize + getScratchSize());
+    uint8_t* mask = buffer.data();
+    uint8_t* scratch = mask + k_BlockSize;
+    const size_t endTuple = std::min(range.max() * BitMaskArray::k_BitsPerWord, numTuples);
+    for(size_t start = range.min() * BitMaskArray::k_BitsPerWord; start < endTuple; start += k_BlockSize)
+    {
+      const size_t count = std::min(k_BlockSize, endTuple - start);
+      evaluateBlock(start, count, mask, scratch);
+      for(size_t i = 0; i < count; i += BitMaskArray::k_BitsPerWord)
+      {
+        const size_t bits = std::min(BitMaskArray::k_BitsPerWord, count - i);
+        BitMaskArray::word_type word = 0;
+        for(size_t b = 0; b < bits; b++)
+        {
+          word |= static_cast<BitMaskArray::word_type>(mask[i + b] != 0) << b;
+        }
+        words[(start + i) / BitMaskArray::k_BitsPerWord] = word;
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+size_t ComparisonEvaluator::getScratchSize() const
+{
+  return (m_Depth + 1) * k_BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComparisonEvaluator::evaluateBlock(size_t start, size_t count, uint8_t* mask, uint8_t* scratch) const
+{
+  evaluateNodes(m_Nodes, start, count, mask, scratch);
+  if(m_Invert)
+  {
+    InvertBlock(mask, count);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComparisonEvaluator::evaluateNodes(const std::vector<Node>& nodes, size_t start, size_t count, uint8_t* result, uint8_t* scratch) const
+{
+  if(nodes.empty())
+  {
+    std::fill_n(result, count, static_cast<uint8_t>(0));
+    return;
+  }
+
+  for(size_t n = 0; n < nodes.size(); n++)
+  {
+    const Node& node = nodes[n];
+    bool isOr = (SIMPL::Union::Operator_Or == node.unionOperator);
+    // The first comparison initializes the result. After that a clause can only change the block if
+    // the block is not already saturated for its union operator.
+    if(n > 0 && IsUniform(result, count, isOr))
+    {
+      continue;
+    }
+
+    uint8_t* operand = (n == 0) ? result : scratch;
+    if(node.leaf)
+    {
+      node.leaf(start, count, operand);
+    }
+    else
+    {
+      evaluateNodes(node.children, start, count, operand, scratch + k_BlockSize);
+    }
+    if(node.invert)
+    {
+      InvertBlock(operand, count);
+    }
+
+    if(n == 0)
+    {
+      continue;
+    }
+    if(isOr)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] |= operand[i];
+      }
+    }
+    else
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] &= operand[i];
+      }
+    }
+  }
+}
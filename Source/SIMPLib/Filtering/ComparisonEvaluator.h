@@ -0,0 +1,181 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Filtering/AbstractComparison.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+class AttributeMatrix;
+class BitMaskArray;
+class ComparisonInputsAdvanced;
+
+/**
+ * @brief The ComparisonEvaluator class compiles the tree of ComparisonValues and ComparisonSets held by a
+ * ComparisonInputsAdvanced into a single pass over the tuples. The tuples are processed in cache sized blocks;
+ * every comparison of the tree is evaluated for a block before moving on to the next one, so each input array
+ * is read once and the result is written straight into the destination array without any full size
+ * intermediate masks. Blocks are distributed across threads. A clause that cannot change a block (an AND
+ * following an all false block, an OR following an all true block) is skipped for that block.
+ *
+ * The results are identical to evaluating the comparisons one at a time in the order they were given:
+ * the first comparison of a set initializes the set result, every following one is merged with its union
+ * operator and an inverted set flips its own result before it is merged.
+ */
+class SIMPLib_EXPORT ComparisonEvaluator
+{
+public:
+  ComparisonEvaluator();
+  ~ComparisonEvaluator();
+
+  /**
+   * @brief Resolves every ComparisonValue against the arrays of the given AttributeMatrix
+   * @param inputs
+   * @param attrMat
+   * @return Negative value if an array does not exist or is of an unsupported type. getInvalidArrayName() returns its name.
+   */
+  int32_t compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix& attrMat);
+
+  /**
+   * @brief Returns the name of the array that made compile() fail
+   * @return
+   */
+  QString getInvalidArrayName() const;
+
+  /**
+   * @brief Evaluates the compiled comparisons for tuples [0, numTuples) and writes 1 or 0 for each tuple into output
+   * @param output
+   * @param numTuples
+   */
+  template <typename T>
+  void evaluate(T* output, size_t numTuples) const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTuples);
+    dataAlg.execute(EvaluateImpl<T>(this, output));
+  }
+
+  /**
+   * @brief Evaluates the compiled comparisons for every tuple of output and packs the results into its bits.
+   * Threads are handed whole words so no two of them ever write the same word.
+   * @param output
+   */
+  void evaluate(BitMaskArray& output) const;
+
+  /**
+   * @brief Evaluates the compiled comparisons for count tuples starting at start
+   * @param start
+   * @param count Must not be larger than k_BlockSize
+   * @param mask Receives 1 or 0 for each tuple
+   * @param scratch Must hold getScratchSize() values
+   */
+  void evaluateBlock(size_t start, size_t count, uint8_t* mask, uint8_t* scratch) const;
+
+  /**
+   * @brief Returns the number of scratch values evaluateBlock() requires
+   * @return
+   */
+  size_t getScratchSize() const;
+
+  static constexpr size_t k_BlockSize = 4096;
+
+private:
+  using LeafKernel = std::function<void(size_t start, size_t count, uint8_t* output)>;
+
+  struct Node
+  {
+    int unionOperator = SIMPL::Union::Operator_And;
+    bool invert = false;
+    LeafKernel leaf;
+    std::vector<Node> children;
+  };
+
+  std::vector<Node> m_Nodes;
+  bool m_Invert = false;
+  size_t m_Depth = 0;
+  QString m_InvalidArrayName;
+
+  /**
+   * @brief Recursively converts the comparisons into nodes
+   */
+  int32_t compileComparisons(const QVector<AbstractComparison::Pointer>& comparisons, const AttributeMatrix& attrMat, std::vector<Node>& nodes, size_t depth);
+
+  /**
+   * @brief Evaluates one level of the tree into result using scratch for the merged operands
+   */
+  void evaluateNodes(const std::vector<Node>& nodes, size_t start, size_t count, uint8_t* result, uint8_t* scratch) const;
+
+  /**
+   * @brief Evaluates blocks of a subrange and converts them into the destination type
+   */
+  template <typename T>
+  class EvaluateImpl
+  {
+  public:
+    EvaluateImpl(const ComparisonEvaluator* evaluator, T* output)
+    : m_Evaluator(evaluator)
+    , m_Output(output)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      std::vector<uint8_t> buffer(k_BlockSize + m_Evaluator->getScratchSize());
+      uint8_t* mask = buffer.data();
+      uint8_t* scratch = mask + k_BlockSize;
+      for(size_t start = range.min(); start < range.max(); start += k_BlockSize)
+      {
+        size_t count = std::min(k_BlockSize, range.max() - start);
+        m_Evaluator->evaluateBlock(start, count, mask, scratch);
+        T* dest = m_Output + start;
+        for(size_t i = 0; i < count; i++)
+        {
+          dest[i] = static_cast<T>(mask[i]);
+        }
+      }
+    }
+
+  private:
+    const ComparisonEvaluator* m_Evaluator;
+    T* m_Output;
+  };
+
+public:
+  ComparisonEvaluator(const ComparisonEvaluator&) = delete;            // Copy Constructor Not Implemented
+  ComparisonEvaluator(ComparisonEvaluator&&) = delete;                 // Move Constructor Not Implemented
+  ComparisonEvaluator& operator=(const ComparisonEvaluator&) = delete; // Copy Assignment Not Implemented
+  ComparisonEvaluator& operator=(ComparisonEvaluator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,214 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterDataAccess.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <QtCore/QVariant>
+
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ComparisonInputs.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+
+namespace
+{
+void AppendPath(std::vector<DataArrayPath>& paths, const DataArrayPath& path)
+{
+  if(path.getDataContainerName().isEmpty())
+  {
+    return;
+  }
+  if(std::find(paths.begin(), paths.end(), path) == paths.end())
+  {
+    paths.push_back(path);
+  }
+}
+
+/**
+ * @brief Appends the DataArrayPath(s) held by a property value. Returns false if the value is of any other type.
+ */
+bool AppendPaths(std::vector<DataArrayPath>& paths, const QVariant& value)
+{
+  if(value.userType() == qMetaTypeId<DataArrayPath>())
+  {
+    AppendPath(paths, value.value<DataArrayPath>());
+    return true;
+  }
+  if(value.userType() == qMetaTypeId<DataArrayPathVec>())
+  {
+    for(const auto& path : value.value<DataArrayPathVec>())
+    {
+      AppendPath(paths, path);
+    }
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns true if the value selects data by other means than DataArrayPaths, e.g. by names or proxies
+ */
+bool SelectsDataIndirectly(const FilterParameter& parameter, const QVariant& value)
+{
+  if(value.userType() == qMetaTypeId<ComparisonInputs>() || value.userType() == qMetaTypeId<ComparisonInputsAdvanced>() ||
+     value.userType() == qMetaTypeId<DataContainerArrayProxy>())
+  {
+    return true;
+  }
+  return parameter.getCategory() == FilterParameter::Category::RequiredArray;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+FilterDataAccess::FilterDataAccess() = default;
+
+// -----------------------------------------------------------------------------
+FilterDataAccess::FilterDataAccess(std::vector<DataArrayPath> readPaths, std::vector<DataArrayPath> createdPaths, bool readsEverything)
+: m_ReadPaths(std::move(readPaths))
+, m_CreatedPaths(std::move(createdPaths))
+, m_ReadsEverything(readsEverything)
+{
+}
+
+// -----------------------------------------------------------------------------
+FilterDataAccess::~FilterDataAccess() = default;
+
+// -----------------------------------------------------------------------------
+FilterDataAccess FilterDataAccess::Collect(AbstractFilter* filter)
+{
+  std::vector<DataArrayPath> readPaths;
+  std::vector<DataArrayPath> createdPaths;
+  for(const auto& createdPath : filter->getCreatedPaths())
+  {
+    AppendPath(createdPaths, createdPath);
+  }
+
+  // Filters resolve their inputs through the getPrereq* methods, whatever type of parameter names them
+  for(const auto& prereqPath : filter->getPrereqPaths())
+  {
+    AppendPath(readPaths, prereqPath);
+  }
+  const bool hasPrereqPaths = !readPaths.empty();
+
+  bool unknownInputs = false;
+  for(const auto& parameter : filter->getFilterParameters())
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    if(parameter->getCategory() == FilterParameter::Category::CreatedArray)
+    {
+      AppendPaths(createdPaths, value);
+    }
+    else if(!AppendPaths(readPaths, value) && SelectsDataIndirectly(*parameter, value))
+    {
+      unknownInputs = true;
+    }
+  }
+
+  // A created path that is also listed as an input is an output the filter writes, not something it reads
+  readPaths.erase(std::remove_if(readPaths.begin(), readPaths.end(), [&createdPaths](const DataArrayPath& path) { return std::find(createdPaths.begin(), createdPaths.end(), path) != createdPaths.end(); }),
+                  readPaths.end());
+
+  // Without the paths recorded by a preflight, inputs that are not named by DataArrayPaths could be anything
+  bool readsEverything = (readPaths.empty() && createdPaths.empty()) || (unknownInputs && !hasPrereqPaths);
+  return FilterDataAccess(std::move(readPaths), std::move(createdPaths), readsEverything);
+}
+
+// -----------------------------------------------------------------------------
+bool FilterDataAccess::Covers(const DataArrayPath& path, const DataArrayPath& arrayPath)
+{
+  if(path.getDataContainerName() != arrayPath.getDataContainerName())
+  {
+    return false;
+  }
+  if(path.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(path.getAttributeMatrixName() != arrayPath.getAttributeMatrixName())
+  {
+    return false;
+  }
+  return path.getDataArrayName().isEmpty() || path.getDataArrayName() == arrayPath.getDataArrayName();
+}
+
+// -----------------------------------------------------------------------------
+bool FilterDataAccess::reads(const DataArrayPath& arrayPath) const
+{
+  if(m_ReadsEverything)
+  {
+    return true;
+  }
+  return std::any_of(m_ReadPaths.begin(), m_ReadPaths.end(), [&arrayPath](const DataArrayPath& path) { return Covers(path, arrayPath); });
+}
+
+// -----------------------------------------------------------------------------
+bool FilterDataAccess::creates(const DataArrayPath& arrayPath) const
+{
+  return std::any_of(m_CreatedPaths.begin(), m_CreatedPaths.end(), [&arrayPath](const DataArrayPath& path) { return Covers(path, arrayPath); });
+}
+
+// -----------------------------------------------------------------------------
+bool FilterDataAccess::touchesAttributeMatrixOf(const DataArrayPath& arrayPath) const
+{
+  if(m_ReadsEverything)
+  {
+    return true;
+  }
+  auto sameAttributeMatrix = [&arrayPath](const DataArrayPath& path) {
+    if(path.getDataContainerName() != arrayPath.getDataContainerName())
+    {
+      return false;
+    }
+    return path.getAttributeMatrixName().isEmpty() || path.getAttributeMatrixName() == arrayPath.getAttributeMatrixName();
+  };
+  return std::any_of(m_ReadPaths.begin(), m_ReadPaths.end(), sameAttributeMatrix) || std::any_of(m_CreatedPaths.begin(), m_CreatedPaths.end(), sameAttributeMatrix);
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<DataArrayPath>& FilterDataAccess::getReadPaths() const
+{
+  return m_ReadPaths;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<DataArrayPath>& FilterDataAccess::getCreatedPaths() const
+{
+  return m_CreatedPaths;
+}
+
+// -----------------------------------------------------------------------------
+bool FilterDataAccess::getReadsEverything() const
+{
+  return m_ReadsEverything;
+}
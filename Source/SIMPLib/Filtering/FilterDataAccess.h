@@ -0,0 +1,121 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The FilterDataAccess class describes which parts of the data structure a filter reads and creates.
+ * The read paths are the paths the filter requested through the getPrereq* methods during its last preflight
+ * together with the DataArrayPath valued properties of its parameters; a DataContainer or AttributeMatrix path
+ * covers every array below it. A filter that references no path at all, such as a writer, is assumed to read
+ * everything, and so is a filter that selects data by names, proxies or comparison inputs when no preflight
+ * recorded what they resolved to.
+ */
+class SIMPLib_EXPORT FilterDataAccess
+{
+public:
+  FilterDataAccess();
+  FilterDataAccess(std::vector<DataArrayPath> readPaths, std::vector<DataArrayPath> createdPaths, bool readsEverything = false);
+  ~FilterDataAccess();
+
+  FilterDataAccess(const FilterDataAccess&) = default;
+  FilterDataAccess(FilterDataAccess&&) noexcept = default;
+  FilterDataAccess& operator=(const FilterDataAccess&) = default;
+  FilterDataAccess& operator=(FilterDataAccess&&) noexcept = default;
+
+  /**
+   * @brief Collects the paths the filter reads and creates. The prerequisite and created paths recorded by the
+   * last preflight are included when they are available.
+   * @param filter
+   * @return
+   */
+  static FilterDataAccess Collect(AbstractFilter* filter);
+
+  /**
+   * @brief Returns true if the path covers the array path, i.e. every non-empty level of the path matches.
+   * @param path
+   * @param arrayPath
+   * @return
+   */
+  static bool Covers(const DataArrayPath& path, const DataArrayPath& arrayPath);
+
+  /**
+   * @brief Returns true if the filter may read the array at the given path.
+   * @param arrayPath
+   * @return
+   */
+  bool reads(const DataArrayPath& arrayPath) const;
+
+  /**
+   * @brief Returns true if the filter creates the array at the given path.
+   * @param arrayPath
+   * @return
+   */
+  bool creates(const DataArrayPath& arrayPath) const;
+
+  /**
+   * @brief Returns true if the filter may read or create anything in the AttributeMatrix that holds the array at
+   * the given path. Filters routinely work on the sibling arrays of the paths they declare, e.g. when they copy
+   * whole tuples, so this is the test to use before the arrays of an AttributeMatrix are taken away.
+   * @param arrayPath
+   * @return
+   */
+  bool touchesAttributeMatrixOf(const DataArrayPath& arrayPath) const;
+
+  /**
+   * @brief Returns the paths that the filter reads
+   * @return
+   */
+  const std::vector<DataArrayPath>& getReadPaths() const;
+
+  /**
+   * @brief Returns the paths that the filter creates
+   * @return
+   */
+  const std::vector<DataArrayPath>& getCreatedPaths() const;
+
+  /**
+   * @brief Returns true if the filter has to be assumed to read the whole data structure
+   * @return
+   */
+  bool getReadsEverything() const;
+
+private:
+  std::vector<DataArrayPath> m_ReadPaths;
+  std::vector<DataArrayPath> m_CreatedPaths;
+  bool m_ReadsEverything = false;
+};
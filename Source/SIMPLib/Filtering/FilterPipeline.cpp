@@ -35,17 +35,26 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QTextStream>
 #include <QtCore/QDateTime>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/RenameDataPath.h"
 #include "SIMPLib/Filtering/BadFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/MemoryBudgetGovernor.h"
+#include "SIMPLib/Filtering/PipelineCheckpointer.h"
+#include "SIMPLib/Filtering/PipelineLiveness.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
@@ -789,6 +798,7 @@ int FilterPipeline::preflightPipeline()
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
       filter->clearRenamedPaths();
+      filter->clearPrereqPaths();
       filter->preflight();
       disconnectFilterNotifications(filter.get());
 
@@ -894,10 +904,90 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   QTextStream out(&msg);
   out << "Pipeline Start: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
+
+  // Checkpoints let a failed or interrupted execution resume after the last filter that was checkpointed
+  std::unique_ptr<PipelineCheckpointer> checkpointer;
+  size_t resumePosition = 0;
+  if(!m_CheckpointDirectory.isEmpty())
+  {
+    checkpointer = std::make_unique<PipelineCheckpointer>(m_CheckpointDirectory, getPipelineHash());
+    // Snapshots are deep copies; within a memory budget they are written before the next filter runs instead
+    checkpointer->setAsynchronous(m_MemoryBudget == 0);
+    PipelineCheckpointer::Checkpoint checkpoint;
+    if(m_ResumeFromCheckpoint && checkpointer->findLatest(checkpoint))
+    {
+      DataContainerArray::Pointer checkpointDca = checkpointer->read(checkpoint);
+      if(nullptr == checkpointDca)
+      {
+        setWarningCondition(PipelineCheckpointer::k_ReadError, checkpointer->getErrorMessage());
+      }
+      else
+      {
+        m_Dca = checkpointDca;
+        resumePosition = checkpoint.filterIndex + 1;
+        notifyStatusMessage(QObject::tr("Resuming after filter %1 from checkpoint '%2'").arg(resumePosition).arg(checkpoint.filePath));
+      }
+    }
+  }
+
+  std::vector<FilterDataAccess> plan;
+  if(m_MemoryBudget > 0 || m_ReleaseDeadArrays)
+  {
+    plan.reserve(m_Pipeline.size());
+    for(const auto& filt : m_Pipeline)
+    {
+      plan.push_back(filt->getEnabled() ? FilterDataAccess::Collect(filt.get()) : FilterDataAccess());
+    }
+  }
+
+  // Arrays are removed from the data structure right after the last filter that reads them
+  std::unique_ptr<PipelineLiveness> liveness;
+  if(m_ReleaseDeadArrays)
+  {
+    liveness = std::make_unique<PipelineLiveness>(plan);
+    size_t writerIndex = 0;
+    for(const auto& filt : m_Pipeline)
+    {
+      if(nullptr != std::dynamic_pointer_cast<DataContainerWriter>(filt))
+      {
+        liveness->addWriter(writerIndex);
+      }
+      writerIndex++;
+    }
+    liveness->setPinnedPaths(m_PinnedPaths);
+    // The arrays a checkpoint restored that the pipeline created are released like in an uninterrupted run
+    if(resumePosition > 0)
+    {
+      liveness->resumeExecution(*m_Dca, resumePosition - 1);
+    }
+    else
+    {
+      liveness->beginExecution(*m_Dca);
+    }
+  }
+
+  // With a memory budget the arrays are spilled to disk between filters whenever they would exceed it
+  std::unique_ptr<MemoryBudgetGovernor> governor;
+  if(m_MemoryBudget > 0)
+  {
+    governor = std::make_unique<MemoryBudgetGovernor>(m_MemoryBudget, m_ScratchDirectory);
+    governor->setPlan(plan);
+  }
+
   // Start looping through the Pipeline
+  size_t position = 0;
+  auto lastCheckpointTime = std::chrono::steady_clock::now();
   for(const auto& filt : m_Pipeline)
   {
     int filtIndex = filt->getPipelineIndex();
+    if(position < resumePosition)
+    {
+      // The checkpoint already holds the result of this filter
+      position++;
+      Q_EMIT filt->filterCompleted(filt.get());
+      continue;
+    }
+
     QString ss = QObject::tr("[%4] [%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel()).arg(::CreateDateTimeStamp());
     notifyStatusMessage(ss);
 
@@ -907,6 +997,14 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
     if(filt->getEnabled())
     {
       //      filt->setMessagePrefix(ss);
+      if(nullptr != governor)
+      {
+        err = governor->prepare(*m_Dca, position);
+        if(err < 0)
+        {
+          return abortExecution(governor.get(), err, governor->getErrorMessage());
+        }
+      }
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
       setCurrentFilter(filt);
@@ -917,19 +1015,47 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
       if(err < 0)
       {
         ss = QObject::tr("[%4] [%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel().arg(::CreateDateTimeStamp()));
-        setErrorCondition(err, ss);
-
-        notifyProgressMessage(100, "");
-
         Q_EMIT filt->filterCompleted(filt.get());
-        Q_EMIT pipelineFinished();
-        disconnectSignalsSlots();
-        m_State = FilterPipeline::State::Idle;
-        m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
-        return m_Dca;
+        return abortExecution(governor.get(), err, ss);
+      }
+      if(nullptr != liveness)
+      {
+        liveness->releaseDeadArrays(*m_Dca, position);
+      }
+      if(nullptr != governor)
+      {
+        err = governor->release(*m_Dca, position);
+        if(err < 0)
+        {
+          Q_EMIT filt->filterCompleted(filt.get());
+          return abortExecution(governor.get(), err, governor->getErrorMessage());
+        }
+      }
+
+      // There is no point in a checkpoint after the last filter
+      bool isLastFilter = (position + 1 == static_cast<size_t>(m_Pipeline.size()));
+      bool isSelected = std::find(m_CheckpointFilters.begin(), m_CheckpointFilters.end(), position) != m_CheckpointFilters.end();
+      bool isIntervalElapsed = m_CheckpointInterval > 0.0 && std::chrono::duration<double>(std::chrono::steady_clock::now() - lastCheckpointTime).count() >= m_CheckpointInterval;
+      if(nullptr != checkpointer && !isLastFilter && (isSelected || isIntervalElapsed))
+      {
+        if(nullptr != governor)
+        {
+          // Faulting everything in would break the budget, so the spilled arrays are added one at a time
+          err = checkpointer->write(governor->createResidentCopy(*m_Dca), position, [this, &governor](hid_t dcaGid) { return governor->writeSpilledArrays(*m_Dca, dcaGid); });
+        }
+        else
+        {
+          err = checkpointer->write(m_Dca, position);
+        }
+        // A checkpoint that could not be written does not stop the pipeline
+        if(err < 0)
+        {
+          setWarningCondition(err, checkpointer->getErrorMessage());
+        }
+        lastCheckpointTime = std::chrono::steady_clock::now();
       }
-      
     }
+    position++;
 
     if(m_State == FilterPipeline::State::Canceling)
     {
@@ -948,6 +1074,36 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   out << "Pipline End: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
 
+  if(nullptr != governor)
+  {
+    err = governor->restoreAll(*m_Dca);
+    if(err < 0)
+    {
+      return abortExecution(nullptr, err, governor->getErrorMessage());
+    }
+    notifyStatusMessage(QObject::tr("Memory budget: %1 arrays spilled, %2 faulted back in, peak resident size %3 bytes")
+                            .arg(governor->getSpillCount())
+                            .arg(governor->getFaultCount())
+                            .arg(governor->getPeakResidentBytes()));
+  }
+  if(nullptr != liveness)
+  {
+    notifyStatusMessage(QObject::tr("Released %1 bytes of intermediate arrays after their last use").arg(liveness->getReleasedBytes()));
+  }
+  if(nullptr != checkpointer)
+  {
+    err = checkpointer->waitForPendingWrite();
+    if(err < 0)
+    {
+      setWarningCondition(err, checkpointer->getErrorMessage());
+    }
+    // A completed pipeline has nothing left to resume
+    if(m_State == FilterPipeline::State::Executing)
+    {
+      checkpointer->clear();
+    }
+  }
+
   disconnectSignalsSlots();
 
   switch(m_State)
@@ -972,6 +1128,41 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   return m_Dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::abortExecution(MemoryBudgetGovernor* governor, int code, const QString& messageText)
+{
+  setErrorCondition(code, messageText);
+  // Spilled arrays are brought back so the caller gets the data structure as the failing filter left it
+  if(nullptr != governor && governor->restoreAll(*m_Dca) < 0)
+  {
+    setErrorCondition(MemoryBudgetGovernor::k_SpillReadError, governor->getErrorMessage());
+  }
+
+  notifyProgressMessage(100, "");
+
+  Q_EMIT pipelineFinished();
+  disconnectSignalsSlots();
+  m_State = FilterPipeline::State::Idle;
+  m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+  return m_Dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FilterPipeline::getPipelineHash() const
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  for(const auto& filter : m_Pipeline)
+  {
+    hash.addData(filter->getNameOfClass().toUtf8());
+    hash.addData(QJsonDocument(filter->toJson()).toJson(QJsonDocument::Compact));
+  }
+  return QString::fromLatin1(hash.result().toHex());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1076,6 +1267,102 @@ AbstractFilter::Pointer FilterPipeline::getCurrentFilter() const
   return m_CurrentFilter;
 }
 
+// -----------------------------------------------------------------------------
+void FilterPipeline::setMemoryBudget(size_t value)
+{
+  m_MemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+size_t FilterPipeline::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setScratchDirectory(const QString& value)
+{
+  m_ScratchDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FilterPipeline::getScratchDirectory() const
+{
+  return m_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setReleaseDeadArrays(bool value)
+{
+  m_ReleaseDeadArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getReleaseDeadArrays() const
+{
+  return m_ReleaseDeadArrays;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPinnedPaths(const std::vector<DataArrayPath>& value)
+{
+  m_PinnedPaths = value;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> FilterPipeline::getPinnedPaths() const
+{
+  return m_PinnedPaths;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setCheckpointDirectory(const QString& value)
+{
+  m_CheckpointDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FilterPipeline::getCheckpointDirectory() const
+{
+  return m_CheckpointDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setCheckpointFilters(const std::vector<size_t>& value)
+{
+  m_CheckpointFilters = value;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> FilterPipeline::getCheckpointFilters() const
+{
+  return m_CheckpointFilters;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setCheckpointInterval(double value)
+{
+  m_CheckpointInterval = value;
+}
+
+// -----------------------------------------------------------------------------
+double FilterPipeline::getCheckpointInterval() const
+{
+  return m_CheckpointInterval;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setResumeFromCheckpoint(bool value)
+{
+  m_ResumeFromCheckpoint = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getResumeFromCheckpoint() const
+{
+  return m_ResumeFromCheckpoint;
+}
+
 // -----------------------------------------------------------------------------
 FilterPipeline::ExecutionResult FilterPipeline::getExecutionResult() const
 {
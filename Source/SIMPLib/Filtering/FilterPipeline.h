@@ -36,6 +36,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
@@ -45,11 +46,13 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
 class DataContainerArray;
+class MemoryBudgetGovernor;
 using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
 
 /**
@@ -165,6 +168,101 @@ public:
    */
   AbstractFilter::Pointer getCurrentFilter() const;
 
+  /**
+   * @brief Setter property for MemoryBudget. When it is larger than 0 execute() spills arrays to the
+   * scratch directory between filters to keep the data structure within this many bytes.
+   */
+  void setMemoryBudget(size_t value);
+  /**
+   * @brief Getter property for MemoryBudget
+   * @return Value of MemoryBudget
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Setter property for ScratchDirectory. The system temporary directory is used when it is empty.
+   */
+  void setScratchDirectory(const QString& value);
+  /**
+   * @brief Getter property for ScratchDirectory
+   * @return Value of ScratchDirectory
+   */
+  QString getScratchDirectory() const;
+
+  /**
+   * @brief Setter property for ReleaseDeadArrays. When it is true execute() removes every array the pipeline
+   * creates right after the last filter that reads it. Arrays that are still present when a
+   * DataContainerWriter executes, pinned arrays and arrays no filter reads are kept.
+   */
+  void setReleaseDeadArrays(bool value);
+  /**
+   * @brief Getter property for ReleaseDeadArrays
+   * @return Value of ReleaseDeadArrays
+   */
+  bool getReleaseDeadArrays() const;
+
+  /**
+   * @brief Setter property for PinnedPaths. These are never released by ReleaseDeadArrays; a DataContainer or
+   * AttributeMatrix path pins every array below it.
+   */
+  void setPinnedPaths(const std::vector<DataArrayPath>& value);
+  /**
+   * @brief Getter property for PinnedPaths
+   * @return Value of PinnedPaths
+   */
+  std::vector<DataArrayPath> getPinnedPaths() const;
+
+  /**
+   * @brief Setter property for CheckpointDirectory. When it is not empty execute() writes checkpoints of the
+   * DataContainerArray into this directory.
+   */
+  void setCheckpointDirectory(const QString& value);
+  /**
+   * @brief Getter property for CheckpointDirectory
+   * @return Value of CheckpointDirectory
+   */
+  QString getCheckpointDirectory() const;
+
+  /**
+   * @brief Setter property for CheckpointFilters. A checkpoint is written after each filter at these
+   * positions in the pipeline.
+   */
+  void setCheckpointFilters(const std::vector<size_t>& value);
+  /**
+   * @brief Getter property for CheckpointFilters
+   * @return Value of CheckpointFilters
+   */
+  std::vector<size_t> getCheckpointFilters() const;
+
+  /**
+   * @brief Setter property for CheckpointInterval. When it is larger than 0 a checkpoint is also written
+   * after any filter that finishes this many seconds or more after the last checkpoint.
+   */
+  void setCheckpointInterval(double value);
+  /**
+   * @brief Getter property for CheckpointInterval
+   * @return Value of CheckpointInterval
+   */
+  double getCheckpointInterval() const;
+
+  /**
+   * @brief Setter property for ResumeFromCheckpoint. When it is true execute() continues from the latest
+   * checkpoint in the CheckpointDirectory that belongs to this pipeline instead of the given DataContainerArray.
+   */
+  void setResumeFromCheckpoint(bool value);
+  /**
+   * @brief Getter property for ResumeFromCheckpoint
+   * @return Value of ResumeFromCheckpoint
+   */
+  bool getResumeFromCheckpoint() const;
+
+  /**
+   * @brief Returns a hash of the filters and their parameters. Checkpoints are only resumed by a pipeline
+   * with the same hash.
+   * @return
+   */
+  QString getPipelineHash() const;
+
   /**
    * @brief Returns true if the pipeline is executing
    * @return
@@ -370,9 +468,27 @@ private:
   int m_ErrorCode = 0;
   int m_WarningCode = 0;
 
+  size_t m_MemoryBudget = 0;
+  QString m_ScratchDirectory;
+  bool m_ReleaseDeadArrays = false;
+  std::vector<DataArrayPath> m_PinnedPaths;
+  QString m_CheckpointDirectory;
+  std::vector<size_t> m_CheckpointFilters;
+  double m_CheckpointInterval = 0.0;
+  bool m_ResumeFromCheckpoint = false;
+
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Ends a failed execution: reports the error, restores any spilled arrays and resets the state
+   * @param governor The memory budget governor of the execution or nullptr
+   * @param code
+   * @param messageText
+   * @return The DataContainerArray of the execution
+   */
+  DataContainerArrayShPtrType abortExecution(MemoryBudgetGovernor* governor, int code, const QString& messageText);
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
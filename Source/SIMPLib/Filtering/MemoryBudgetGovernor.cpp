@@ -0,0 +1,452 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MemoryBudgetGovernor.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QObject>
+#include <QtCore/QTemporaryDir>
+
+#include "H5Support/H5ScopedSentinel.h"
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Montages/AbstractMontage.h"
+
+namespace
+{
+/**
+ * @brief Returns true if the array is a DataArray of one of the given types, i.e. its values are one
+ * contiguous buffer of getSize() * getTypeSize() bytes
+ */
+template <typename... Types>
+bool IsDataArrayOfAnyType(const IDataArray* array)
+{
+  return ((dynamic_cast<const DataArray<Types>*>(array) != nullptr) || ...);
+}
+
+bool IsPrimitiveDataArray(const IDataArray* array)
+{
+  return IsDataArrayOfAnyType<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, bool>(array);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+MemoryBudgetGovernor::MemoryBudgetGovernor(size_t budget, const QString& scratchDirectory)
+: m_Budget(budget)
+, m_ScratchDirectory(scratchDirectory)
+{
+}
+
+// -----------------------------------------------------------------------------
+MemoryBudgetGovernor::~MemoryBudgetGovernor() = default;
+
+// -----------------------------------------------------------------------------
+void MemoryBudgetGovernor::setPlan(const std::vector<FilterDataAccess>& plan)
+{
+  m_Plan = plan;
+}
+
+// -----------------------------------------------------------------------------
+void MemoryBudgetGovernor::account(DataContainerArray& dca, size_t filterIndex)
+{
+  const FilterDataAccess* access = (filterIndex < m_Plan.size()) ? &m_Plan[filterIndex] : nullptr;
+
+  // Views read through their base array, so a base array with views can not give up its buffer
+  std::vector<IDataArray::Pointer> arrays;
+  std::set<const IDataArray*> viewBases;
+  for(const auto& dc : dca.getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : am->getAttributeArrays())
+      {
+        IDataArrayView::Pointer view = std::dynamic_pointer_cast<IDataArrayView>(array);
+        if(nullptr != view)
+        {
+          viewBases.insert(view->getBaseArray().get());
+          continue;
+        }
+        arrays.push_back(array);
+      }
+    }
+  }
+
+  std::map<const IDataArray*, Entry> entries;
+  m_ResidentBytes = 0;
+  for(const auto& array : arrays)
+  {
+    Entry entry;
+    auto iter = m_Entries.find(array.get());
+    // The address of a deleted array may be reused by a new one, so the weak pointer has to match as well
+    if(iter != m_Entries.end() && iter->second.array.lock() == array)
+    {
+      entry = iter->second;
+    }
+    else
+    {
+      entry.array = array;
+      entry.lastUse = filterIndex;
+    }
+    entry.path = array->getDataArrayPath();
+    entry.spillable = IsPrimitiveDataArray(array.get()) && viewBases.count(array.get()) == 0;
+    if(!entry.spilled)
+    {
+      entry.bytes = array->getSize() * array->getTypeSize();
+      m_ResidentBytes += entry.bytes;
+    }
+    if(nullptr != access && (access->reads(entry.path) || access->creates(entry.path)))
+    {
+      entry.lastUse = filterIndex;
+    }
+    entries[array.get()] = entry;
+  }
+
+  // Spill files of arrays that were removed from the data structure are no longer needed
+  for(const auto& oldEntry : m_Entries)
+  {
+    if(oldEntry.second.spilled && entries.count(oldEntry.first) == 0)
+    {
+      QFile::remove(oldEntry.second.spillFile);
+    }
+  }
+  m_Entries.swap(entries);
+  m_PeakResidentBytes = std::max(m_PeakResidentBytes, m_ResidentBytes);
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::nextRead(const DataArrayPath& path, size_t filterIndex) const
+{
+  for(size_t i = filterIndex + 1; i < m_Plan.size(); i++)
+  {
+    if(m_Plan[i].touchesAttributeMatrixOf(path))
+    {
+      return i;
+    }
+  }
+  return std::numeric_limits<size_t>::max();
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::prepare(DataContainerArray& dca, size_t filterIndex)
+{
+  const FilterDataAccess* access = (filterIndex < m_Plan.size()) ? &m_Plan[filterIndex] : nullptr;
+  for(auto& item : m_Entries)
+  {
+    Entry& entry = item.second;
+    if(!entry.spilled)
+    {
+      continue;
+    }
+    // Arrays are matched by their current path in case something was renamed since the last accounting
+    IDataArray::Pointer array = entry.array.lock();
+    if(nullptr == array)
+    {
+      continue;
+    }
+    entry.path = array->getDataArrayPath();
+    // A spilled array has zero tuples, so a filter that works on one array of an AttributeMatrix would see
+    // its siblings truncated. The whole AttributeMatrix is faulted in.
+    if(nullptr == access || access->touchesAttributeMatrixOf(entry.path))
+    {
+      int err = faultIn(entry);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::release(DataContainerArray& dca, size_t filterIndex)
+{
+  account(dca, filterIndex);
+  if(m_ResidentBytes <= m_Budget)
+  {
+    return 0;
+  }
+
+  // Arrays that no later filter touches go first, then the ones needed furthest in the future and among those
+  // the least recently used. The AttributeMatrices the next filter works on are never spilled since they would
+  // be faulted right back in.
+  const FilterDataAccess* nextAccess = (filterIndex + 1 < m_Plan.size()) ? &m_Plan[filterIndex + 1] : nullptr;
+  std::vector<std::pair<std::pair<size_t, size_t>, Entry*>> candidates;
+  for(auto& item : m_Entries)
+  {
+    Entry& entry = item.second;
+    if(entry.spilled || !entry.spillable || entry.bytes == 0)
+    {
+      continue;
+    }
+    if(nullptr != nextAccess && nextAccess->touchesAttributeMatrixOf(entry.path))
+    {
+      continue;
+    }
+    candidates.push_back({{nextRead(entry.path, filterIndex), entry.lastUse}, &entry});
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    if(lhs.first.first != rhs.first.first)
+    {
+      return lhs.first.first > rhs.first.first;
+    }
+    return lhs.first.second < rhs.first.second;
+  });
+
+  for(auto& candidate : candidates)
+  {
+    if(m_ResidentBytes <= m_Budget)
+    {
+      break;
+    }
+    int err = spill(*candidate.second);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::restoreAll(DataContainerArray& dca)
+{
+  for(auto& item : m_Entries)
+  {
+    if(item.second.spilled)
+    {
+      int err = faultIn(item.second);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+  }
+  m_Entries.clear();
+  m_ScratchDir.reset();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer MemoryBudgetGovernor::createResidentCopy(DataContainerArray& dca) const
+{
+  DataContainerArray::Pointer copy = DataContainerArray::New();
+  for(const auto& dc : dca.getDataContainers())
+  {
+    DataContainer::Pointer dcCopy = DataContainer::New(dc->getName());
+    dcCopy->setGeometry(dc->getGeometry());
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      AttributeMatrix::Pointer amCopy = AttributeMatrix::New(am->getTupleDimensions(), am->getName(), am->getType());
+      for(const auto& array : am->getChildren())
+      {
+        auto iter = m_Entries.find(array.get());
+        if(iter != m_Entries.end() && iter->second.spilled)
+        {
+          continue;
+        }
+        amCopy->insertOrAssignShared(array);
+      }
+      dcCopy->addOrReplaceAttributeMatrix(amCopy);
+    }
+    copy->addOrReplaceDataContainer(dcCopy);
+  }
+
+  copy->setDataContainerBundles(dca.getDataContainerBundles());
+  for(const auto& montage : dca.getMontageCollection())
+  {
+    copy->addMontage(montage->propagate(copy));
+  }
+  return copy;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::writeSpilledArrays(const DataContainerArray& dca, hid_t dcaGid)
+{
+  for(auto& item : m_Entries)
+  {
+    Entry& entry = item.second;
+    IDataArray::Pointer array = entry.array.lock();
+    if(!entry.spilled || nullptr == array)
+    {
+      continue;
+    }
+    entry.path = array->getDataArrayPath();
+    AttributeMatrix::Pointer am = dca.getAttributeMatrix(entry.path);
+    QString amGroupPath = entry.path.getDataContainerName() + "/" + entry.path.getAttributeMatrixName();
+    hid_t amGid = (nullptr != am) ? H5Gopen(dcaGid, amGroupPath.toLatin1().data(), H5P_DEFAULT) : -1;
+    if(amGid < 0)
+    {
+      m_ErrorMessage = QObject::tr("The group of the spilled array '%1' could not be opened in the checkpoint").arg(entry.path.serialize("/"));
+      return k_CheckpointWriteError;
+    }
+    H5ScopedGroupSentinel groupSentinel(amGid, false);
+
+    int err = readSpillFile(entry, *array);
+    if(err >= 0)
+    {
+      m_PeakResidentBytes = std::max(m_PeakResidentBytes, m_ResidentBytes + entry.bytes);
+      if(array->writeH5Data(amGid, am->getTupleDimensions()) < 0)
+      {
+        m_ErrorMessage = QObject::tr("The spilled array '%1' could not be written to the checkpoint").arg(entry.path.serialize("/"));
+        err = k_CheckpointWriteError;
+      }
+    }
+    // The spill file still holds the values, so the array only gives its buffer up again
+    array->resizeTuples(0);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::spill(Entry& entry)
+{
+  IDataArray::Pointer array = entry.array.lock();
+  if(nullptr == array)
+  {
+    return 0;
+  }
+
+  if(nullptr == m_ScratchDir)
+  {
+    QString scratchDirectory = m_ScratchDirectory.isEmpty() ? QDir::tempPath() : m_ScratchDirectory;
+    m_ScratchDir = std::make_unique<QTemporaryDir>(scratchDirectory + "/SIMPL_Spill_XXXXXX");
+    if(!m_ScratchDir->isValid())
+    {
+      m_ErrorMessage = QObject::tr("The scratch directory for spilled arrays could not be created below '%1'").arg(scratchDirectory);
+      m_ScratchDir.reset();
+      return k_ScratchDirectoryError;
+    }
+  }
+
+  entry.spillFile = m_ScratchDir->filePath(QString("%1.raw").arg(m_NextFileId++));
+  QFile file(entry.spillFile);
+  const qint64 numBytes = static_cast<qint64>(entry.bytes);
+  if(!file.open(QIODevice::WriteOnly) || file.write(reinterpret_cast<const char*>(array->getVoidPointer(0)), numBytes) != numBytes)
+  {
+    m_ErrorMessage = QObject::tr("Array '%1' could not be spilled to '%2'").arg(entry.path.serialize("/")).arg(entry.spillFile);
+    file.close();
+    QFile::remove(entry.spillFile);
+    return k_SpillWriteError;
+  }
+  file.close();
+
+  entry.spilledTuples = array->getNumberOfTuples();
+  array->resizeTuples(0);
+  entry.spilled = true;
+  m_ResidentBytes -= entry.bytes;
+  m_SpillCount++;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::faultIn(Entry& entry)
+{
+  IDataArray::Pointer array = entry.array.lock();
+  if(nullptr == array)
+  {
+    return 0;
+  }
+
+  int err = readSpillFile(entry, *array);
+  if(err < 0)
+  {
+    return err;
+  }
+  QFile::remove(entry.spillFile);
+
+  entry.spilled = false;
+  m_ResidentBytes += entry.bytes;
+  m_FaultCount++;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int MemoryBudgetGovernor::readSpillFile(const Entry& entry, IDataArray& array)
+{
+  array.resizeTuples(entry.spilledTuples);
+  QFile file(entry.spillFile);
+  const qint64 numBytes = static_cast<qint64>(entry.bytes);
+  if(array.getSize() * array.getTypeSize() != entry.bytes || !file.open(QIODevice::ReadOnly) || file.read(reinterpret_cast<char*>(array.getVoidPointer(0)), numBytes) != numBytes)
+  {
+    m_ErrorMessage = QObject::tr("Array '%1' could not be read back from '%2'").arg(entry.path.serialize("/")).arg(entry.spillFile);
+    return k_SpillReadError;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::getBudget() const
+{
+  return m_Budget;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::getResidentBytes() const
+{
+  return m_ResidentBytes;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::getPeakResidentBytes() const
+{
+  return m_PeakResidentBytes;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::getSpillCount() const
+{
+  return m_SpillCount;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryBudgetGovernor::getFaultCount() const
+{
+  return m_FaultCount;
+}
+
+// -----------------------------------------------------------------------------
+QString MemoryBudgetGovernor::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
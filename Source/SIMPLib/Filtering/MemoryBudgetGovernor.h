@@ -0,0 +1,211 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include <hdf5.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterDataAccess.h"
+
+class QTemporaryDir;
+
+/**
+ * @brief The MemoryBudgetGovernor class keeps the bytes held by the arrays of a DataContainerArray within a
+ * budget while a pipeline executes. Whenever a filter finishes the governor accounts every array and spills
+ * arrays to raw files in a scratch directory until the resident bytes fit the budget again. Arrays that no
+ * later filter needs go first, then the ones needed furthest in the future, least recently used first among
+ * equals.
+ *
+ * A spilled array stays in its AttributeMatrix with zero tuples. Since filters work on the siblings of the arrays
+ * they declare, e.g. when copying whole tuples, residency is decided per AttributeMatrix: every AttributeMatrix a
+ * filter reads from or creates in is faulted in completely before it executes, and the AttributeMatrices of the
+ * next filter stay resident. Only primitive DataArrays that are not the base of a view can be spilled; every
+ * other array is accounted but stays resident.
+ */
+class SIMPLib_EXPORT MemoryBudgetGovernor
+{
+public:
+  static constexpr int k_ScratchDirectoryError = -11100;
+  static constexpr int k_SpillWriteError = -11101;
+  static constexpr int k_SpillReadError = -11102;
+  static constexpr int k_CheckpointWriteError = -11103;
+
+  /**
+   * @brief Constructor
+   * @param budget The number of bytes the arrays may hold
+   * @param scratchDirectory The directory the spill files are written below. The system temporary directory is
+   * used when it is empty.
+   */
+  MemoryBudgetGovernor(size_t budget, const QString& scratchDirectory);
+  ~MemoryBudgetGovernor();
+
+  MemoryBudgetGovernor(const MemoryBudgetGovernor&) = delete;            // Copy Constructor Not Implemented
+  MemoryBudgetGovernor(MemoryBudgetGovernor&&) = delete;                 // Move Constructor Not Implemented
+  MemoryBudgetGovernor& operator=(const MemoryBudgetGovernor&) = delete; // Copy Assignment Not Implemented
+  MemoryBudgetGovernor& operator=(MemoryBudgetGovernor&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Sets the data access of every filter of the pipeline, in pipeline order.
+   * @param plan
+   */
+  void setPlan(const std::vector<FilterDataAccess>& plan);
+
+  /**
+   * @brief Faults in the spilled arrays of every AttributeMatrix the filter at the given index reads from or creates in.
+   * @param dca
+   * @param filterIndex
+   * @return 0 or a negative error code; see getErrorMessage()
+   */
+  int prepare(DataContainerArray& dca, size_t filterIndex);
+
+  /**
+   * @brief Accounts the arrays after the filter at the given index executed and spills arrays until the
+   * resident bytes fit the budget.
+   * @param dca
+   * @param filterIndex
+   * @return 0 or a negative error code; see getErrorMessage()
+   */
+  int release(DataContainerArray& dca, size_t filterIndex);
+
+  /**
+   * @brief Faults in every spilled array and removes the spill files.
+   * @param dca
+   * @return 0 or a negative error code; see getErrorMessage()
+   */
+  int restoreAll(DataContainerArray& dca);
+
+  /**
+   * @brief Returns a DataContainerArray that shares the geometries, bundles, montages and resident arrays of the
+   * given one but lists none of the spilled arrays, so it can be written without faulting anything in.
+   * @param dca
+   * @return
+   */
+  DataContainerArray::Pointer createResidentCopy(DataContainerArray& dca) const;
+
+  /**
+   * @brief Writes the spilled arrays into the DataContainers group of a .dream3d file one at a time. Each array
+   * is read back from its spill file, written and given up again, so at most one spilled array is resident
+   * on top of the others. The spill files are kept.
+   * @param dca
+   * @param dcaGid
+   * @return 0 or a negative error code; see getErrorMessage()
+   */
+  int writeSpilledArrays(const DataContainerArray& dca, hid_t dcaGid);
+
+  /**
+   * @brief Returns the budget in bytes
+   * @return
+   */
+  size_t getBudget() const;
+
+  /**
+   * @brief Returns the bytes held by the resident arrays as of the last accounting
+   * @return
+   */
+  size_t getResidentBytes() const;
+
+  /**
+   * @brief Returns the largest number of resident bytes seen after any filter
+   * @return
+   */
+  size_t getPeakResidentBytes() const;
+
+  /**
+   * @brief Returns how many times an array was spilled
+   * @return
+   */
+  size_t getSpillCount() const;
+
+  /**
+   * @brief Returns how many times an array was faulted back in
+   * @return
+   */
+  size_t getFaultCount() const;
+
+  /**
+   * @brief Returns the message describing the last error
+   * @return
+   */
+  QString getErrorMessage() const;
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<IDataArray> array;
+    DataArrayPath path;
+    size_t bytes = 0;
+    size_t lastUse = 0;
+    bool spillable = false;
+    bool spilled = false;
+    size_t spilledTuples = 0;
+    QString spillFile;
+  };
+
+  size_t m_Budget = 0;
+  QString m_ScratchDirectory;
+  std::unique_ptr<QTemporaryDir> m_ScratchDir;
+  std::vector<FilterDataAccess> m_Plan;
+  std::map<const IDataArray*, Entry> m_Entries;
+  size_t m_ResidentBytes = 0;
+  size_t m_PeakResidentBytes = 0;
+  size_t m_SpillCount = 0;
+  size_t m_FaultCount = 0;
+  size_t m_NextFileId = 0;
+  QString m_ErrorMessage;
+
+  /**
+   * @brief Brings the entries up to date with the arrays currently in the DataContainerArray
+   * @param dca
+   * @param filterIndex
+   */
+  void account(DataContainerArray& dca, size_t filterIndex);
+
+  /**
+   * @brief Returns the index of the first filter after the given index that works on the AttributeMatrix of the
+   * array, or the largest size_t if no later filter does
+   * @param path
+   * @param filterIndex
+   * @return
+   */
+  size_t nextRead(const DataArrayPath& path, size_t filterIndex) const;
+
+  int spill(Entry& entry);
+  int faultIn(Entry& entry);
+  int readSpillFile(const Entry& entry, IDataArray& array);
+};
@@ -0,0 +1,295 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineCheckpointer.h"
+
+#include <hdf5.h>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QSaveFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/HDF5/H5ScopedLock.h"
+
+namespace
+{
+const QString k_ManifestFileName("Checkpoint.json");
+const QString k_PipelineHashKey("PipelineHash");
+const QString k_FilterIndexKey("FilterIndex");
+const QString k_FileKey("File");
+
+/**
+ * @brief Opens a written checkpoint file again and hands its DataContainers group to the append function
+ */
+int AppendToCheckpoint(const QString& filePath, const PipelineCheckpointer::AppendFunction& append)
+{
+  H5ScopedLock h5Lock;
+  hid_t fileId = QH5Utilities::openFile(filePath, false);
+  if(fileId < 0)
+  {
+    return -1;
+  }
+  H5ScopedFileSentinel sentinel(fileId, true);
+  hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+  if(dcaGid < 0)
+  {
+    return -1;
+  }
+  sentinel.addGroupId(dcaGid);
+  return append(dcaGid);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+PipelineCheckpointer::PipelineCheckpointer(const QString& directory, const QString& pipelineHash)
+: m_Directory(directory)
+, m_PipelineHash(pipelineHash)
+{
+}
+
+// -----------------------------------------------------------------------------
+PipelineCheckpointer::~PipelineCheckpointer()
+{
+  waitForPendingWrite();
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineCheckpointer::CanWriteAsynchronously()
+{
+  hbool_t isThreadSafe = 0;
+  if(H5is_library_threadsafe(&isThreadSafe) < 0)
+  {
+    return false;
+  }
+  return isThreadSafe > 0;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineCheckpointer::setAsynchronous(bool value)
+{
+  m_Asynchronous = value;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineCheckpointer::getAsynchronous() const
+{
+  return m_Asynchronous;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineCheckpointer::manifestFilePath() const
+{
+  return m_Directory + "/" + k_ManifestFileName;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineCheckpointer::write(const DataContainerArray::Pointer& dca, size_t filterIndex, const AppendFunction& append)
+{
+  // A failed earlier write does not keep this checkpoint from being written; its error is reported instead
+  int pendingErr = waitForPendingWrite();
+  QString pendingMessage = m_ErrorMessage;
+
+  if(!QDir().mkpath(m_Directory))
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint directory '%1' could not be created").arg(m_Directory);
+    return k_DirectoryError;
+  }
+
+  // The error of the earlier write is handed to the caller right away, so a worker must not overwrite it
+  if(pendingErr >= 0 && m_Asynchronous && !append && CanWriteAsynchronously())
+  {
+    // The next filter modifies the live data structure while the snapshot is written
+    DataContainerArray::Pointer snapshot = dca->deepCopy(false);
+    m_PendingWrite = std::async(std::launch::async, [this, snapshot, filterIndex]() { return writeCheckpoint(snapshot, filterIndex, AppendFunction()); });
+    return 0;
+  }
+
+  int err = writeCheckpoint(dca, filterIndex, append);
+  if(pendingErr < 0)
+  {
+    m_ErrorMessage = (err < 0) ? QObject::tr("%1. %2").arg(pendingMessage).arg(m_ErrorMessage) : pendingMessage;
+    return (err < 0) ? err : pendingErr;
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineCheckpointer::waitForPendingWrite()
+{
+  if(!m_PendingWrite.valid())
+  {
+    return 0;
+  }
+  return m_PendingWrite.get();
+}
+
+// -----------------------------------------------------------------------------
+int PipelineCheckpointer::writeCheckpoint(const DataContainerArray::Pointer& dca, size_t filterIndex, const AppendFunction& append)
+{
+  QString fileName = QString("Checkpoint_%1.dream3d").arg(filterIndex);
+  QString filePath = m_Directory + "/" + fileName;
+  QString partialFilePath = filePath + ".part";
+  QFile::remove(partialFilePath);
+
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setOutputFile(partialFilePath);
+  writer->setWritePipeline(false);
+  writer->setWriteXdmfFile(false);
+  writer->execute();
+  if(writer->getErrorCode() < 0)
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint after filter %1 could not be written to '%2'").arg(filterIndex + 1).arg(partialFilePath);
+    QFile::remove(partialFilePath);
+    return k_WriteError;
+  }
+  if(append && AppendToCheckpoint(partialFilePath, append) < 0)
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint after filter %1 could not be completed in '%2'").arg(filterIndex + 1).arg(partialFilePath);
+    QFile::remove(partialFilePath);
+    return k_WriteError;
+  }
+  QFile::remove(filePath);
+  if(!QFile::rename(partialFilePath, filePath))
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint file '%1' could not be renamed to '%2'").arg(partialFilePath).arg(filePath);
+    QFile::remove(partialFilePath);
+    return k_WriteError;
+  }
+
+  // The manifest only ever points at a complete file
+  QJsonObject manifest;
+  manifest[k_PipelineHashKey] = m_PipelineHash;
+  manifest[k_FilterIndexKey] = static_cast<qint64>(filterIndex);
+  manifest[k_FileKey] = fileName;
+  QSaveFile manifestFile(manifestFilePath());
+  if(!manifestFile.open(QIODevice::WriteOnly) || manifestFile.write(QJsonDocument(manifest).toJson()) < 0 || !manifestFile.commit())
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint manifest '%1' could not be written").arg(manifestFilePath());
+    return k_WriteError;
+  }
+
+  if(!m_LastFilePath.isEmpty() && m_LastFilePath != filePath)
+  {
+    QFile::remove(m_LastFilePath);
+  }
+  m_LastFilePath = filePath;
+  m_WriteCount++;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineCheckpointer::findLatest(Checkpoint& checkpoint) const
+{
+  QFile manifestFile(manifestFilePath());
+  if(!manifestFile.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument document = QJsonDocument::fromJson(manifestFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !document.isObject())
+  {
+    return false;
+  }
+
+  QJsonObject manifest = document.object();
+  if(manifest[k_PipelineHashKey].toString() != m_PipelineHash || !manifest[k_FilterIndexKey].isDouble())
+  {
+    return false;
+  }
+  QString filePath = m_Directory + "/" + manifest[k_FileKey].toString();
+  if(!QFileInfo(filePath).isFile())
+  {
+    return false;
+  }
+
+  checkpoint.filterIndex = static_cast<size_t>(manifest[k_FilterIndexKey].toDouble());
+  checkpoint.filePath = filePath;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer PipelineCheckpointer::read(const Checkpoint& checkpoint)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainerReader::Pointer reader = DataContainerReader::New();
+  reader->setInputFile(checkpoint.filePath);
+  reader->setDataContainerArray(dca);
+  DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(checkpoint.filePath);
+  reader->setInputFileDataContainerArrayProxy(proxy);
+  reader->execute();
+  if(reader->getErrorCode() < 0)
+  {
+    m_ErrorMessage = QObject::tr("The checkpoint '%1' could not be read").arg(checkpoint.filePath);
+    return DataContainerArray::NullPointer();
+  }
+  m_LastFilePath = checkpoint.filePath;
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineCheckpointer::clear()
+{
+  waitForPendingWrite();
+  Checkpoint checkpoint;
+  if(findLatest(checkpoint))
+  {
+    QFile::remove(checkpoint.filePath);
+    QFile::remove(manifestFilePath());
+  }
+  if(!m_LastFilePath.isEmpty())
+  {
+    QFile::remove(m_LastFilePath);
+    m_LastFilePath.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+size_t PipelineCheckpointer::getWriteCount() const
+{
+  return m_WriteCount;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineCheckpointer::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
@@ -0,0 +1,176 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+#include <future>
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+/**
+ * @brief The PipelineCheckpointer class writes snapshots of the DataContainerArray of an executing pipeline
+ * into a checkpoint directory and finds the latest valid one again so the pipeline can resume after it.
+ *
+ * A checkpoint is a .dream3d file written with DataContainerWriter plus a Checkpoint.json manifest that
+ * records the pipeline hash, the index of the filter after which the snapshot was taken and the file name.
+ * The manifest is replaced atomically once the file is complete, so an interrupted write leaves the previous
+ * checkpoint valid. A checkpoint only matches a pipeline with the same hash.
+ *
+ * When the HDF5 library is thread safe the snapshot is deep copied and written on a worker thread while the
+ * pipeline continues with the next filter; otherwise it is written before write() returns.
+ */
+class SIMPLib_EXPORT PipelineCheckpointer
+{
+public:
+  static constexpr int k_DirectoryError = -11120;
+  static constexpr int k_WriteError = -11121;
+  static constexpr int k_ReadError = -11122;
+
+  struct Checkpoint
+  {
+    size_t filterIndex = 0;
+    QString filePath;
+  };
+
+  /**
+   * @brief Adds arrays that the DataContainerArray does not hold in memory to a checkpoint. It is handed the
+   * DataContainers group of the checkpoint file and returns 0 or a negative error code.
+   */
+  using AppendFunction = std::function<int(hid_t)>;
+
+  /**
+   * @brief Constructor
+   * @param directory The directory the checkpoints are written into
+   * @param pipelineHash The hash of the pipeline the checkpoints belong to
+   */
+  PipelineCheckpointer(const QString& directory, const QString& pipelineHash);
+
+  /**
+   * @brief Waits for a pending write to finish
+   */
+  ~PipelineCheckpointer();
+
+  PipelineCheckpointer(const PipelineCheckpointer&) = delete;            // Copy Constructor Not Implemented
+  PipelineCheckpointer(PipelineCheckpointer&&) = delete;                 // Move Constructor Not Implemented
+  PipelineCheckpointer& operator=(const PipelineCheckpointer&) = delete; // Copy Assignment Not Implemented
+  PipelineCheckpointer& operator=(PipelineCheckpointer&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns true if checkpoints can be written on a worker thread, i.e. the HDF5 library is thread safe
+   * @return
+   */
+  static bool CanWriteAsynchronously();
+
+  /**
+   * @brief Setter property for Asynchronous. Has no effect when CanWriteAsynchronously() is false.
+   */
+  void setAsynchronous(bool value);
+  /**
+   * @brief Getter property for Asynchronous
+   * @return Value of Asynchronous
+   */
+  bool getAsynchronous() const;
+
+  /**
+   * @brief Writes a checkpoint of the DataContainerArray as it is after the filter at the given index. A
+   * pending write is finished first; if it failed, this checkpoint is still written, synchronously, and the
+   * earlier error is returned unless this write fails as well.
+   * @param dca
+   * @param filterIndex
+   * @param append Called once the DataContainerArray was written and before the checkpoint becomes valid. A
+   * checkpoint with an append function is always written synchronously.
+   * @return 0 or a negative error code of this or of the pending write; see getErrorMessage()
+   */
+  int write(const DataContainerArray::Pointer& dca, size_t filterIndex, const AppendFunction& append = AppendFunction());
+
+  /**
+   * @brief Waits until the pending write finished
+   * @return 0 or a negative error code of the pending write; see getErrorMessage()
+   */
+  int waitForPendingWrite();
+
+  /**
+   * @brief Looks for the latest checkpoint of the pipeline
+   * @param checkpoint Receives the checkpoint
+   * @return True if a valid checkpoint was found
+   */
+  bool findLatest(Checkpoint& checkpoint) const;
+
+  /**
+   * @brief Reads the DataContainerArray of a checkpoint
+   * @param checkpoint
+   * @return The DataContainerArray or a null pointer on error; see getErrorMessage()
+   */
+  DataContainerArray::Pointer read(const Checkpoint& checkpoint);
+
+  /**
+   * @brief Removes the checkpoint files of the pipeline
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of checkpoints that were written successfully
+   * @return
+   */
+  size_t getWriteCount() const;
+
+  /**
+   * @brief Returns the message describing the last error
+   * @return
+   */
+  QString getErrorMessage() const;
+
+private:
+  QString m_Directory;
+  QString m_PipelineHash;
+  bool m_Asynchronous = true;
+  std::future<int> m_PendingWrite;
+  QString m_LastFilePath;
+  size_t m_WriteCount = 0;
+  QString m_ErrorMessage;
+
+  /**
+   * @brief Writes the checkpoint file and then the manifest. Runs on the worker thread for asynchronous
+   * writes and must only touch the members that the pipeline thread does not use until the write finished.
+   * @param dca
+   * @param filterIndex
+   * @param append
+   * @return
+   */
+  int writeCheckpoint(const DataContainerArray::Pointer& dca, size_t filterIndex, const AppendFunction& append);
+
+  QString manifestFilePath() const;
+};
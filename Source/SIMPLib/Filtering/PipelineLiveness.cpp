@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineLiveness.h"
+
+#include <algorithm>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+// -----------------------------------------------------------------------------
+PipelineLiveness::PipelineLiveness(std::vector<FilterDataAccess> plan)
+: m_Plan(std::move(plan))
+{
+}
+
+// -----------------------------------------------------------------------------
+PipelineLiveness::~PipelineLiveness() = default;
+
+// -----------------------------------------------------------------------------
+void PipelineLiveness::addWriter(size_t filterIndex)
+{
+  // Everything present when the writer executes ends up in its output
+  if(filterIndex < m_Plan.size())
+  {
+    m_Plan[filterIndex] = FilterDataAccess({}, {}, true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void PipelineLiveness::setPinnedPaths(const std::vector<DataArrayPath>& paths)
+{
+  m_PinnedPaths = paths;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<DataArrayPath>& PipelineLiveness::getPinnedPaths() const
+{
+  return m_PinnedPaths;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineLiveness::isPinned(const DataArrayPath& arrayPath) const
+{
+  return std::any_of(m_PinnedPaths.begin(), m_PinnedPaths.end(), [&arrayPath](const DataArrayPath& path) { return FilterDataAccess::Covers(path, arrayPath); });
+}
+
+// -----------------------------------------------------------------------------
+size_t PipelineLiveness::lastReader(const DataArrayPath& arrayPath, size_t createdIndex) const
+{
+  size_t last = k_NotRead;
+  for(size_t i = createdIndex + 1; i < m_Plan.size(); i++)
+  {
+    if(m_Plan[i].reads(arrayPath))
+    {
+      last = i;
+    }
+    // A filter that creates the array again ends the lifetime of the current one
+    if(m_Plan[i].creates(arrayPath))
+    {
+      break;
+    }
+  }
+  return last;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineLiveness::isDeadAfter(const DataArrayPath& arrayPath, size_t createdIndex, size_t filterIndex) const
+{
+  if(isPinned(arrayPath))
+  {
+    return false;
+  }
+  size_t last = lastReader(arrayPath, createdIndex);
+  return last != k_NotRead && last <= filterIndex;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> PipelineLiveness::getDeadArrayPaths(size_t filterIndex) const
+{
+  std::vector<DataArrayPath> deadPaths;
+  for(size_t i = 0; i <= filterIndex && i < m_Plan.size(); i++)
+  {
+    for(const auto& createdPath : m_Plan[i].getCreatedPaths())
+    {
+      if(createdPath.getDataArrayName().isEmpty() || lastReader(createdPath, i) != filterIndex || !isDeadAfter(createdPath, i, filterIndex))
+      {
+        continue;
+      }
+      if(std::find(deadPaths.begin(), deadPaths.end(), createdPath) == deadPaths.end())
+      {
+        deadPaths.push_back(createdPath);
+      }
+    }
+  }
+  return deadPaths;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineLiveness::track(DataContainerArray& dca, size_t filterIndex, bool callerOwned)
+{
+  std::map<const IDataArray*, TrackedArray> tracked;
+  for(const auto& dc : dca.getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : am->getAttributeArrays())
+      {
+        TrackedArray trackedArray;
+        auto iter = m_Tracked.find(array.get());
+        // The address of a deleted array may be reused by a new one, so the weak pointer has to match as well
+        if(iter != m_Tracked.end() && iter->second.array.lock() == array)
+        {
+          trackedArray = iter->second;
+          // A filter that declares the array as created but reuses the existing object starts a new lifetime
+          if(!callerOwned && filterIndex < m_Plan.size() && m_Plan[filterIndex].creates(array->getDataArrayPath()))
+          {
+            trackedArray.createdIndex = filterIndex;
+          }
+        }
+        else
+        {
+          trackedArray.array = array;
+          trackedArray.createdIndex = filterIndex;
+          trackedArray.callerOwned = callerOwned;
+        }
+        tracked[array.get()] = trackedArray;
+      }
+    }
+  }
+  m_Tracked.swap(tracked);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineLiveness::beginExecution(DataContainerArray& dca)
+{
+  m_Tracked.clear();
+  m_ReleasedBytes = 0;
+  track(dca, 0, true);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineLiveness::resumeExecution(DataContainerArray& dca, size_t filterIndex)
+{
+  beginExecution(dca);
+  for(auto& item : m_Tracked)
+  {
+    TrackedArray& trackedArray = item.second;
+    IDataArray::Pointer array = trackedArray.array.lock();
+    if(nullptr == array)
+    {
+      continue;
+    }
+    DataArrayPath arrayPath = array->getDataArrayPath();
+    for(size_t i = std::min(filterIndex + 1, m_Plan.size()); i > 0; i--)
+    {
+      if(m_Plan[i - 1].creates(arrayPath))
+      {
+        trackedArray.createdIndex = i - 1;
+        trackedArray.callerOwned = false;
+        break;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+size_t PipelineLiveness::releaseDeadArrays(DataContainerArray& dca, size_t filterIndex)
+{
+  track(dca, filterIndex, false);
+
+  std::vector<DataArrayPath> deadPaths;
+  for(const auto& item : m_Tracked)
+  {
+    const TrackedArray& trackedArray = item.second;
+    IDataArray::Pointer array = trackedArray.array.lock();
+    if(trackedArray.callerOwned || nullptr == array)
+    {
+      continue;
+    }
+    DataArrayPath arrayPath = array->getDataArrayPath();
+    if(isDeadAfter(arrayPath, trackedArray.createdIndex, filterIndex))
+    {
+      deadPaths.push_back(arrayPath);
+      m_ReleasedBytes += array->getSize() * array->getTypeSize();
+    }
+  }
+
+  for(const auto& deadPath : deadPaths)
+  {
+    AttributeMatrix::Pointer am = dca.getAttributeMatrix(deadPath);
+    if(nullptr != am)
+    {
+      am->removeAttributeArray(deadPath.getDataArrayName());
+    }
+  }
+  return deadPaths.size();
+}
+
+// -----------------------------------------------------------------------------
+size_t PipelineLiveness::getReleasedBytes() const
+{
+  return m_ReleasedBytes;
+}
@@ -0,0 +1,175 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/Filtering/FilterDataAccess.h"
+
+class DataContainerArray;
+
+/**
+ * @brief The PipelineLiveness class is a liveness analysis over the data access of a preflighted pipeline.
+ * An array that a filter creates is dead once the last filter that reads it has executed; an array that no
+ * later filter reads at all is a result of the pipeline and stays alive. Pinned arrays are always kept alive.
+ * A writer filter counts as a reader of every array, so everything created in front of a writer is still
+ * present in its output and is only released after the last writer that sees it.
+ *
+ * During execution releaseDeadArrays() removes the dead arrays from the DataContainerArray after each
+ * filter. Arrays that were in the DataContainerArray before the pipeline started belong to the caller and
+ * are never removed.
+ */
+class SIMPLib_EXPORT PipelineLiveness
+{
+public:
+  static constexpr size_t k_NotRead = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief Constructor
+   * @param plan The data access of every filter of the pipeline, in pipeline order
+   */
+  PipelineLiveness(std::vector<FilterDataAccess> plan);
+  ~PipelineLiveness();
+
+  PipelineLiveness(const PipelineLiveness&) = delete;            // Copy Constructor Not Implemented
+  PipelineLiveness(PipelineLiveness&&) = delete;                 // Move Constructor Not Implemented
+  PipelineLiveness& operator=(const PipelineLiveness&) = delete; // Copy Assignment Not Implemented
+  PipelineLiveness& operator=(PipelineLiveness&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Marks the filter at the given index as a writer, which reads every array that is present when it
+   * executes. Its own data access is replaced.
+   * @param filterIndex
+   */
+  void addWriter(size_t filterIndex);
+
+  /**
+   * @brief Sets the paths that are never released. A DataContainer or AttributeMatrix path pins every array
+   * below it.
+   * @param paths
+   */
+  void setPinnedPaths(const std::vector<DataArrayPath>& paths);
+
+  /**
+   * @brief Returns the pinned paths
+   * @return
+   */
+  const std::vector<DataArrayPath>& getPinnedPaths() const;
+
+  /**
+   * @brief Returns true if the array is covered by a pinned path
+   * @param arrayPath
+   * @return
+   */
+  bool isPinned(const DataArrayPath& arrayPath) const;
+
+  /**
+   * @brief Returns the index of the last filter that reads the array created by the filter at createdIndex,
+   * or k_NotRead if no filter reads it before it is created again.
+   * @param arrayPath
+   * @param createdIndex
+   * @return
+   */
+  size_t lastReader(const DataArrayPath& arrayPath, size_t createdIndex) const;
+
+  /**
+   * @brief Returns true if the array created by the filter at createdIndex is no longer needed once the
+   * filter at filterIndex has executed.
+   * @param arrayPath
+   * @param createdIndex
+   * @param filterIndex
+   * @return
+   */
+  bool isDeadAfter(const DataArrayPath& arrayPath, size_t createdIndex, size_t filterIndex) const;
+
+  /**
+   * @brief Returns the created array paths of the pipeline that die right after the filter at the given
+   * index. Only the array level paths recorded by preflight are considered.
+   * @param filterIndex
+   * @return
+   */
+  std::vector<DataArrayPath> getDeadArrayPaths(size_t filterIndex) const;
+
+  /**
+   * @brief Records the arrays the DataContainerArray holds before the first filter executes
+   * @param dca
+   */
+  void beginExecution(DataContainerArray& dca);
+
+  /**
+   * @brief Records the arrays of a DataContainerArray that was restored from a checkpoint taken after the filter
+   * at the given index. An array that a filter up to that index creates is tracked as created by the last of
+   * them; only the remaining arrays belong to the caller.
+   * @param dca
+   * @param filterIndex
+   */
+  void resumeExecution(DataContainerArray& dca, size_t filterIndex);
+
+  /**
+   * @brief Removes the arrays that are dead once the filter at the given index has executed.
+   * @param dca
+   * @param filterIndex
+   * @return The number of arrays that were removed
+   */
+  size_t releaseDeadArrays(DataContainerArray& dca, size_t filterIndex);
+
+  /**
+   * @brief Returns the number of bytes held by the arrays that were removed during execution
+   * @return
+   */
+  size_t getReleasedBytes() const;
+
+private:
+  struct TrackedArray
+  {
+    std::weak_ptr<IDataArray> array;
+    size_t createdIndex = 0;
+    bool callerOwned = false;
+  };
+
+  std::vector<FilterDataAccess> m_Plan;
+  std::vector<DataArrayPath> m_PinnedPaths;
+  std::map<const IDataArray*, TrackedArray> m_Tracked;
+  size_t m_ReleasedBytes = 0;
+
+  /**
+   * @brief Brings the tracked arrays up to date with the DataContainerArray
+   * @param dca
+   * @param filterIndex The index of the filter that executed last
+   * @param callerOwned
+   */
+  void track(DataContainerArray& dca, size_t filterIndex, bool callerOwned);
+};
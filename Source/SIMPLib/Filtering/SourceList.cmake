@@ -21,12 +21,17 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractComparison.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonEvaluator.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonSet.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonValue.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CoreConstants.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterDataAccess.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterFactory.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IFilterFactory.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryBudgetGovernor.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineCheckpointer.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineLiveness.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.h
 )
@@ -38,12 +43,17 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BadFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonInputs.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonEvaluator.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonInputsAdvanced.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonSet.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonValue.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CorePlugin.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterDataAccess.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterPipeline.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryBudgetGovernor.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineCheckpointer.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineLiveness.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.cpp
 )
@@ -33,14 +33,25 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+
+#include <QtCore/QDir>
 #include <QtCore/QFile>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/MemoryBudgetGovernor.h"
+#include "SIMPLib/Filtering/PipelineCheckpointer.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 
 #ifdef SIMPL_BUILD_TEST_FILTERS
@@ -51,12 +62,122 @@
 #include "SIMPLib/TestFilters/ThresholdExample.h"
 #endif
 
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+namespace
+{
+/**
+ * @brief The CopyTupleFilter class copies the second tuple over the first one in every array of the
+ * AttributeMatrix that holds the selected array, the way cleanup filters copy whole tuples. Only the selected
+ * array is declared, so the filter works on arrays the pipeline does not know it touches. It fails when an array
+ * is shorter than its AttributeMatrix.
+ *
+ * The class is not run through moc; the selected path is kept as a dynamic property, which is where
+ * FilterDataAccess::Collect looks for it. Failing is not a filter parameter, so it does not change the
+ * pipeline hash.
+ */
+class CopyTupleFilter : public AbstractFilter
+{
+public:
+  using Self = CopyTupleFilter;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New(const DataArrayPath& selectedArrayPath)
+  {
+    Pointer val = std::make_shared<CopyTupleFilter>();
+    val->setupFilterParameters();
+    val->setSelectedArrayPath(selectedArrayPath);
+    return val;
+  }
+
+  CopyTupleFilter() = default;
+  ~CopyTupleFilter() override = default;
+
+  void setSelectedArrayPath(const DataArrayPath& value)
+  {
+    setProperty("SelectedArrayPath", QVariant::fromValue(value));
+  }
+  DataArrayPath getSelectedArrayPath() const
+  {
+    return property("SelectedArrayPath").value<DataArrayPath>();
+  }
+
+  void setFailing(bool value)
+  {
+    m_Failing = value;
+  }
+
+  QString getNameOfClass() const override
+  {
+    return QString("CopyTupleFilter");
+  }
+  QUuid getUuid() const override
+  {
+    return QUuid("{3f7c1a52-61d4-5b7e-9a2c-0c5f8e4d2b19}");
+  }
+
+  void setupFilterParameters() override
+  {
+    FilterParameterVectorType parameters;
+    DataArraySelectionFilterParameter::RequirementType req;
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Selected Array", SelectedArrayPath, FilterParameter::Category::RequiredArray, CopyTupleFilter, req));
+    setFilterParameters(parameters);
+  }
+
+  void execute() override
+  {
+    clearErrorCode();
+    clearWarningCode();
+    if(m_Failing)
+    {
+      setErrorCondition(-3, "The filter was told to fail");
+      return;
+    }
+    AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(getSelectedArrayPath());
+    if(nullptr == am)
+    {
+      setErrorCondition(-1, "The AttributeMatrix of the selected array does not exist");
+      return;
+    }
+    for(const auto& name : am->getAttributeArrayNames())
+    {
+      IDataArray::Pointer array = am->getAttributeArray(name);
+      if(array->getNumberOfTuples() != am->getNumberOfTuples() || array->copyTuple(1, 0) < 0)
+      {
+        setErrorCondition(-2, QString("Array '%1' does not hold a value for every tuple").arg(name));
+        return;
+      }
+    }
+  }
+
+protected:
+  void dataCheck() override
+  {
+  }
+
+private:
+  bool m_Failing = false;
+
+  CopyTupleFilter(const CopyTupleFilter&) = delete;            // Copy Constructor Not Implemented
+  CopyTupleFilter(CopyTupleFilter&&) = delete;                 // Move Constructor Not Implemented
+  CopyTupleFilter& operator=(const CopyTupleFilter&) = delete; // Copy Assignment Not Implemented
+  CopyTupleFilter& operator=(CopyTupleFilter&&) = delete;      // Move Assignment Not Implemented
+};
+} // namespace
+
 class FilterPipelineTest
 {
+  const size_t k_NumTuples = 1000;
+  const size_t k_ArrayBytes = k_NumTuples * sizeof(float);
+
 public:
   FilterPipelineTest() = default;
   virtual ~FilterPipelineTest() = default;
@@ -84,6 +205,10 @@ public:
   {
     return UnitTest::TestTempDir + QString("/FilterPipelineTest.dream3d");
   }
+  QString checkpointDirectory()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTest");
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -92,6 +217,7 @@ public:
   {
 #if REMOVE_TEST_FILES
     QFile::remove(outputDREAM3DFile());
+    QDir(checkpointDirectory()).removeRecursively();
 #endif
   }
 
@@ -151,6 +277,291 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createArray(DataContainer& dc, const QString& amName, const QString& name, float value)
+  {
+    AttributeMatrix::Pointer am = dc.getAttributeMatrix(amName);
+    if(nullptr == am)
+    {
+      am = AttributeMatrix::New({k_NumTuples}, amName, AttributeMatrix::Type::Cell);
+      dc.addOrReplaceAttributeMatrix(am);
+    }
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(k_NumTuples, name, true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      array->setValue(i, value + static_cast<float>(i));
+    }
+    am->insertOrAssign(array);
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Returns true if the array holds its initial values with the second tuple copied over the first one
+  // -----------------------------------------------------------------------------
+  bool hasCopiedTuple(const FloatArrayType::Pointer& array, float value)
+  {
+    if(array->getNumberOfTuples() != k_NumTuples || array->getValue(0) != value + 1.0f)
+    {
+      return false;
+    }
+    for(size_t i = 1; i < k_NumTuples; i++)
+    {
+      if(array->getValue(i) != value + static_cast<float>(i))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Three filters work on Other/C, Cell/A and Other/C again and each one copies tuples across its whole
+  // AttributeMatrix. The budget holds two of the three arrays, so after the first filter one array is spilled.
+  // Cell/B is read by no filter, but it must not be the one spilled since the second filter copies its tuples.
+  // -----------------------------------------------------------------------------
+  void TestMemoryBudgetSiblingArrays()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    FloatArrayType::Pointer a = createArray(*dc, "Cell", "A", 0.0f);
+    FloatArrayType::Pointer b = createArray(*dc, "Cell", "B", 1000.0f);
+    FloatArrayType::Pointer c = createArray(*dc, "Other", "C", 2000.0f);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(CopyTupleFilter::New(DataArrayPath("DataContainer", "Other", "C")));
+    pipeline->pushBack(CopyTupleFilter::New(DataArrayPath("DataContainer", "Cell", "A")));
+    pipeline->pushBack(CopyTupleFilter::New(DataArrayPath("DataContainer", "Other", "C")));
+    pipeline->setMemoryBudget(2 * k_ArrayBytes);
+    pipeline->setScratchDirectory(UnitTest::TestTempDir);
+
+    DataContainerArray::Pointer result = pipeline->execute(dca);
+    DREAM3D_REQUIRE_VALID_POINTER(result.get())
+    DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+    DREAM3D_REQUIRE(hasCopiedTuple(a, 0.0f))
+    DREAM3D_REQUIRE(hasCopiedTuple(b, 1000.0f))
+    DREAM3D_REQUIRE(hasCopiedTuple(c, 2000.0f))
+  }
+
+  // -----------------------------------------------------------------------------
+  // The created array is last read in front of the writer. Releasing dead arrays must not drop it from the
+  // written file, but it is still released once the writer executed.
+  // -----------------------------------------------------------------------------
+  void TestReleaseDeadArraysWriter()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(k_NumTuples, 1, 1);
+    dc->setGeometry(image);
+    dca->addOrReplaceDataContainer(dc);
+    FloatArrayType::Pointer a = createArray(*dc, "Cell", "A", 0.0f);
+    DataArrayPath createdPath("DataContainer", "Cell", "Created");
+
+    CreateDataArray::Pointer createDataArray = CreateDataArray::New();
+    createDataArray->setNewArray(createdPath);
+    createDataArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    createDataArray->setNumberOfComponents(1);
+    createDataArray->setInitializationValue("7");
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setOutputFile(outputDREAM3DFile());
+    writer->setWriteXdmfFile(false);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(createDataArray);
+    pipeline->pushBack(CopyTupleFilter::New(createdPath));
+    pipeline->pushBack(writer);
+    pipeline->pushBack(CopyTupleFilter::New(DataArrayPath("DataContainer", "Cell", "A")));
+    pipeline->setReleaseDeadArrays(true);
+
+    DataContainerArray::Pointer result = pipeline->execute(dca);
+    DREAM3D_REQUIRE_VALID_POINTER(result.get())
+    DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+    DREAM3D_REQUIRE(!dc->getAttributeMatrix("Cell")->contains("Created"))
+    DREAM3D_REQUIRE(hasCopiedTuple(a, 0.0f))
+
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(outputDREAM3DFile());
+    reader->setDataContainerArray(readDca);
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(outputDREAM3DFile());
+    reader->setInputFileDataContainerArrayProxy(proxy);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    AttributeMatrix::Pointer readAm = readDca->getAttributeMatrix(createdPath);
+    DREAM3D_REQUIRE_VALID_POINTER(readAm.get())
+    FloatArrayType::Pointer created = readAm->getAttributeArrayAs<FloatArrayType>(createdPath.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(created.get())
+    DREAM3D_REQUIRE_EQUAL(created->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(created->getValue(k_NumTuples - 1), 7.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  // The first execution fails in filter 2 after a checkpoint was taken after filter 1. The second one resumes
+  // from it; the array filter 0 created comes back from the checkpoint and is still released after its last
+  // reader, while the caller's array is kept.
+  // -----------------------------------------------------------------------------
+  void TestResumeFromCheckpoint()
+  {
+    QDir(checkpointDirectory()).removeRecursively();
+    DataArrayPath inputPath("DataContainer", "Cell", "A");
+    DataArrayPath createdPath("DataContainer", "Cell", "Created");
+
+    CreateDataArray::Pointer createDataArray = CreateDataArray::New();
+    createDataArray->setNewArray(createdPath);
+    createDataArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    createDataArray->setNumberOfComponents(1);
+    createDataArray->setInitializationValue("7");
+    CopyTupleFilter::Pointer failingFilter = CopyTupleFilter::New(createdPath);
+    failingFilter->setFailing(true);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(createDataArray);
+    pipeline->pushBack(CopyTupleFilter::New(inputPath));
+    pipeline->pushBack(failingFilter);
+    pipeline->pushBack(CopyTupleFilter::New(inputPath));
+    pipeline->setReleaseDeadArrays(true);
+    pipeline->setCheckpointDirectory(checkpointDirectory());
+    pipeline->setCheckpointFilters({1});
+    pipeline->setResumeFromCheckpoint(true);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    createArray(*dc, "Cell", "A", 0.0f);
+    pipeline->execute(dca);
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Failed)
+
+    PipelineCheckpointer::Checkpoint checkpoint;
+    DREAM3D_REQUIRE(PipelineCheckpointer(checkpointDirectory(), pipeline->getPipelineHash()).findLatest(checkpoint))
+    DREAM3D_REQUIRE_EQUAL(checkpoint.filterIndex, 1)
+
+    failingFilter->setFailing(false);
+    dca = DataContainerArray::New();
+    dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    createArray(*dc, "Cell", "A", 0.0f);
+    DataContainerArray::Pointer result = pipeline->execute(dca);
+    DREAM3D_REQUIRE_VALID_POINTER(result.get())
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+    AttributeMatrix::Pointer am = result->getAttributeMatrix(inputPath);
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE(!am->contains(createdPath.getDataArrayName()))
+    FloatArrayType::Pointer input = am->getAttributeArrayAs<FloatArrayType>(inputPath.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(input.get())
+    DREAM3D_REQUIRE(hasCopiedTuple(input, 0.0f))
+
+    // A completed pipeline leaves no checkpoint behind
+    DREAM3D_REQUIRE(!PipelineCheckpointer(checkpointDirectory(), pipeline->getPipelineHash()).findLatest(checkpoint))
+  }
+
+  // -----------------------------------------------------------------------------
+  // The budget holds one of the three arrays, so two are spilled. A checkpoint of the data structure must hold
+  // all three without faulting the spilled ones back in: they are written one at a time and stay spilled.
+  // -----------------------------------------------------------------------------
+  void TestCheckpointSpilledArrays()
+  {
+    QDir(checkpointDirectory()).removeRecursively();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    std::vector<std::pair<FloatArrayType::Pointer, float>> arrays = {
+        {createArray(*dc, "Cell", "A", 0.0f), 0.0f}, {createArray(*dc, "Cell", "B", 1000.0f), 1000.0f}, {createArray(*dc, "Other", "C", 2000.0f), 2000.0f}};
+
+    MemoryBudgetGovernor governor(k_ArrayBytes, UnitTest::TestTempDir);
+    DREAM3D_REQUIRE(governor.release(*dca, 0) >= 0)
+    DREAM3D_REQUIRE_EQUAL(governor.getSpillCount(), 2)
+    size_t residentBytes = governor.getResidentBytes();
+
+    PipelineCheckpointer checkpointer(checkpointDirectory(), "TestCheckpointSpilledArrays");
+    int err = checkpointer.write(governor.createResidentCopy(*dca), 0, [&governor, &dca](hid_t dcaGid) { return governor.writeSpilledArrays(*dca, dcaGid); });
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(governor.getFaultCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.getResidentBytes(), residentBytes)
+    size_t numSpilled = std::count_if(arrays.begin(), arrays.end(), [](const auto& item) { return item.first->getNumberOfTuples() == 0; });
+    DREAM3D_REQUIRE_EQUAL(numSpilled, 2)
+
+    PipelineCheckpointer::Checkpoint checkpoint;
+    DREAM3D_REQUIRE(checkpointer.findLatest(checkpoint))
+    DataContainerArray::Pointer readDca = checkpointer.read(checkpoint);
+    DREAM3D_REQUIRE_VALID_POINTER(readDca.get())
+    for(const auto& item : arrays)
+    {
+      DataArrayPath path = item.first->getDataArrayPath();
+      AttributeMatrix::Pointer readAm = readDca->getAttributeMatrix(path);
+      DREAM3D_REQUIRE_VALID_POINTER(readAm.get())
+      FloatArrayType::Pointer readArray = readAm->getAttributeArrayAs<FloatArrayType>(path.getDataArrayName());
+      DREAM3D_REQUIRE_VALID_POINTER(readArray.get())
+      DREAM3D_REQUIRE_EQUAL(readArray->getNumberOfTuples(), k_NumTuples)
+      for(size_t i = 0; i < k_NumTuples; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readArray->getValue(i), item.second + static_cast<float>(i))
+      }
+    }
+
+    DREAM3D_REQUIRE(governor.restoreAll(*dca) >= 0)
+    for(const auto& item : arrays)
+    {
+      DREAM3D_REQUIRE_EQUAL(item.first->getNumberOfTuples(), k_NumTuples)
+      DREAM3D_REQUIRE_EQUAL(item.first->getValue(k_NumTuples - 1), item.second + static_cast<float>(k_NumTuples - 1))
+    }
+    checkpointer.clear();
+  }
+
+  // -----------------------------------------------------------------------------
+  // MultiThresholdObjects names its input through ComparisonInputs instead of a DataArrayPath. The array that is
+  // created in front of it must survive until the threshold read it, which only the preflight can tell.
+  // -----------------------------------------------------------------------------
+  void TestReleaseDeadArraysComparisonInputs()
+  {
+    DataArrayPath amPath("DataContainer", "Cell", "");
+    DataArrayPath createdPath("DataContainer", "Cell", "Created");
+    DataArrayPath maskPath("DataContainer", "Cell", "Mask");
+
+    CreateDataContainer::Pointer createDataContainer = CreateDataContainer::New();
+    createDataContainer->setDataContainerName(DataArrayPath("DataContainer", "", ""));
+    CreateAttributeMatrix::Pointer createAttributeMatrix = CreateAttributeMatrix::New();
+    createAttributeMatrix->setCreatedAttributeMatrix(amPath);
+    createAttributeMatrix->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{static_cast<double>(k_NumTuples)}};
+    createAttributeMatrix->setTupleDimensions(DynamicTableData(tupleDims));
+    CreateDataArray::Pointer createDataArray = CreateDataArray::New();
+    createDataArray->setNewArray(createdPath);
+    createDataArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    createDataArray->setNumberOfComponents(1);
+    createDataArray->setInitializationValue("7");
+    MultiThresholdObjects::Pointer threshold = MultiThresholdObjects::New();
+    ComparisonInputs inputs;
+    inputs.addInput(createdPath.getDataContainerName(), createdPath.getAttributeMatrixName(), createdPath.getDataArrayName(), SIMPL::Comparison::Operator_GreaterThan, 5.0);
+    threshold->setSelectedThresholds(inputs);
+    threshold->setDestinationArrayName(maskPath.getDataArrayName());
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(createDataContainer);
+    pipeline->pushBack(createAttributeMatrix);
+    pipeline->pushBack(createDataArray);
+    pipeline->pushBack(threshold);
+    pipeline->setReleaseDeadArrays(true);
+    pipeline->setPinnedPaths({maskPath});
+
+    DREAM3D_REQUIRE(pipeline->preflightPipeline() >= 0)
+    DataContainerArray::Pointer result = pipeline->execute();
+    DREAM3D_REQUIRE_VALID_POINTER(result.get())
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+    AttributeMatrix::Pointer am = result->getAttributeMatrix(amPath);
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE(!am->contains(createdPath.getDataArrayName()))
+    BoolArrayType::Pointer mask = am->getAttributeArrayAs<BoolArrayType>(maskPath.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE(mask->getValue(k_NumTuples - 1))
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,9 +576,14 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestMemoryBudgetSiblingArrays());
+    DREAM3D_REGISTER_TEST(TestReleaseDeadArraysWriter());
+    DREAM3D_REGISTER_TEST(TestResumeFromCheckpoint());
+    DREAM3D_REGISTER_TEST(TestCheckpointSpilledArrays());
+    DREAM3D_REGISTER_TEST(TestReleaseDeadArraysComparisonInputs());
 
 #if REMOVE_TEST_FILES
-//  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
 #endif
   }
 
@@ -0,0 +1,257 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterDataAccess.h"
+#include "SIMPLib/Filtering/MemoryBudgetGovernor.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MemoryBudgetGovernorTest
+{
+  const size_t k_NumTuples = 1000;
+  const size_t k_ArrayBytes = k_NumTuples * sizeof(float);
+
+public:
+  MemoryBudgetGovernorTest() = default;
+  virtual ~MemoryBudgetGovernorTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataArrayPath arrayPath(const QString& amName, const QString& name)
+  {
+    return DataArrayPath("DataContainer", amName, name);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createArray(DataContainerArray& dca, const QString& amName, const QString& name, float value)
+  {
+    DataContainer::Pointer dc = dca.getDataContainer("DataContainer");
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+    if(nullptr == am)
+    {
+      am = AttributeMatrix::New({k_NumTuples}, amName, AttributeMatrix::Type::Cell);
+      dc->addOrReplaceAttributeMatrix(am);
+    }
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(k_NumTuples, name, true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      array->setValue(i, value + static_cast<float>(i));
+    }
+    am->insertOrAssign(array);
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool hasValues(const FloatArrayType::Pointer& array, float value)
+  {
+    if(array->getNumberOfTuples() != k_NumTuples)
+    {
+      return false;
+    }
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(array->getValue(i) != value + static_cast<float>(i))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFilterDataAccess()
+  {
+    DREAM3D_REQUIRE(FilterDataAccess::Covers(arrayPath("Cell", "A"), arrayPath("Cell", "A")))
+    DREAM3D_REQUIRE(FilterDataAccess::Covers(arrayPath("Cell", ""), arrayPath("Cell", "A")))
+    DREAM3D_REQUIRE(FilterDataAccess::Covers(DataArrayPath("DataContainer", "", ""), arrayPath("Cell", "A")))
+    DREAM3D_REQUIRE(!FilterDataAccess::Covers(arrayPath("Cell", "B"), arrayPath("Cell", "A")))
+    DREAM3D_REQUIRE(!FilterDataAccess::Covers(DataArrayPath("Other", "", ""), arrayPath("Cell", "A")))
+
+    FilterDataAccess access({arrayPath("Cell", "A")}, {arrayPath("Feature", "B")});
+    DREAM3D_REQUIRE(access.reads(arrayPath("Cell", "A")))
+    DREAM3D_REQUIRE(!access.reads(arrayPath("Feature", "B")))
+    DREAM3D_REQUIRE(access.creates(arrayPath("Feature", "B")))
+
+    // The siblings of declared arrays are part of the AttributeMatrices the filter works on
+    DREAM3D_REQUIRE(access.touchesAttributeMatrixOf(arrayPath("Cell", "C")))
+    DREAM3D_REQUIRE(access.touchesAttributeMatrixOf(arrayPath("Feature", "C")))
+    DREAM3D_REQUIRE(!access.touchesAttributeMatrixOf(arrayPath("Ensemble", "C")))
+
+    FilterDataAccess everything({}, {}, true);
+    DREAM3D_REQUIRE(everything.reads(arrayPath("Feature", "B")))
+    DREAM3D_REQUIRE(everything.touchesAttributeMatrixOf(arrayPath("Ensemble", "C")))
+  }
+
+  // -----------------------------------------------------------------------------
+  // Four filters: the first creates A, B and C, each in its own AttributeMatrix, the second reads A, the third
+  // reads B and the last reads C. The budget holds two arrays.
+  // -----------------------------------------------------------------------------
+  void TestSpillAndFaultIn()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<FilterDataAccess> plan;
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("AttributeMatrixA", "A"), arrayPath("AttributeMatrixB", "B"), arrayPath("AttributeMatrixC", "C")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("AttributeMatrixA", "A")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("AttributeMatrixB", "B")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("AttributeMatrixC", "C")}, std::vector<DataArrayPath>());
+
+    MemoryBudgetGovernor governor(2 * k_ArrayBytes, UnitTest::TestTempDir);
+    governor.setPlan(plan);
+
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 0), 0)
+    FloatArrayType::Pointer a = createArray(*dca, "AttributeMatrixA", "A", 0.0f);
+    FloatArrayType::Pointer b = createArray(*dca, "AttributeMatrixB", "B", 1000.0f);
+    FloatArrayType::Pointer c = createArray(*dca, "AttributeMatrixC", "C", 2000.0f);
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 0), 0)
+
+    // A is read next and stays resident; C is read last and is spilled first
+    DREAM3D_REQUIRE(governor.getResidentBytes() <= governor.getBudget())
+    DREAM3D_REQUIRE_EQUAL(governor.getPeakResidentBytes(), 3 * k_ArrayBytes)
+    DREAM3D_REQUIRE_EQUAL(governor.getSpillCount(), 1)
+    DREAM3D_REQUIRE(hasValues(a, 0.0f))
+    DREAM3D_REQUIRE(hasValues(b, 1000.0f))
+    DREAM3D_REQUIRE_EQUAL(c->getNumberOfTuples(), 0)
+
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(c->getNumberOfTuples(), 0)
+
+    // The filter reading C faults it back in, which spills an array nobody reads anymore
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 2), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 2), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 3), 0)
+    DREAM3D_REQUIRE(hasValues(c, 2000.0f))
+    DREAM3D_REQUIRE_EQUAL(governor.getFaultCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 3), 0)
+    DREAM3D_REQUIRE(governor.getResidentBytes() <= governor.getBudget())
+
+    DREAM3D_REQUIRE_EQUAL(governor.restoreAll(*dca), 0)
+    DREAM3D_REQUIRE(hasValues(a, 0.0f))
+    DREAM3D_REQUIRE(hasValues(b, 1000.0f))
+    DREAM3D_REQUIRE(hasValues(c, 2000.0f))
+  }
+
+  // -----------------------------------------------------------------------------
+  // A spilled array that is removed from the data structure is simply forgotten
+  // -----------------------------------------------------------------------------
+  void TestRemovedArray()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<FilterDataAccess> plan;
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("AttributeMatrixA", "A"), arrayPath("AttributeMatrixB", "B")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("AttributeMatrixB", "B")}, std::vector<DataArrayPath>());
+
+    MemoryBudgetGovernor governor(k_ArrayBytes, UnitTest::TestTempDir);
+    governor.setPlan(plan);
+    createArray(*dca, "AttributeMatrixA", "A", 0.0f);
+    FloatArrayType::Pointer b = createArray(*dca, "AttributeMatrixB", "B", 1000.0f);
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 0), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.getSpillCount(), 1)
+
+    dc->getAttributeMatrix("AttributeMatrixA")->removeAttributeArray("A");
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.getResidentBytes(), k_ArrayBytes)
+    DREAM3D_REQUIRE_EQUAL(governor.restoreAll(*dca), 0)
+    DREAM3D_REQUIRE(hasValues(b, 1000.0f))
+  }
+
+  // -----------------------------------------------------------------------------
+  // Three filters: the first creates A and B in one AttributeMatrix and C in another, the second reads C and the
+  // last reads A. B is never read, but it shares the AttributeMatrix of A and is faulted in along with it.
+  // -----------------------------------------------------------------------------
+  void TestSiblingArrays()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<FilterDataAccess> plan;
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("Cell", "A"), arrayPath("Cell", "B"), arrayPath("Other", "C")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("Other", "C")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("Cell", "A")}, std::vector<DataArrayPath>());
+
+    MemoryBudgetGovernor governor(k_ArrayBytes, UnitTest::TestTempDir);
+    governor.setPlan(plan);
+    FloatArrayType::Pointer a = createArray(*dca, "Cell", "A", 0.0f);
+    FloatArrayType::Pointer b = createArray(*dca, "Cell", "B", 1000.0f);
+    FloatArrayType::Pointer c = createArray(*dca, "Other", "C", 2000.0f);
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 0), 0)
+    DREAM3D_REQUIRE_EQUAL(a->getNumberOfTuples(), 0)
+    DREAM3D_REQUIRE_EQUAL(b->getNumberOfTuples(), 0)
+    DREAM3D_REQUIRE(hasValues(c, 2000.0f))
+
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.release(*dca, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(governor.prepare(*dca, 2), 0)
+    DREAM3D_REQUIRE(hasValues(a, 0.0f))
+    DREAM3D_REQUIRE(hasValues(b, 1000.0f))
+    DREAM3D_REQUIRE_EQUAL(governor.restoreAll(*dca), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### MemoryBudgetGovernorTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFilterDataAccess())
+    DREAM3D_REGISTER_TEST(TestSpillAndFaultIn())
+    DREAM3D_REGISTER_TEST(TestRemovedArray())
+    DREAM3D_REGISTER_TEST(TestSiblingArrays())
+  }
+
+private:
+  MemoryBudgetGovernorTest(const MemoryBudgetGovernorTest&); // Copy Constructor Not Implemented
+  void operator=(const MemoryBudgetGovernorTest&);           // Move assignment Not Implemented
+};
@@ -0,0 +1,195 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/PipelineCheckpointer.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PipelineCheckpointerTest
+{
+  const size_t k_NumTuples = 1000;
+
+public:
+  PipelineCheckpointerTest() = default;
+  virtual ~PipelineCheckpointerTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString checkpointDirectory()
+  {
+    return UnitTest::TestTempDir + "/PipelineCheckpointerTest";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir(checkpointDirectory()).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure(float value)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({k_NumTuples}, "AttributeMatrix", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(k_NumTuples, "Values", true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      array->setValue(i, value + static_cast<float>(i));
+    }
+    am->insertOrAssign(array);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool hasValues(const DataContainerArray::Pointer& dca, float value)
+  {
+    FloatArrayType::Pointer array = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, DataArrayPath("DataContainer", "AttributeMatrix", "Values"), {1});
+    if(nullptr == array || array->getNumberOfTuples() != k_NumTuples)
+    {
+      return false;
+    }
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(array->getValue(i) != value + static_cast<float>(i))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWriteAndResume(bool asynchronous)
+  {
+    QDir(checkpointDirectory()).removeRecursively();
+
+    PipelineCheckpointer::Checkpoint checkpoint;
+    {
+      PipelineCheckpointer checkpointer(checkpointDirectory(), "Hash");
+      checkpointer.setAsynchronous(asynchronous);
+      DREAM3D_REQUIRE(!checkpointer.findLatest(checkpoint))
+
+      // The live data structure changes right after write() returns; the checkpoint must not see that
+      DataContainerArray::Pointer dca = createDataStructure(0.0f);
+      DREAM3D_REQUIRE_EQUAL(checkpointer.write(dca, 3), 0)
+      dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""))->removeAttributeArray("Values");
+      DREAM3D_REQUIRE_EQUAL(checkpointer.write(createDataStructure(100.0f), 7), 0)
+      DREAM3D_REQUIRE_EQUAL(checkpointer.waitForPendingWrite(), 0)
+      DREAM3D_REQUIRE_EQUAL(checkpointer.getWriteCount(), 2)
+    }
+
+    // Only the latest checkpoint is kept and a different pipeline does not see it
+    PipelineCheckpointer other(checkpointDirectory(), "OtherHash");
+    DREAM3D_REQUIRE(!other.findLatest(checkpoint))
+
+    PipelineCheckpointer checkpointer(checkpointDirectory(), "Hash");
+    DREAM3D_REQUIRE(checkpointer.findLatest(checkpoint))
+    DREAM3D_REQUIRE_EQUAL(checkpoint.filterIndex, 7)
+    DREAM3D_REQUIRE(!QFileInfo::exists(checkpointDirectory() + "/Checkpoint_3.dream3d"))
+    DataContainerArray::Pointer dca = checkpointer.read(checkpoint);
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    DREAM3D_REQUIRE(hasValues(dca, 100.0f))
+
+    checkpointer.clear();
+    DREAM3D_REQUIRE(!checkpointer.findLatest(checkpoint))
+    DREAM3D_REQUIRE(!QFileInfo::exists(checkpoint.filePath))
+  }
+
+  // -----------------------------------------------------------------------------
+  // The first checkpoint cannot be written since a directory is in the way of its file. The second one is
+  // written anyway and the first error is reported by whichever call finds out about it.
+  // -----------------------------------------------------------------------------
+  void TestFailedWrite(bool asynchronous)
+  {
+    QDir(checkpointDirectory()).removeRecursively();
+    DREAM3D_REQUIRE(QDir().mkpath(checkpointDirectory() + "/Checkpoint_0.dream3d.part"))
+
+    PipelineCheckpointer checkpointer(checkpointDirectory(), "Hash");
+    checkpointer.setAsynchronous(asynchronous);
+    int err0 = checkpointer.write(createDataStructure(0.0f), 0);
+    int err1 = checkpointer.write(createDataStructure(100.0f), 1);
+    DREAM3D_REQUIRE_EQUAL(std::min(err0, err1), PipelineCheckpointer::k_WriteError)
+    DREAM3D_REQUIRE_EQUAL(std::max(err0, err1), 0)
+    DREAM3D_REQUIRE_EQUAL(checkpointer.waitForPendingWrite(), 0)
+    DREAM3D_REQUIRE_EQUAL(checkpointer.getWriteCount(), 1)
+
+    PipelineCheckpointer::Checkpoint checkpoint;
+    DREAM3D_REQUIRE(checkpointer.findLatest(checkpoint))
+    DREAM3D_REQUIRE_EQUAL(checkpoint.filterIndex, 1)
+    DataContainerArray::Pointer dca = checkpointer.read(checkpoint);
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    DREAM3D_REQUIRE(hasValues(dca, 100.0f))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineCheckpointerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestWriteAndResume(false))
+    DREAM3D_REGISTER_TEST(TestWriteAndResume(true))
+    DREAM3D_REGISTER_TEST(TestFailedWrite(false))
+    DREAM3D_REGISTER_TEST(TestFailedWrite(true))
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  PipelineCheckpointerTest(const PipelineCheckpointerTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineCheckpointerTest&);           // Move assignment Not Implemented
+};
@@ -0,0 +1,209 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterDataAccess.h"
+#include "SIMPLib/Filtering/PipelineLiveness.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PipelineLivenessTest
+{
+  const size_t k_NumTuples = 100;
+
+public:
+  PipelineLivenessTest() = default;
+  virtual ~PipelineLivenessTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataArrayPath arrayPath(const QString& name)
+  {
+    return DataArrayPath("DataContainer", "AttributeMatrix", name);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void createArray(DataContainerArray& dca, const QString& name)
+  {
+    AttributeMatrix::Pointer am = dca.getAttributeMatrix(arrayPath(""));
+    am->insertOrAssign(FloatArrayType::CreateArray(k_NumTuples, name, true));
+  }
+
+  // -----------------------------------------------------------------------------
+  // Filter 0 creates A and B, filter 1 reads A and the caller's Input and creates C, filter 2 reads B and C
+  // and creates D which nothing reads.
+  // -----------------------------------------------------------------------------
+  std::vector<FilterDataAccess> createPlan()
+  {
+    std::vector<FilterDataAccess> plan;
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("A"), arrayPath("B")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("A"), arrayPath("Input")}, std::vector<DataArrayPath>{arrayPath("C")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("B"), arrayPath("C")}, std::vector<DataArrayPath>{arrayPath("D")});
+    return plan;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAnalysis()
+  {
+    PipelineLiveness liveness(createPlan());
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("A"), 0), 1)
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("B"), 0), 2)
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("C"), 1), 2)
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("D"), 2), PipelineLiveness::k_NotRead)
+
+    DREAM3D_REQUIRE(liveness.getDeadArrayPaths(0).empty())
+    std::vector<DataArrayPath> deadPaths = liveness.getDeadArrayPaths(1);
+    DREAM3D_REQUIRE_EQUAL(deadPaths.size(), 1)
+    DREAM3D_REQUIRE(deadPaths[0] == arrayPath("A"))
+    DREAM3D_REQUIRE_EQUAL(liveness.getDeadArrayPaths(2).size(), 2)
+    DREAM3D_REQUIRE(!liveness.isDeadAfter(arrayPath("D"), 2, 2))
+
+    // Pinning the AttributeMatrix keeps everything in it
+    liveness.setPinnedPaths({arrayPath("")});
+    DREAM3D_REQUIRE(liveness.getDeadArrayPaths(1).empty())
+    DREAM3D_REQUIRE(liveness.getDeadArrayPaths(2).empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  // An array that is present when a writer executes is part of the written output
+  // -----------------------------------------------------------------------------
+  void TestWriter()
+  {
+    std::vector<FilterDataAccess> plan;
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("A"), arrayPath("B")});
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("B")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("Output")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>{arrayPath("A")}, std::vector<DataArrayPath>());
+    plan.emplace_back(std::vector<DataArrayPath>(), std::vector<DataArrayPath>{arrayPath("C")});
+
+    PipelineLiveness liveness(plan);
+    liveness.addWriter(2);
+    // B is last read in front of the writer but is written, so it lives until the writer executed
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("B"), 0), 2)
+    DREAM3D_REQUIRE(!liveness.isDeadAfter(arrayPath("B"), 0, 1))
+    DREAM3D_REQUIRE(liveness.isDeadAfter(arrayPath("B"), 0, 2))
+    // A is written and then released after its last reader
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("A"), 0), 3)
+    DREAM3D_REQUIRE(liveness.isDeadAfter(arrayPath("A"), 0, 3))
+    // C only exists after the writer
+    DREAM3D_REQUIRE_EQUAL(liveness.lastReader(arrayPath("C"), 4), PipelineLiveness::k_NotRead)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReleaseDeadArrays()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({k_NumTuples}, "AttributeMatrix", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+    createArray(*dca, "Input");
+
+    PipelineLiveness liveness(createPlan());
+    liveness.beginExecution(*dca);
+
+    createArray(*dca, "A");
+    createArray(*dca, "B");
+    DREAM3D_REQUIRE_EQUAL(liveness.releaseDeadArrays(*dca, 0), 0)
+
+    createArray(*dca, "C");
+    DREAM3D_REQUIRE_EQUAL(liveness.releaseDeadArrays(*dca, 1), 1)
+    DREAM3D_REQUIRE(!am->contains("A"))
+    DREAM3D_REQUIRE(am->contains("Input"))
+
+    createArray(*dca, "D");
+    DREAM3D_REQUIRE_EQUAL(liveness.releaseDeadArrays(*dca, 2), 2)
+    DREAM3D_REQUIRE(!am->contains("B"))
+    DREAM3D_REQUIRE(!am->contains("C"))
+    DREAM3D_REQUIRE(am->contains("D"))
+    DREAM3D_REQUIRE(am->contains("Input"))
+    DREAM3D_REQUIRE_EQUAL(liveness.getReleasedBytes(), 3 * k_NumTuples * sizeof(float))
+  }
+
+  // -----------------------------------------------------------------------------
+  // A checkpoint taken after filter 0 holds the caller's Input and the A and B created by filter 0
+  // -----------------------------------------------------------------------------
+  void TestResumeExecution()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({k_NumTuples}, "AttributeMatrix", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+    createArray(*dca, "Input");
+    createArray(*dca, "A");
+    createArray(*dca, "B");
+
+    PipelineLiveness liveness(createPlan());
+    liveness.resumeExecution(*dca, 0);
+
+    createArray(*dca, "C");
+    DREAM3D_REQUIRE_EQUAL(liveness.releaseDeadArrays(*dca, 1), 1)
+    DREAM3D_REQUIRE(!am->contains("A"))
+    DREAM3D_REQUIRE(am->contains("Input"))
+
+    createArray(*dca, "D");
+    DREAM3D_REQUIRE_EQUAL(liveness.releaseDeadArrays(*dca, 2), 2)
+    DREAM3D_REQUIRE(!am->contains("B"))
+    DREAM3D_REQUIRE(am->contains("Input"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineLivenessTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAnalysis())
+    DREAM3D_REGISTER_TEST(TestWriter())
+    DREAM3D_REGISTER_TEST(TestReleaseDeadArrays())
+    DREAM3D_REGISTER_TEST(TestResumeExecution())
+  }
+
+private:
+  PipelineLivenessTest(const PipelineLivenessTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineLivenessTest&);       // Move assignment Not Implemented
+};
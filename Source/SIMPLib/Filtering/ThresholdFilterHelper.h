@@ -35,11 +35,15 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/IDataArrayFilter.h"
+#include "SIMPLib/DataArrays/StridedDataArrayView.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 /**
  * @brief The ThresholdFilterHelper class
@@ -52,21 +56,116 @@ public:
   ~ThresholdFilterHelper() override;
 
   /**
-   *
+   * @brief Compares count values against value and writes 1/0 into output. The comparison is selected once
+   * outside of the loop so every branch is a plain element-wise loop the compiler can vectorize.
+   * @param compType
+   * @param value
+   * @param data
+   * @param count
+   * @param output
+   */
+  template <typename T, typename OutputType>
+  static void CompareRange(SIMPL::Comparison::Enumeration compType, T value, const T* data, size_t count, OutputType* output)
+  {
+    switch(compType)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<OutputType>(data[i] < value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<OutputType>(data[i] > value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<OutputType>(data[i] == value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<OutputType>(data[i] != value);
+      }
+      break;
+    default:
+      std::fill_n(output, count, static_cast<OutputType>(0));
+      break;
+    }
+  }
+
+  /**
+   * @brief Same as CompareRange for values that are stride elements apart, such as one component of a
+   * StridedDataArrayView. The values are gathered into a small buffer that CompareRange then works on.
+   * @param compType
+   * @param value
+   * @param data
+   * @param stride
+   * @param count
+   * @param output
+   */
+  template <typename T, typename OutputType>
+  static void CompareStridedRange(SIMPL::Comparison::Enumeration compType, T value, const T* data, size_t stride, size_t count, OutputType* output)
+  {
+    if(stride == 1)
+    {
+      CompareRange(compType, value, data, count, output);
+      return;
+    }
+    constexpr size_t k_ChunkSize = 1024;
+    T chunk[k_ChunkSize];
+    for(size_t start = 0; start < count; start += k_ChunkSize)
+    {
+      const size_t chunkCount = std::min(k_ChunkSize, count - start);
+      for(size_t i = 0; i < chunkCount; ++i)
+      {
+        chunk[i] = data[(start + i) * stride];
+      }
+      CompareRange(compType, value, chunk, chunkCount, output + start);
+    }
+  }
+
+  /**
+   * @brief Returns the first value of a scalar DataArray<T> or StridedDataArrayView<T> and the distance between
+   * two consecutive values, so views are compared without being materialized. Returns nullptr for any other array.
+   * @param input
+   * @param stride
+   * @return
    */
   template <typename T>
-  void filterDataLessThan(const IDataArray::Pointer& m_Input)
+  static const T* GetScalarData(const IDataArray::Pointer& input, size_t& stride)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    using DataArrayType = DataArray<T>;
-    typename DataArrayType::Pointer dataPtr = std::dynamic_pointer_cast<DataArrayType>(m_Input);
-    T* data = dataPtr->getTuplePointer(0);
-    for(size_t i = 0; i < m_NumValues; ++i)
+    stride = 1;
+    if(typename DataArray<T>::Pointer dataPtr = std::dynamic_pointer_cast<DataArray<T>>(input))
+    {
+      return dataPtr->getPointer(0);
+    }
+    typename StridedDataArrayView<T>::Pointer view = std::dynamic_pointer_cast<StridedDataArrayView<T>>(input);
+    if(nullptr == view)
     {
-      bool b = (data[i] < v);
-      m_Output->setValue(i, b);
+      return nullptr;
     }
+    if(!view->isView())
+    {
+      // The view owns a private copy once it has been written to, this returns that copy
+      return view->materializeDataArray()->getPointer(0);
+    }
+    stride = view->getStride();
+    return view->getBaseDataArray()->getPointer(0) + view->getComponentOffset();
+  }
+
+  /**
+   *
+   */
+  template <typename T>
+  void filterDataLessThan(const IDataArray::Pointer& m_Input)
+  {
+    filterData<T>(m_Input, SIMPL::Comparison::Operator_LessThan);
   }
 
   /**
@@ -75,16 +174,7 @@ public:
   template <typename T>
   void filterDataGreaterThan(const IDataArray::Pointer& m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    using DataArrayType = DataArray<T>;
-    typename DataArrayType::Pointer dataPtr = std::dynamic_pointer_cast<DataArrayType>(m_Input);
-    T* data = dataPtr->getTuplePointer(0);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] > v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, SIMPL::Comparison::Operator_GreaterThan);
   }
 
   /**
@@ -93,16 +183,7 @@ public:
   template <typename T>
   void filterDataEqualTo(const IDataArray::Pointer& m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    using DataArrayType = DataArray<T>;
-    typename DataArrayType::Pointer dataPtr = std::dynamic_pointer_cast<DataArrayType>(m_Input);
-    T* data = dataPtr->getTuplePointer(0);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] == v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, SIMPL::Comparison::Operator_Equal);
   }
 
   /**
@@ -111,16 +192,7 @@ public:
   template <typename T>
   void filterDataNotEqualTo(const IDataArray::Pointer& m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    using DataArrayType = DataArray<T>;
-    typename DataArrayType::Pointer dataPtr = std::dynamic_pointer_cast<DataArrayType>(m_Input);
-    T* data = dataPtr->getTuplePointer(0);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] != v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, SIMPL::Comparison::Operator_NotEqual);
   }
 
   /**
@@ -132,6 +204,57 @@ public:
   int execute(const IDataArray::Pointer& input, IDataArray* output);
 
 private:
+  /**
+   * @brief Writes the result of the comparison for every tuple of the input straight into the output array,
+   * splitting the tuples across threads.
+   */
+  template <typename T>
+  void filterData(const IDataArray::Pointer& m_Input, SIMPL::Comparison::Enumeration compType)
+  {
+    size_t m_NumValues = m_Input->getNumberOfTuples();
+    T v = static_cast<T>(comparisonValue);
+    size_t stride = 1;
+    const T* data = GetScalarData<T>(m_Input, stride);
+    if(nullptr == data)
+    {
+      return;
+    }
+    bool* output = m_Output->getPointer(0);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_NumValues);
+    dataAlg.execute(CompareImpl<T>(compType, v, data, stride, output));
+  }
+
+  /**
+   * @brief Runs CompareRange over a subrange of the tuples
+   */
+  template <typename T>
+  class CompareImpl
+  {
+  public:
+    CompareImpl(SIMPL::Comparison::Enumeration compType, T value, const T* data, size_t stride, bool* output)
+    : m_CompType(compType)
+    , m_Value(value)
+    , m_Data(data)
+    , m_Stride(stride)
+    , m_Output(output)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      CompareStridedRange(m_CompType, m_Value, m_Data + range.min() * m_Stride, m_Stride, range.size(), m_Output + range.min());
+    }
+
+  private:
+    SIMPL::Comparison::Enumeration m_CompType;
+    T m_Value;
+    const T* m_Data;
+    size_t m_Stride;
+    bool* m_Output;
+  };
+
   SIMPL::Comparison::Enumeration comparisonOperator;
   double comparisonValue;
   BoolArrayType* m_Output;
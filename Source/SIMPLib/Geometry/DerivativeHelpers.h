@@ -118,4 +118,83 @@ public:
   void operator()(HexahedralGeom* hexas, size_t hexId, double values[8], double derivs[3]);
 };
 
+namespace Detail
+{
+template <typename FieldType, typename Func>
+bool ExecuteWithDerivativeType(const DataArray<FieldType>& field, IDataArray& derivatives, Func& func)
+{
+  if(auto* doubleDerivs = dynamic_cast<DoubleArrayType*>(&derivatives))
+  {
+    func(static_cast<const FieldType*>(field.getPointer(0)), doubleDerivs->getPointer(0));
+    return true;
+  }
+  if(auto* floatDerivs = dynamic_cast<FloatArrayType*>(&derivatives))
+  {
+    func(static_cast<const FieldType*>(field.getPointer(0)), floatDerivs->getPointer(0));
+    return true;
+  }
+  return false;
+}
+} // namespace Detail
+
+/**
+ * @brief Resolves the concrete types of a field and its derivatives array and calls func once with
+ * typed pointers to their data, so the derivative kernels can read the field in its native type
+ * instead of from a converted double copy. The field may be any primitive type; the derivatives
+ * must be float or double.
+ * @param field
+ * @param derivatives
+ * @param func Callable as func(const FieldType*, DerivType*)
+ * @return false if either array is of an unsupported type
+ */
+template <typename Func>
+bool ExecuteWithFieldTypes(IDataArray& field, IDataArray& derivatives, Func&& func)
+{
+  if(auto* typedField = dynamic_cast<FloatArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<DoubleArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<Int8ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<UInt8ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<Int16ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<UInt16ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<Int32ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<UInt32ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<Int64ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<UInt64ArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  if(auto* typedField = dynamic_cast<BoolArrayType*>(&field))
+  {
+    return Detail::ExecuteWithDerivativeType(*typedField, derivatives, func);
+  }
+  return false;
+}
+
 } // namespace DerivativeHelpers
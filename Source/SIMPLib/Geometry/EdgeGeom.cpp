@@ -55,22 +55,24 @@
  * @brief The FindEdgeDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying edges
  */
+template <typename FieldType, typename DerivType>
 class FindEdgeDerivativesImpl
 {
 public:
-  FindEdgeDerivativesImpl(EdgeGeom* edges, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindEdgeDerivativesImpl(EdgeGeom* edges, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Edges(edges)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindEdgeDerivativesImpl() = default;
 
   void compute(size_t start, size_t end) const
   {
-    int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t cDims = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     double values[2] = {0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     size_t verts[2] = {0, 0};
@@ -86,12 +88,12 @@ public:
       {
         for(size_t k = 0; k < 2; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = static_cast<double>(fieldPtr[cDims * verts[k] + j]);
         }
         DerivativeHelpers::EdgeDeriv()(m_Edges, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<DerivType>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<DerivType>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<DerivType>(derivs[2]);
       }
 
       if(counter > progIncrement)
@@ -110,8 +112,9 @@ public:
 
 private:
   EdgeGeom* m_Edges;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
@@ -354,20 +357,9 @@ int EdgeGeom::findElementSizes()
 {
   m_EdgeSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::EdgeLengths, true);
 
-  float* sizes = m_EdgeSizes->getPointer(0);
-  float vert0[3] = {0.0f, 0.0f, 0.0f};
-  float vert1[3] = {0.0f, 0.0f, 0.0f};
-
-  for(size_t i = 0; i < getNumberOfEdges(); i++)
-  {
-    getVertCoordsAtEdge(i, vert0, vert1);
-    float length = 0.0f;
-    for(size_t j = 0; j < 3; j++)
-    {
-      length += (vert0[j] - vert1[j]) * (vert0[j] - vert1[j]);
-    }
-    sizes[i] = sqrtf(length);
-  }
+  GeometryHelpers::ElementMetrics metrics;
+  metrics.sizes = m_EdgeSizes->getPointer(0);
+  GeometryHelpers::Topology::FindElementMetrics<GeometryHelpers::ElementShape::Edge>(*m_EdgeList, *m_VertexList, metrics);
 
   return 1;
 }
@@ -421,6 +413,14 @@ void EdgeGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t EdgeGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t numEdges = getNumberOfEdges();
@@ -430,9 +430,14 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
+  int32_t numComps = field->getNumberOfComponents();
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numEdges);
-  dataAlg.execute(FindEdgeDerivativesImpl(this, field, derivatives));
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindEdgeDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
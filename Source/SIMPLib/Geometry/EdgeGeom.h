@@ -328,6 +328,14 @@ public:
    */
   void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+  /**
+   * @brief findDerivatives
+   * @param field Any primitive type
+   * @param derivatives Float or double
+   * @return Negative value if the field or the derivatives are of an unsupported type
+   */
+  int32_t findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable = nullptr) override;
+
   /**
    * @brief getInfoString
    * @return Returns a formatted string that contains general infomation about
@@ -31,6 +31,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <memory>
@@ -49,6 +50,7 @@ using namespace H5Support;
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -992,6 +994,296 @@ public:
   }
 };
 
+/**
+ * @brief Element shapes processed by the mesh kernels
+ */
+enum class ElementShape
+{
+  Edge,
+  Triangle,
+  Quadrilateral,
+  Tetrahedron,
+  Hexahedron
+};
+
+/**
+ * @brief Number of vertices of each element shape
+ */
+template <ElementShape Shape>
+struct ElementShapeTraits;
+
+template <>
+struct ElementShapeTraits<ElementShape::Edge>
+{
+  static constexpr size_t k_NumVerts = 2;
+};
+
+template <>
+struct ElementShapeTraits<ElementShape::Triangle>
+{
+  static constexpr size_t k_NumVerts = 3;
+};
+
+template <>
+struct ElementShapeTraits<ElementShape::Quadrilateral>
+{
+  static constexpr size_t k_NumVerts = 4;
+};
+
+template <>
+struct ElementShapeTraits<ElementShape::Tetrahedron>
+{
+  static constexpr size_t k_NumVerts = 4;
+};
+
+template <>
+struct ElementShapeTraits<ElementShape::Hexahedron>
+{
+  static constexpr size_t k_NumVerts = 8;
+};
+
+/**
+ * @brief The ElementMetrics struct names the outputs of one pass of the mesh kernels. Metrics
+ * whose pointer is null are not computed. The centroids have three values per element, every
+ * other output has one.
+ */
+struct ElementMetrics
+{
+  float* centroids = nullptr;
+  float* sizes = nullptr;             // Lengths, areas or volumes depending on the element shape
+  float* jacobians = nullptr;         // Tetrahedra only
+  float* minDihedralAngles = nullptr; // Tetrahedra only, in degrees
+};
+
+/**
+ * @brief The ElementTile struct holds the vertex coordinates of a block of elements as structure
+ * of arrays, so the metric loops read contiguous memory and vectorise.
+ */
+template <size_t NumVerts>
+struct ElementTile
+{
+  static constexpr size_t k_Width = 64;
+
+  size_t count = 0;
+  alignas(64) float x[NumVerts][k_Width];
+  alignas(64) float y[NumVerts][k_Width];
+  alignas(64) float z[NumVerts][k_Width];
+
+  /**
+   * @brief Copies the vertex coordinates of the elements [start, start + numElems) into the tile
+   * @param elements Connectivity list with NumVerts vertex ids per element
+   * @param vertices Vertex coordinates with 3 components per vertex
+   * @param start
+   * @param numElems At most k_Width
+   */
+  template <typename T>
+  void gather(const T* elements, const float* vertices, size_t start, size_t numElems)
+  {
+    count = numElems;
+    const T* elem = elements + start * NumVerts;
+    for(size_t e = 0; e < numElems; e++, elem += NumVerts)
+    {
+      for(size_t v = 0; v < NumVerts; v++)
+      {
+        const float* vert = vertices + 3 * static_cast<size_t>(elem[v]);
+        x[v][e] = vert[0];
+        y[v][e] = vert[1];
+        z[v][e] = vert[2];
+      }
+    }
+  }
+};
+
+/**
+ * @brief The ElementMetricsImpl class is the parallel body of the mesh kernels. Each range is
+ * processed one tile at a time and every requested metric is computed from the same tile.
+ */
+template <typename T, ElementShape Shape>
+class ElementMetricsImpl
+{
+public:
+  static constexpr size_t k_NumVerts = ElementShapeTraits<Shape>::k_NumVerts;
+  using TileType = ElementTile<k_NumVerts>;
+
+  ElementMetricsImpl(const T* elements, const float* vertices, const ElementMetrics& metrics)
+  : m_Elements(elements)
+  , m_Vertices(vertices)
+  , m_Metrics(metrics)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    TileType tile;
+    for(size_t start = range.min(); start < range.max(); start += TileType::k_Width)
+    {
+      tile.gather(m_Elements, m_Vertices, start, std::min(TileType::k_Width, range.max() - start));
+      if(m_Metrics.centroids != nullptr)
+      {
+        centroids(tile, m_Metrics.centroids + 3 * start);
+      }
+      if(m_Metrics.sizes != nullptr)
+      {
+        sizes(tile, m_Metrics.sizes + start);
+      }
+      if constexpr(Shape == ElementShape::Tetrahedron)
+      {
+        if(m_Metrics.jacobians != nullptr)
+        {
+          jacobians(tile, m_Metrics.jacobians + start);
+        }
+        if(m_Metrics.minDihedralAngles != nullptr)
+        {
+          minDihedralAngles(tile, m_Metrics.minDihedralAngles + start);
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Elements = nullptr;
+  const float* m_Vertices = nullptr;
+  ElementMetrics m_Metrics;
+
+  /**
+   * @brief Signed volume of the tetrahedron (a, b, c, d) of each element in the tile times 6
+   */
+  static void tetDeterminants(const TileType& tile, size_t a, size_t b, size_t c, size_t d, float* out, bool accumulate)
+  {
+    for(size_t e = 0; e < tile.count; e++)
+    {
+      float ux = tile.x[b][e] - tile.x[a][e];
+      float uy = tile.y[b][e] - tile.y[a][e];
+      float uz = tile.z[b][e] - tile.z[a][e];
+      float vx = tile.x[c][e] - tile.x[a][e];
+      float vy = tile.y[c][e] - tile.y[a][e];
+      float vz = tile.z[c][e] - tile.z[a][e];
+      float wx = tile.x[d][e] - tile.x[a][e];
+      float wy = tile.y[d][e] - tile.y[a][e];
+      float wz = tile.z[d][e] - tile.z[a][e];
+      float det = ux * (vy * wz - wy * vz) - vx * (uy * wz - wy * uz) + wx * (uy * vz - vy * uz);
+      out[e] = accumulate ? out[e] + det : det;
+    }
+  }
+
+  static void centroids(const TileType& tile, float* out)
+  {
+    constexpr float k_Scale = 1.0f / static_cast<float>(k_NumVerts);
+    for(size_t e = 0; e < tile.count; e++)
+    {
+      float cx = 0.0f;
+      float cy = 0.0f;
+      float cz = 0.0f;
+      for(size_t v = 0; v < k_NumVerts; v++)
+      {
+        cx += tile.x[v][e];
+        cy += tile.y[v][e];
+        cz += tile.z[v][e];
+      }
+      out[3 * e + 0] = cx * k_Scale;
+      out[3 * e + 1] = cy * k_Scale;
+      out[3 * e + 2] = cz * k_Scale;
+    }
+  }
+
+  static void sizes(const TileType& tile, float* out)
+  {
+    if constexpr(Shape == ElementShape::Edge)
+    {
+      for(size_t e = 0; e < tile.count; e++)
+      {
+        float dx = tile.x[1][e] - tile.x[0][e];
+        float dy = tile.y[1][e] - tile.y[0][e];
+        float dz = tile.z[1][e] - tile.z[0][e];
+        out[e] = std::sqrt(dx * dx + dy * dy + dz * dz);
+      }
+    }
+    else if constexpr(Shape == ElementShape::Triangle || Shape == ElementShape::Quadrilateral)
+    {
+      // Half the magnitude of the cross product of the diagonals (the two edges for a triangle)
+      // is the area of the polygon projected along its normal
+      constexpr size_t k_A0 = 0;
+      constexpr size_t k_A1 = (Shape == ElementShape::Triangle) ? 1 : 2;
+      constexpr size_t k_B0 = (Shape == ElementShape::Triangle) ? 0 : 1;
+      constexpr size_t k_B1 = (Shape == ElementShape::Triangle) ? 2 : 3;
+      for(size_t e = 0; e < tile.count; e++)
+      {
+        float ax = tile.x[k_A1][e] - tile.x[k_A0][e];
+        float ay = tile.y[k_A1][e] - tile.y[k_A0][e];
+        float az = tile.z[k_A1][e] - tile.z[k_A0][e];
+        float bx = tile.x[k_B1][e] - tile.x[k_B0][e];
+        float by = tile.y[k_B1][e] - tile.y[k_B0][e];
+        float bz = tile.z[k_B1][e] - tile.z[k_B0][e];
+        float nx = ay * bz - az * by;
+        float ny = az * bx - ax * bz;
+        float nz = ax * by - ay * bx;
+        out[e] = 0.5f * std::sqrt(nx * nx + ny * ny + nz * nz);
+      }
+    }
+    else if constexpr(Shape == ElementShape::Tetrahedron)
+    {
+      tetDeterminants(tile, 0, 1, 2, 3, out, false);
+      for(size_t e = 0; e < tile.count; e++)
+      {
+        out[e] /= 6.0f;
+      }
+    }
+    else if constexpr(Shape == ElementShape::Hexahedron)
+    {
+      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
+      tetDeterminants(tile, 0, 1, 3, 4, out, false);
+      tetDeterminants(tile, 1, 4, 5, 6, out, true);
+      tetDeterminants(tile, 1, 4, 6, 3, out, true);
+      tetDeterminants(tile, 1, 3, 6, 2, out, true);
+      tetDeterminants(tile, 3, 6, 7, 4, out, true);
+      for(size_t e = 0; e < tile.count; e++)
+      {
+        out[e] /= 6.0f;
+      }
+    }
+  }
+
+  static void jacobians(const TileType& tile, float* out)
+  {
+    tetDeterminants(tile, 0, 1, 2, 3, out, false);
+  }
+
+  static void minDihedralAngles(const TileType& tile, float* out)
+  {
+    for(size_t e = 0; e < tile.count; e++)
+    {
+      // find 5 edges needed to find 4 face normals
+      float v10[3] = {tile.x[1][e] - tile.x[0][e], tile.y[1][e] - tile.y[0][e], tile.z[1][e] - tile.z[0][e]};
+      float v20[3] = {tile.x[2][e] - tile.x[0][e], tile.y[2][e] - tile.y[0][e], tile.z[2][e] - tile.z[0][e]};
+      float v30[3] = {tile.x[3][e] - tile.x[0][e], tile.y[3][e] - tile.y[0][e], tile.z[3][e] - tile.z[0][e]};
+      float v21[3] = {tile.x[2][e] - tile.x[1][e], tile.y[2][e] - tile.y[1][e], tile.z[2][e] - tile.z[1][e]};
+      float v31[3] = {tile.x[3][e] - tile.x[1][e], tile.y[3][e] - tile.y[1][e], tile.z[3][e] - tile.z[1][e]};
+      // find 4 face normals, all pointing into the tetrahedron (or all out of it if its vertex order is inverted)
+      float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
+      float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
+      float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
+      float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
+      // find the magnitudes of each normal
+      float norm1mag = std::sqrt(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
+      float norm2mag = std::sqrt(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
+      float norm3mag = std::sqrt(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
+      float norm4mag = std::sqrt(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
+      // find cosines of the angles between face normals
+      float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
+      float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
+      float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
+      float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
+      float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
+      float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
+      // The dihedral angle is the supplement of the angle between consistently oriented normals, so the
+      // minimum dihedral angle belongs to the minimum cosine
+      float minCos = std::min(std::min(std::min(ang1, ang2), std::min(ang3, ang4)), std::min(ang5, ang6));
+      minCos = std::max(-1.0f, std::min(1.0f, minCos));
+      out[e] = static_cast<float>(SIMPLib::Constants::k_180OverPiD) * std::acos(-minCos);
+    }
+  }
+};
+
 /**
  * @brief The Topology class
  */
@@ -1001,6 +1293,21 @@ public:
   Topology() = default;
   virtual ~Topology() = default;
 
+  /**
+   * @brief Computes the requested metrics of every element in one parallel pass over the
+   * connectivity list.
+   * @param elemList Connectivity list with one tuple per element
+   * @param vertices
+   * @param metrics Outputs, null outputs are skipped
+   */
+  template <ElementShape Shape, typename T>
+  static void FindElementMetrics(const DataArray<T>& elemList, const FloatArrayType& vertices, const ElementMetrics& metrics)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, elemList.getNumberOfTuples());
+    dataAlg.execute(ElementMetricsImpl<T, Shape>(elemList.getPointer(0), vertices.getPointer(0), metrics));
+  }
+
   /**
    * @brief FindElementCentroids
    * @param elemList
@@ -1010,24 +1317,43 @@ public:
   template <typename T>
   static void FindElementCentroids(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer centroids)
   {
+    ElementMetrics metrics;
+    metrics.centroids = centroids->getPointer(0);
+
+    // The centroid only depends on the number of vertices of the element
+    switch(elemList->getNumberOfComponents())
+    {
+    case 2:
+      FindElementMetrics<ElementShape::Edge>(*elemList, *vertices, metrics);
+      return;
+    case 3:
+      FindElementMetrics<ElementShape::Triangle>(*elemList, *vertices, metrics);
+      return;
+    case 4:
+      FindElementMetrics<ElementShape::Quadrilateral>(*elemList, *vertices, metrics);
+      return;
+    case 8:
+      FindElementMetrics<ElementShape::Hexahedron>(*elemList, *vertices, metrics);
+      return;
+    default:
+      break;
+    }
+
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
     float* elementCentroids = centroids->getPointer(0);
     float* vertex = vertices->getPointer(0);
-
-    for(size_t i = 0; i < numDims; i++)
+    for(size_t j = 0; j < numElems; j++)
     {
-      for(size_t j = 0; j < numElems; j++)
+      T* elem = elemList->getTuplePointer(j);
+      for(size_t i = 0; i < 3; i++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertPos = 0.0;
+        float vertPos = 0.0f;
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertPos += vertex[3 * Elem[k] + i];
+          vertPos += vertex[3 * elem[k] + i];
         }
-        vertPos /= static_cast<float>(numVertsPerElem);
-        elementCentroids[numDims * j + i] = vertPos;
+        elementCentroids[3 * j + i] = vertPos / static_cast<float>(numVertsPerElem);
       }
     }
   }
@@ -1041,6 +1367,22 @@ public:
   template <typename T>
   static void Find2DElementAreas(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer areas)
   {
+    ElementMetrics metrics;
+    metrics.sizes = areas->getPointer(0);
+
+    switch(elemList->getNumberOfComponents())
+    {
+    case 3:
+      FindElementMetrics<ElementShape::Triangle>(*elemList, *vertices, metrics);
+      return;
+    case 4:
+      FindElementMetrics<ElementShape::Quadrilateral>(*elemList, *vertices, metrics);
+      return;
+    default:
+      break;
+    }
+
+    // General polygons
     float nx, ny, nz;
     int32_t projection;
 
@@ -1054,9 +1396,6 @@ public:
     float* elemAreas = areas->getPointer(0);
     float normal[3] = {0.0f, 0.0f, 0.0f};
     std::vector<float> coords(3 * numVertsPerElem, 0.0f);
-    float vert0[3] = {0.0f, 0.0f, 0.0f};
-    float vert1[3] = {0.0f, 0.0f, 0.0f};
-    float vert2[3] = {0.0f, 0.0f, 0.0f};
 
     for(size_t i = 0; i < numElems; i++)
     {
@@ -1081,10 +1420,6 @@ public:
 
       for(int64_t j = 0; j < numVertsPerElem; j++)
       {
-        std::copy(coordinates + (3 * j), coordinates + (3 * j + 3), vert0);
-        std::copy(coordinates + (3 * ((j + 1) % numVertsPerElem)), coordinates + (3 * ((j + 1) % numVertsPerElem) + 3), vert1);
-        std::copy(coordinates + (3 * ((j + 2) % numVertsPerElem)), coordinates + (3 * ((j + 2) % numVertsPerElem) + 3), vert2);
-
         switch(projection)
         {
         case 0: {
@@ -1129,24 +1464,9 @@ public:
   template <typename T>
   static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
-
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-      volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-    }
+    ElementMetrics metrics;
+    metrics.sizes = volumes->getPointer(0);
+    FindElementMetrics<ElementShape::Tetrahedron>(*tetList, *vertices, metrics);
   }
 
   /**
@@ -1158,64 +1478,9 @@ public:
   template <typename T>
   static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
-    size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
-
-    for(size_t i = 0; i < numHexas; i++)
-    {
-      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
-      std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
-
-      // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
-      subTets[0][0] = hex[0];
-      subTets[0][1] = hex[1];
-      subTets[0][2] = hex[3];
-      subTets[0][3] = hex[4];
-
-      // Second tetrahedron from hexahedron vertices (1, 4, 5, 6);
-      subTets[1][0] = hex[1];
-      subTets[1][1] = hex[4];
-      subTets[1][2] = hex[5];
-      subTets[1][3] = hex[6];
-
-      // Third tetrahedron from hexahedron vertices (1, 4, 6, 3);
-      subTets[2][0] = hex[1];
-      subTets[2][1] = hex[3];
-      subTets[2][2] = hex[6];
-      subTets[2][3] = hex[3];
-
-      // Fourth tetrahedron from hexahedron vertices (1, 3, 6, 2);
-      subTets[3][0] = hex[1];
-      subTets[3][1] = hex[3];
-      subTets[3][2] = hex[6];
-      subTets[3][3] = hex[2];
-
-      // Fifth tetrahedron from hexahedron vertices (3, 6, 7, 4);
-      subTets[4][0] = hex[3];
-      subTets[4][1] = hex[6];
-      subTets[4][2] = hex[7];
-      subTets[4][3] = hex[4];
-
-      float volume = 0.0f;
-
-      for(auto&& tet : subTets)
-      {
-        float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-        float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-        float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-        float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-        float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                  {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                  {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-        volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-      }
-
-      volumePtr[i] = volume;
-    }
+    ElementMetrics metrics;
+    metrics.sizes = volumes->getPointer(0);
+    FindElementMetrics<ElementShape::Hexahedron>(*hexList, *vertices, metrics);
   }
 
   /**
@@ -1227,25 +1492,9 @@ public:
   template <typename T>
   static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* jacobianPtr = jacobians->getPointer(0);
-
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // build jacobian matrix
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-      // find jacobian, which is determinant of the jacobian matrix
-      jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
-    }
+    ElementMetrics metrics;
+    metrics.jacobians = jacobians->getPointer(0);
+    FindElementMetrics<ElementShape::Tetrahedron>(*tetList, *vertices, metrics);
   }
 
   /**
@@ -1257,67 +1506,144 @@ public:
   template <typename T>
   static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* minAnglesPtr = minAngles->getPointer(0);
+    ElementMetrics metrics;
+    metrics.minDihedralAngles = minAngles->getPointer(0);
+    FindElementMetrics<ElementShape::Tetrahedron>(*tetList, *vertices, metrics);
+  }
+};
+
+/**
+ * @brief The AveragedArray struct pairs an input array with the output array its averages are
+ * written to. Both arrays have numComps components per tuple.
+ */
+template <typename K, typename M>
+struct AveragedArray
+{
+  const K* input = nullptr;
+  M* output = nullptr;
+  size_t numComps = 1;
+};
+
+/**
+ * @brief Creates an AveragedArray from a pair of DataArrays
+ * @param inArray
+ * @param outArray
+ * @return
+ */
+template <typename K, typename M>
+AveragedArray<K, M> MakeAveragedArray(const DataArray<K>& inArray, DataArray<M>& outArray)
+{
+  Q_ASSERT(outArray.getComponentDimensions() == inArray.getComponentDimensions());
+  return {inArray.getPointer(0), outArray.getPointer(0), inArray.getNumberOfComponents()};
+}
+
+/**
+ * @brief The VertexToElementAverageImpl class averages vertex arrays onto the elements that use
+ * them. Each element is written by exactly one task and its vertices are summed in connectivity
+ * order, so the results do not depend on the number of threads. When vertex coordinates and
+ * element centroids are given the values are weighted by the vertex to centroid distance.
+ */
+template <typename T, typename K, typename M>
+class VertexToElementAverageImpl
+{
+public:
+  VertexToElementAverageImpl(const T* elements, size_t numVertsPerElem, const std::vector<AveragedArray<K, M>>& arrays, const float* vertices = nullptr, const float* centroids = nullptr)
+  : m_Elements(elements)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_Arrays(arrays)
+  , m_Vertices(vertices)
+  , m_Centroids(centroids)
+  {
+  }
 
-    for(size_t i = 0; i < numTets; i++)
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<double> weights(m_NumVertsPerElem, 1.0);
+    for(size_t elemId = range.min(); elemId < range.max(); elemId++)
     {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // find 5 edges needed to find 4 face normals
-      float v10[3] = {(vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2])};
-      float v20[3] = {(vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2])};
-      float v30[3] = {(vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2])};
-      float v21[3] = {(vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2])};
-      float v31[3] = {(vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2])};
-      // find 4 face-to-face normals
-      float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
-      float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
-      float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
-      float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
-      // find the magnitudes of each normal
-      float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
-      float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
-      float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
-      float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
-      // find angles between faces
-      float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
-      float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
-      float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
-      float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
-      float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
-      float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
-      // find the maximum ang value, which will be the minimum angle after the acos
-      float minAng = ang1;
-      if(ang2 > minAng)
-      {
-        minAng = ang2;
-      }
-      if(ang3 > minAng)
+      const T* elem = m_Elements + elemId * m_NumVertsPerElem;
+      double sumWeights = static_cast<double>(m_NumVertsPerElem);
+      if(m_Vertices != nullptr)
       {
-        minAng = ang3;
-      }
-      if(ang4 > minAng)
-      {
-        minAng = ang4;
+        sumWeights = 0.0;
+        const float* centroid = m_Centroids + 3 * elemId;
+        for(size_t v = 0; v < m_NumVertsPerElem; v++)
+        {
+          const float* vert = m_Vertices + 3 * static_cast<size_t>(elem[v]);
+          float dist = 0.0f;
+          for(size_t d = 0; d < 3; d++)
+          {
+            dist += (vert[d] - centroid[d]) * (vert[d] - centroid[d]);
+          }
+          weights[v] = std::sqrt(dist);
+          sumWeights += weights[v];
+        }
       }
-      if(ang5 > minAng)
+
+      for(const auto& array : m_Arrays)
       {
-        minAng = ang5;
+        for(size_t c = 0; c < array.numComps; c++)
+        {
+          double value = 0.0;
+          for(size_t v = 0; v < m_NumVertsPerElem; v++)
+          {
+            value += static_cast<double>(array.input[array.numComps * static_cast<size_t>(elem[v]) + c]) * weights[v];
+          }
+          array.output[array.numComps * elemId + c] = static_cast<M>(value / sumWeights);
+        }
       }
-      if(ang6 > minAng)
+    }
+  }
+
+private:
+  const T* m_Elements = nullptr;
+  size_t m_NumVertsPerElem = 0;
+  const std::vector<AveragedArray<K, M>>& m_Arrays;
+  const float* m_Vertices = nullptr;
+  const float* m_Centroids = nullptr;
+};
+
+/**
+ * @brief The ElementToVertexAverageImpl class averages element arrays onto their vertices using
+ * the elements containing each vertex. Each vertex is written by exactly one task and its
+ * elements are summed in list order, so the results do not depend on the number of threads.
+ */
+template <typename T, typename L, typename K, typename M>
+class ElementToVertexAverageImpl
+{
+public:
+  ElementToVertexAverageImpl(const DynamicListArray<L, T>& elemsContainingVert, const std::vector<AveragedArray<K, M>>& arrays)
+  : m_ElemsContainingVert(elemsContainingVert)
+  , m_Arrays(arrays)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+    {
+      size_t numElemsPerVert = static_cast<size_t>(m_ElemsContainingVert.getNumberOfElements(vertId));
+      const T* elemIdxs = m_ElemsContainingVert.getElementListPointer(vertId);
+      // A vertex no element refers to keeps 0
+      double weight = numElemsPerVert > 0 ? 1.0 / static_cast<double>(numElemsPerVert) : 0.0;
+      for(const auto& array : m_Arrays)
       {
-        minAng = ang6;
+        for(size_t c = 0; c < array.numComps; c++)
+        {
+          double value = 0.0;
+          for(size_t e = 0; e < numElemsPerVert; e++)
+          {
+            value += static_cast<double>(array.input[array.numComps * static_cast<size_t>(elemIdxs[e]) + c]);
+          }
+          array.output[array.numComps * vertId + c] = static_cast<M>(value * weight);
+        }
       }
-
-      minAnglesPtr[i] = SIMPLib::Constants::k_180OverPiD * acosf(minAng);
     }
   }
+
+private:
+  const DynamicListArray<L, T>& m_ElemsContainingVert;
+  const std::vector<AveragedArray<K, M>>& m_Arrays;
 };
 
 /**
@@ -1329,6 +1655,20 @@ public:
   Generic() = default;
   virtual ~Generic() = default;
 
+  /**
+   * @brief Averages any number of vertex arrays onto the elements in a single parallel pass
+   * over the connectivity list
+   * @param elemList
+   * @param arrays Vertex arrays and the element arrays receiving their averages
+   */
+  template <typename T, typename K, typename M>
+  static void AverageVertexArrayValues(const DataArray<T>& elemList, const std::vector<AveragedArray<K, M>>& arrays)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, elemList.getNumberOfTuples());
+    dataAlg.execute(VertexToElementAverageImpl<T, K, M>(elemList.getPointer(0), elemList.getNumberOfComponents(), arrays));
+  }
+
   /**
    * @brief AverageVertexArrayValues
    * @param elemList
@@ -1338,30 +1678,25 @@ public:
   template <typename T, typename K>
   static void AverageVertexArrayValues(typename DataArray<T>::Pointer elemList, typename DataArray<K>::Pointer inVertexArray, DataArray<float>::Pointer outElemArray)
   {
-    Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
+    std::vector<AveragedArray<K, float>> arrays = {MakeAveragedArray(*inVertexArray, *outElemArray)};
+    AverageVertexArrayValues<T, K, float>(*elemList, arrays);
+  }
 
-    K* vertArray = inVertexArray->getPointer(0);
-    float* elemArray = outElemArray->getPointer(0);
-
-    size_t numElems = outElemArray->getNumberOfTuples();
-    size_t numDims = inVertexArray->getNumberOfComponents();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
-        {
-          vertValue += vertArray[numDims * Elem[k] + i];
-        }
-        vertValue /= static_cast<float>(numVertsPerElem);
-        elemArray[numDims * j + i] = vertValue;
-      }
-    }
+  /**
+   * @brief Averages any number of vertex arrays onto the elements, weighting each vertex by its
+   * distance to the element centroid, in a single parallel pass over the connectivity list
+   * @param elemList
+   * @param vertices
+   * @param centroids
+   * @param arrays Vertex arrays and the element arrays receiving their averages
+   */
+  template <typename T, typename K, typename M>
+  static void WeightedAverageVertexArrayValues(const DataArray<T>& elemList, const DataArray<float>& vertices, const DataArray<float>& centroids, const std::vector<AveragedArray<K, M>>& arrays)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, elemList.getNumberOfTuples());
+    dataAlg.execute(VertexToElementAverageImpl<T, K, M>(elemList.getPointer(0), elemList.getNumberOfComponents(), arrays, vertices.getPointer(0), centroids.getPointer(0)));
   }
 
   /**
@@ -1377,80 +1712,39 @@ public:
                                                typename DataArray<K>::Pointer inVertexArray, DataArray<float>::Pointer outElemArray)
   {
     Q_ASSERT(outElemArray->getNumberOfTuples() == elemList->getNumberOfTuples());
-    Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
-
-    K* vertArray = inVertexArray->getPointer(0);
-    float* elemArray = outElemArray->getPointer(0);
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
-
-    size_t numElems = outElemArray->getNumberOfTuples();
-    size_t cDims = inVertexArray->getNumberOfComponents();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
-
-    // Vector to hold vertex-centroid distances, 4 per cell
-    std::vector<float> vertCentDist(numElems * numVertsPerElem);
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* Elem = elemList->getTuplePointer(i);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        for(size_t k = 0; k < numDims; k++)
-        {
-          vertCentDist[numVertsPerElem * i + j] += (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]) * (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]);
-        }
-        vertCentDist[numVertsPerElem * i + j] = sqrtf(vertCentDist[numVertsPerElem * i + j]);
-      }
-    }
+    std::vector<AveragedArray<K, float>> arrays = {MakeAveragedArray(*inVertexArray, *outElemArray)};
+    WeightedAverageVertexArrayValues<T, K, float>(*elemList, *vertices, *centroids, arrays);
+  }
 
-    for(size_t i = 0; i < cDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        float sumDist = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
-        {
-          vertValue += vertArray[cDims * Elem[k] + i] * vertCentDist[numVertsPerElem * j + k];
-          sumDist += vertCentDist[numVertsPerElem * j + k];
-        }
-        vertValue /= static_cast<float>(sumDist);
-        elemArray[cDims * j + i] = vertValue;
-      }
-    }
+  /**
+   * @brief Averages any number of element arrays onto the vertices in a single parallel pass
+   * over the elements containing each vertex
+   * @param elemsContainingVert
+   * @param numVerts
+   * @param arrays Element arrays and the vertex arrays receiving their averages
+   */
+  template <typename T, typename K, typename L, typename M>
+  static void AverageCellArrayValues(const DynamicListArray<L, T>& elemsContainingVert, size_t numVerts, const std::vector<AveragedArray<K, M>>& arrays)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numVerts);
+    dataAlg.execute(ElementToVertexAverageImpl<T, L, K, M>(elemsContainingVert, arrays));
   }
 
+  /**
+   * @brief AverageCellArrayValues
+   * @param elemsContainingVert
+   * @param vertices
+   * @param inElemArray
+   * @param outVertexArray
+   */
   template <typename T, typename K, typename L, typename M>
   static void AverageCellArrayValues(typename DynamicListArray<L, T>::Pointer elemsContainingVert, DataArray<float>::Pointer vertices, typename DataArray<K>::Pointer inElemArray,
                                      typename DataArray<M>::Pointer outVertexArray)
   {
     Q_ASSERT(outVertexArray->getNumberOfTuples() == vertices->getNumberOfTuples());
-    Q_ASSERT(outVertexArray->getComponentDimensions() == inElemArray->getComponentDimensions());
-
-    K* elemArray = inElemArray->getPointer(0);
-    M* vertArray = outVertexArray->getPointer(0);
-
-    size_t numVerts = vertices->getNumberOfTuples();
-    size_t cDims = inElemArray->getNumberOfComponents();
-
-    for(size_t i = 0; i < cDims; i++)
-    {
-      for(size_t j = 0; j < numVerts; j++)
-      {
-        L numElemsPerVert = elemsContainingVert->getNumberOfElements(j);
-        T* elemIdxs = elemsContainingVert->getElementListPointer(j);
-        M vertValue = 0.0;
-        double weight = 1.0 / numElemsPerVert;
-        for(size_t k = 0; k < numElemsPerVert; k++)
-        {
-          vertValue += static_cast<M>(elemArray[cDims * elemIdxs[k] + i] * weight);
-        }
-        vertArray[cDims * j + i] = vertValue;
-      }
-    }
+    std::vector<AveragedArray<K, M>> arrays = {MakeAveragedArray(*inElemArray, *outVertexArray)};
+    AverageCellArrayValues<T, K, L, M>(*elemsContainingVert, vertices->getNumberOfTuples(), arrays);
   }
 };
 } // namespace GeometryHelpers
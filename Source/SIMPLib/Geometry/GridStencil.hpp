@@ -0,0 +1,444 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/Common/SIMPLRange3D.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
+#include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
+
+/**
+ * @brief The GridStencil namespace holds a neighbourhood iteration engine for structured grids
+ * (ImageGeom, RectGridGeom). A kernel is called once per cell with the linear indices of the cell's
+ * 6, 18 or 26 connected neighbours. Cells whose whole neighbourhood is inside the grid are visited
+ * row by row without any bounds checks; only the boundary shell pays for clipping. The grid is
+ * processed in z slabs with ParallelData3DAlgorithm.
+ *
+ * Axes with a single cell (2D and 1D grids) are dropped from the stencil, so a 2D image gets a 4, 8
+ * or 8 connected neighbourhood and its interior is still visited branch free.
+ */
+namespace GridStencil
+{
+/**
+ * @brief Cells that share a face (6), a face or an edge (18) or any corner (26)
+ */
+enum class Neighborhood : uint8_t
+{
+  Face6 = 0,
+  Edge18 = 1,
+  Vertex26 = 2
+};
+
+/**
+ * @brief The Stencil class holds the neighbour offsets of a Neighborhood on a grid of the given dimensions
+ */
+class Stencil
+{
+public:
+  static constexpr size_t k_MaxSize = 26;
+
+  Stencil(const SizeVec3Type& dims, Neighborhood neighborhood)
+  : m_Dims(dims)
+  {
+    const int32_t maxOrder = static_cast<int32_t>(neighborhood) + 1;
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      m_Reach[axis] = dims[axis] > 1 ? 1 : 0;
+    }
+    const int64_t dimX = static_cast<int64_t>(dims[0]);
+    const int64_t dimXY = dimX * static_cast<int64_t>(dims[1]);
+    for(int32_t dz = -m_Reach[2]; dz <= m_Reach[2]; dz++)
+    {
+      for(int32_t dy = -m_Reach[1]; dy <= m_Reach[1]; dy++)
+      {
+        for(int32_t dx = -m_Reach[0]; dx <= m_Reach[0]; dx++)
+        {
+          const int32_t order = std::abs(dx) + std::abs(dy) + std::abs(dz);
+          if(order == 0 || order > maxOrder)
+          {
+            continue;
+          }
+          m_Offsets[m_Size] = {dx, dy, dz};
+          m_Linear[m_Size] = dz * dimXY + dy * dimX + dx;
+          m_Size++;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of neighbours of an interior cell
+   */
+  size_t size() const
+  {
+    return m_Size;
+  }
+
+  /**
+   * @brief Returns the (dx, dy, dz) offset of neighbour direction i
+   */
+  const std::array<int32_t, 3>& offset(size_t i) const
+  {
+    return m_Offsets[i];
+  }
+
+  /**
+   * @brief Returns the linear index offsets of all neighbour directions
+   */
+  const int64_t* linearOffsets() const
+  {
+    return m_Linear.data();
+  }
+
+  /**
+   * @brief Returns 1 for axes with more than one cell and 0 otherwise
+   */
+  int32_t reach(size_t axis) const
+  {
+    return m_Reach[axis];
+  }
+
+  const SizeVec3Type& getDimensions() const
+  {
+    return m_Dims;
+  }
+
+private:
+  SizeVec3Type m_Dims;
+  std::array<int32_t, 3> m_Reach = {0, 0, 0};
+  std::array<std::array<int32_t, 3>, k_MaxSize> m_Offsets = {};
+  std::array<int64_t, k_MaxSize> m_Linear = {};
+  size_t m_Size = 0;
+};
+
+/**
+ * @brief The Neighbors class is what a kernel receives for each cell: the cell itself and the
+ * neighbours that lie inside the grid. For interior cells isComplete() is true and direction(i) == i.
+ */
+class Neighbors
+{
+public:
+  Neighbors(size_t x, size_t y, size_t z, size_t center, const int64_t* linear, const uint8_t* directions, size_t count)
+  : m_Center(center)
+  , m_Linear(linear)
+  , m_Directions(directions)
+  , m_Count(count)
+  , m_X(x)
+  , m_Y(y)
+  , m_Z(z)
+  {
+  }
+
+  /**
+   * @brief Returns the linear index of the cell
+   */
+  size_t center() const
+  {
+    return m_Center;
+  }
+
+  /**
+   * @brief Returns the number of neighbours inside the grid
+   */
+  size_t size() const
+  {
+    return m_Count;
+  }
+
+  /**
+   * @brief Returns the linear index of neighbour i
+   */
+  size_t operator[](size_t i) const
+  {
+    return static_cast<size_t>(static_cast<int64_t>(m_Center) + m_Linear[i]);
+  }
+
+  /**
+   * @brief Returns the stencil direction of neighbour i, see Stencil::offset()
+   */
+  size_t direction(size_t i) const
+  {
+    return m_Directions == nullptr ? i : m_Directions[i];
+  }
+
+  /**
+   * @brief Returns true when every direction of the stencil is present
+   */
+  bool isComplete() const
+  {
+    return m_Directions == nullptr;
+  }
+
+  size_t x() const
+  {
+    return m_X;
+  }
+  size_t y() const
+  {
+    return m_Y;
+  }
+  size_t z() const
+  {
+    return m_Z;
+  }
+
+private:
+  size_t m_Center = 0;
+  const int64_t* m_Linear = nullptr;
+  const uint8_t* m_Directions = nullptr;
+  size_t m_Count = 0;
+  size_t m_X = 0;
+  size_t m_Y = 0;
+  size_t m_Z = 0;
+};
+
+/**
+ * @brief The StencilImpl class runs a kernel over a sub range of the grid. The range is laid out as
+ * (z, y, x) to match ParallelData3DAlgorithm::setRange(dims[2], dims[1], dims[0]).
+ */
+template <typename Kernel>
+class StencilImpl
+{
+public:
+  StencilImpl(const Stencil& stencil, const Kernel& kernel)
+  : m_Stencil(stencil)
+  , m_Kernel(kernel)
+  {
+  }
+
+  void operator()(const SIMPLRange3D& range) const
+  {
+    const SizeVec3Type& dims = m_Stencil.getDimensions();
+    const size_t rx = static_cast<size_t>(m_Stencil.reach(0));
+    const size_t ry = static_cast<size_t>(m_Stencil.reach(1));
+    const size_t rz = static_cast<size_t>(m_Stencil.reach(2));
+    const int64_t* linear = m_Stencil.linearOffsets();
+    const size_t count = m_Stencil.size();
+
+    const size_t xBegin = range[4];
+    const size_t xEnd = range[5];
+    const size_t interiorBegin = std::min(std::max(xBegin, rx), xEnd);
+    const size_t interiorEnd = std::max(std::min(xEnd, dims[0] - rx), interiorBegin);
+
+    for(size_t z = range[0]; z < range[1]; z++)
+    {
+      const bool zInterior = z >= rz && z + rz < dims[2];
+      for(size_t y = range[2]; y < range[3]; y++)
+      {
+        const size_t rowStart = (z * dims[1] + y) * dims[0];
+        if(!zInterior || y < ry || y + ry >= dims[1])
+        {
+          for(size_t x = xBegin; x < xEnd; x++)
+          {
+            boundaryCell(x, y, z, rowStart + x);
+          }
+          continue;
+        }
+        for(size_t x = xBegin; x < interiorBegin; x++)
+        {
+          boundaryCell(x, y, z, rowStart + x);
+        }
+        for(size_t x = interiorBegin; x < interiorEnd; x++)
+        {
+          m_Kernel(Neighbors(x, y, z, rowStart + x, linear, nullptr, count));
+        }
+        for(size_t x = interiorEnd; x < xEnd; x++)
+        {
+          boundaryCell(x, y, z, rowStart + x);
+        }
+      }
+    }
+  }
+
+private:
+  const Stencil& m_Stencil;
+  const Kernel& m_Kernel;
+
+  void boundaryCell(size_t x, size_t y, size_t z, size_t center) const
+  {
+    const SizeVec3Type& dims = m_Stencil.getDimensions();
+    const int64_t* linear = m_Stencil.linearOffsets();
+    const int64_t cell[3] = {static_cast<int64_t>(x), static_cast<int64_t>(y), static_cast<int64_t>(z)};
+    std::array<int64_t, Stencil::k_MaxSize> clippedLinear;
+    std::array<uint8_t, Stencil::k_MaxSize> clippedDirections;
+    size_t clippedCount = 0;
+    for(size_t i = 0; i < m_Stencil.size(); i++)
+    {
+      const std::array<int32_t, 3>& offset = m_Stencil.offset(i);
+      bool inside = true;
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        const int64_t coord = cell[axis] + offset[axis];
+        inside = inside && coord >= 0 && coord < static_cast<int64_t>(dims[axis]);
+      }
+      if(inside)
+      {
+        clippedLinear[clippedCount] = linear[i];
+        clippedDirections[clippedCount] = static_cast<uint8_t>(i);
+        clippedCount++;
+      }
+    }
+    m_Kernel(Neighbors(x, y, z, center, clippedLinear.data(), clippedDirections.data(), clippedCount));
+  }
+};
+
+/**
+ * @brief Calls kernel(const Neighbors&) once for every cell of a grid with the given dimensions. Calls
+ * for different cells may run concurrently, so the kernel must only write to data owned by the cell.
+ * @param dims Grid dimensions in cells (x, y, z)
+ * @param neighborhood
+ * @param kernel
+ */
+template <typename Kernel>
+void Execute(const SizeVec3Type& dims, Neighborhood neighborhood, const Kernel& kernel)
+{
+  if(dims[0] == 0 || dims[1] == 0 || dims[2] == 0)
+  {
+    return;
+  }
+  Stencil stencil(dims, neighborhood);
+  ParallelData3DAlgorithm dataAlg;
+  dataAlg.setRange(dims[2], dims[1], dims[0]);
+  dataAlg.execute(StencilImpl<Kernel>(stencil, kernel));
+}
+
+/**
+ * @brief Calls kernel(const Neighbors&) once for every cell of the grid geometry
+ */
+template <typename Kernel>
+void Execute(const IGeometryGrid& grid, Neighborhood neighborhood, const Kernel& kernel)
+{
+  Execute(grid.getDimensions(), neighborhood, kernel);
+}
+
+/**
+ * @brief Builds the per cell neighbour lists of a grid, in stencil direction order
+ * @param dims Grid dimensions in cells (x, y, z)
+ * @param neighborhood
+ * @return
+ */
+inline ElementDynamicList::Pointer FindElementNeighbors(const SizeVec3Type& dims, Neighborhood neighborhood)
+{
+  const size_t numCells = dims[0] * dims[1] * dims[2];
+  std::vector<uint16_t> counts(numCells, 0);
+  Execute(dims, neighborhood, [&counts](const Neighbors& neighbors) { counts[neighbors.center()] = static_cast<uint16_t>(neighbors.size()); });
+
+  ElementDynamicList::Pointer neighborList = ElementDynamicList::New();
+  neighborList->allocateLists(counts);
+  const ElementDynamicList& lists = *neighborList;
+  Execute(dims, neighborhood, [&lists](const Neighbors& neighbors) {
+    MeshIndexType* list = lists.getElementListPointer(neighbors.center());
+    for(size_t i = 0; i < neighbors.size(); i++)
+    {
+      list[i] = static_cast<MeshIndexType>(neighbors[i]);
+    }
+  });
+  return neighborList;
+}
+
+/**
+ * @brief Builds, for every grid point, the list of cells that have it as a corner. Grid points are
+ * numbered x fastest over (dims[0] + 1) x (dims[1] + 1) x (dims[2] + 1).
+ * @param dims Grid dimensions in cells (x, y, z)
+ * @return
+ */
+inline ElementDynamicList::Pointer FindElementsContainingVert(const SizeVec3Type& dims)
+{
+  if(dims[0] == 0 || dims[1] == 0 || dims[2] == 0)
+  {
+    return ElementDynamicList::NullPointer();
+  }
+  const SizeVec3Type pointDims(dims[0] + 1, dims[1] + 1, dims[2] + 1);
+  const size_t numPoints = pointDims[0] * pointDims[1] * pointDims[2];
+
+  // A point touches the cells [p - 1, p] on every axis that are inside the grid
+  auto cellRange = [&dims](size_t p, size_t axis) {
+    const size_t first = p > 0 ? p - 1 : 0;
+    const size_t last = std::min(p, dims[axis] - 1);
+    return std::make_pair(first, last);
+  };
+
+  std::vector<uint16_t> counts(numPoints, 0);
+  for(size_t z = 0; z < pointDims[2]; z++)
+  {
+    const auto zr = cellRange(z, 2);
+    for(size_t y = 0; y < pointDims[1]; y++)
+    {
+      const auto yr = cellRange(y, 1);
+      for(size_t x = 0; x < pointDims[0]; x++)
+      {
+        const auto xr = cellRange(x, 0);
+        counts[(z * pointDims[1] + y) * pointDims[0] + x] = static_cast<uint16_t>((xr.second - xr.first + 1) * (yr.second - yr.first + 1) * (zr.second - zr.first + 1));
+      }
+    }
+  }
+
+  ElementDynamicList::Pointer cellList = ElementDynamicList::New();
+  cellList->allocateLists(counts);
+  const ElementDynamicList& lists = *cellList;
+
+  ParallelData3DAlgorithm dataAlg;
+  dataAlg.setRange(pointDims[2], pointDims[1], pointDims[0]);
+  dataAlg.execute([&](const SIMPLRange3D& range) {
+    for(size_t z = range[0]; z < range[1]; z++)
+    {
+      const auto zr = cellRange(z, 2);
+      for(size_t y = range[2]; y < range[3]; y++)
+      {
+        const auto yr = cellRange(y, 1);
+        for(size_t x = range[4]; x < range[5]; x++)
+        {
+          const auto xr = cellRange(x, 0);
+          MeshIndexType* list = lists.getElementListPointer((z * pointDims[1] + y) * pointDims[0] + x);
+          for(size_t cz = zr.first; cz <= zr.second; cz++)
+          {
+            for(size_t cy = yr.first; cy <= yr.second; cy++)
+            {
+              for(size_t cx = xr.first; cx <= xr.second; cx++)
+              {
+                *list++ = static_cast<MeshIndexType>((cz * dims[1] + cy) * dims[0] + cx);
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+  return cellList;
+}
+} // namespace GridStencil
@@ -20,22 +20,24 @@
  * @brief The FindHexDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying hexahedra
  */
+template <typename FieldType, typename DerivType>
 class FindHexDerivativesImpl
 {
 public:
-  FindHexDerivativesImpl(HexahedralGeom* hexas, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindHexDerivativesImpl(HexahedralGeom* hexas, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Hexas(hexas)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindHexDerivativesImpl() = default;
 
   void compute(size_t start, size_t end) const
   {
-    int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t cDims = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     double values[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     size_t verts[8] = {0, 0, 0, 0, 0, 0, 0, 0};
@@ -51,12 +53,12 @@ public:
       {
         for(size_t k = 0; k < 8; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = static_cast<double>(fieldPtr[cDims * verts[k] + j]);
         }
         DerivativeHelpers::HexDeriv()(m_Hexas, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<DerivType>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<DerivType>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<DerivType>(derivs[2]);
       }
 
       if(counter > progIncrement)
@@ -75,8 +77,9 @@ public:
 
 private:
   HexahedralGeom* m_Hexas;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
@@ -545,6 +548,14 @@ void HexahedralGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t HexahedralGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t numHexas = getNumberOfHexas();
@@ -554,9 +565,14 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
+  int32_t numComps = field->getNumberOfComponents();
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numHexas);
-  dataAlg.execute(FindHexDerivativesImpl(this, field, derivatives));
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindHexDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -448,24 +448,40 @@ QString IGeometry::getGeometryTypeAsString() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
+int32_t IGeometry::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
-  m_Mutex.lock();
-
-  m_ProgressCounter += counter;
+  DoubleArrayType::Pointer doubleField = std::dynamic_pointer_cast<DoubleArrayType>(field);
+  DoubleArrayType::Pointer doubleDerivatives = std::dynamic_pointer_cast<DoubleArrayType>(derivatives);
+  if(nullptr == doubleField || nullptr == doubleDerivatives)
+  {
+    return -1;
+  }
+  findDerivatives(doubleField, doubleDerivatives, observable);
+  return 0;
+}
 
-  int64_t progIncrement = max / 100;
-  int64_t prog = 1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
+{
+  int64_t previous = m_ProgressCounter.fetch_add(counter, std::memory_order_relaxed);
+  if(previous == 0)
+  {
+    // The geometry resets the counter before each computation
+    m_ProgressRateLimiter.reset();
+  }
+  if(max <= 0)
+  {
+    return;
+  }
 
-  if(m_ProgressCounter > prog)
+  int32_t progressInt = static_cast<int32_t>((static_cast<double>(previous + counter) / max) * 100.0);
+  if(m_ProgressRateLimiter.shouldReport(progressInt))
   {
-    int64_t progressInt = static_cast<int64_t>((static_cast<double>(m_ProgressCounter) / max) * 100.0);
     QString ss = QObject::tr("%1% Complete").arg(progressInt);
     notifyStatusMessage(ss);
-    prog += progIncrement;
   }
-
-  m_Mutex.unlock();
 }
 
 // -----------------------------------------------------------------------------
@@ -35,12 +35,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include <QMutex>
 #include <QtCore/QMap>
 #include <QtCore/QString>
 #include <QtCore/QTextStream>
@@ -50,6 +50,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/DynamicListArray.hpp"
 #include "SIMPLib/Geometry/ITransformContainer.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
 #include "SIMPLib/Utilities/ToolTipGenerator.h"
 
 class AttributeMatrix;
@@ -375,6 +376,16 @@ public:
    */
   virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable) = 0;
 
+  /**
+   * @brief findDerivatives Computes the derivatives of a field of any primitive type without first
+   * converting it to double. The derivatives array may be float or double. The default implementation
+   * only accepts double arrays and forwards them to the DoubleArrayType overload.
+   * @param field
+   * @param derivatives
+   * @return Negative value if the field or the derivatives are of an unsupported type
+   */
+  virtual int32_t findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable);
+
   // -----------------------------------------------------------------------------
   // Generic
   // -----------------------------------------------------------------------------
@@ -498,7 +509,9 @@ public:
 
 protected:
   /**
-   * @brief sendThreadSafeProgressMessage
+   * @brief Adds counter to the progress of the current geometry computation and emits a
+   * status message when the percentage advances.  This function does not lock and emits
+   * at most one message per reporting interval across all threads.
    * @param counter
    * @param max
    */
@@ -540,7 +553,7 @@ protected:
   unsigned int m_XdmfGridType = SIMPL::XdmfGridType::UnknownGrid;
   unsigned int m_UnitDimensionality = 0;
   unsigned int m_SpatialDimensionality = 0;
-  int64_t m_ProgressCounter = 0;
+  std::atomic<int64_t> m_ProgressCounter = {0};
   AttributeMatrixMap_t m_AttributeMatrices;
 
 private:
@@ -549,5 +562,5 @@ private:
   ITransformContainer::Pointer m_TransformContainer = {};
   IGeometry::LengthUnit m_Units = LengthUnit::Unspecified;
   QString m_Name;
-  QMutex m_Mutex;
+  ProgressRateLimiter m_ProgressRateLimiter;
 };
@@ -0,0 +1,236 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The ImageBoxCopy namespace holds the "copy a box from one image into another" primitive used
+ * when an image geometry is padded, cropped or split into tiles.
+ *
+ * A Box maps a sub volume of a source image onto a sub volume of the same extent in a destination
+ * image. Every destination x row is written exactly once: rows that intersect the box get a fill
+ * prefix, one contiguous copy of extent[0] tuples and a fill suffix; all other rows are filled. Rows
+ * are independent, so they are distributed over threads with ParallelDataAlgorithm.
+ */
+namespace ImageBoxCopy
+{
+/**
+ * @brief Describes where a block of voxels comes from and where it lands. All values are in voxels.
+ */
+struct Box
+{
+  SizeVec3Type srcDims = {0, 0, 0};
+  SizeVec3Type destDims = {0, 0, 0};
+  SizeVec3Type srcOffset = {0, 0, 0};
+  SizeVec3Type destOffset = {0, 0, 0};
+  SizeVec3Type extent = {0, 0, 0};
+
+  /**
+   * @brief Returns true if the box lies inside both the source and the destination image
+   */
+  bool isValid() const
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(srcOffset[i] + extent[i] > srcDims[i] || destOffset[i] + extent[i] > destDims[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Returns the box that places the whole source image into a destination padded by padMin voxels
+ * before and padMax voxels after it along each axis
+ * @param srcDims
+ * @param padMin
+ * @param padMax
+ */
+inline Box Pad(const SizeVec3Type& srcDims, const SizeVec3Type& padMin, const SizeVec3Type& padMax)
+{
+  Box box;
+  box.srcDims = srcDims;
+  box.extent = srcDims;
+  box.destOffset = padMin;
+  for(size_t i = 0; i < 3; i++)
+  {
+    box.destDims[i] = padMin[i] + srcDims[i] + padMax[i];
+  }
+  return box;
+}
+
+/**
+ * @brief Returns the box that removes cropMin voxels before and cropMax voxels after the source image
+ * along each axis. The caller must make sure that at least one voxel is left along every axis.
+ * @param srcDims
+ * @param cropMin
+ * @param cropMax
+ */
+inline Box Crop(const SizeVec3Type& srcDims, const SizeVec3Type& cropMin, const SizeVec3Type& cropMax)
+{
+  Box box;
+  box.srcDims = srcDims;
+  box.srcOffset = cropMin;
+  for(size_t i = 0; i < 3; i++)
+  {
+    box.extent[i] = srcDims[i] - cropMin[i] - cropMax[i];
+  }
+  box.destDims = box.extent;
+  return box;
+}
+
+/**
+ * @brief Copies the box of one typed array into another, one destination x row at a time
+ */
+template <typename T>
+class CopyBoxImpl
+{
+public:
+  CopyBoxImpl(const T* source, T* destination, size_t numComps, const Box& box, T fillValue)
+  : m_Source(source)
+  , m_Destination(destination)
+  , m_NumComps(numComps)
+  , m_Box(box)
+  , m_FillValue(fillValue)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t destRowLength = m_Box.destDims[0] * m_NumComps;
+    const size_t srcRowLength = m_Box.srcDims[0] * m_NumComps;
+    const size_t prefixLength = m_Box.destOffset[0] * m_NumComps;
+    const size_t copyLength = m_Box.extent[0] * m_NumComps;
+    const size_t suffixLength = destRowLength - prefixLength - copyLength;
+
+    for(size_t row = range.min(); row < range.max(); row++)
+    {
+      const size_t y = row % m_Box.destDims[1];
+      const size_t z = row / m_Box.destDims[1];
+      T* destRow = m_Destination + row * destRowLength;
+
+      const bool inBox = copyLength > 0 && y >= m_Box.destOffset[1] && y - m_Box.destOffset[1] < m_Box.extent[1] && z >= m_Box.destOffset[2] && z - m_Box.destOffset[2] < m_Box.extent[2];
+      if(!inBox)
+      {
+        std::fill(destRow, destRow + destRowLength, m_FillValue);
+        continue;
+      }
+
+      const size_t srcY = y - m_Box.destOffset[1] + m_Box.srcOffset[1];
+      const size_t srcZ = z - m_Box.destOffset[2] + m_Box.srcOffset[2];
+      const T* srcRow = m_Source + (srcZ * m_Box.srcDims[1] + srcY) * srcRowLength + m_Box.srcOffset[0] * m_NumComps;
+
+      std::fill(destRow, destRow + prefixLength, m_FillValue);
+      std::memcpy(destRow + prefixLength, srcRow, copyLength * sizeof(T));
+      std::fill(destRow + prefixLength + copyLength, destRow + prefixLength + copyLength + suffixLength, m_FillValue);
+    }
+  }
+
+private:
+  const T* m_Source;
+  T* m_Destination;
+  size_t m_NumComps;
+  Box m_Box;
+  T m_FillValue;
+};
+
+/**
+ * @brief Copies the box from source into destination and fills every destination voxel outside of the
+ * box with fillValue. Both arrays must have the same number of components and match the tuple counts of
+ * box.srcDims and box.destDims.
+ * @param source
+ * @param destination
+ * @param box
+ * @param fillValue
+ */
+template <typename T>
+void CopyBox(const DataArray<T>& source, DataArray<T>& destination, const Box& box, T fillValue)
+{
+  const size_t numRows = box.destDims[1] * box.destDims[2];
+  if(numRows == 0 || box.destDims[0] == 0)
+  {
+    return;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRows);
+  dataAlg.execute(CopyBoxImpl<T>(source.getPointer(0), destination.getPointer(0), source.getNumberOfComponents(), box, fillValue));
+}
+
+namespace Detail
+{
+template <typename T>
+bool CopyBoxAs(const IDataArray& source, IDataArray& destination, const Box& box, int fillValue)
+{
+  const auto* typedSource = dynamic_cast<const DataArray<T>*>(&source);
+  auto* typedDestination = dynamic_cast<DataArray<T>*>(&destination);
+  if(nullptr == typedSource || nullptr == typedDestination)
+  {
+    return false;
+  }
+  if constexpr(std::is_same<T, bool>::value)
+  {
+    CopyBox<T>(*typedSource, *typedDestination, box, fillValue != 0);
+  }
+  else
+  {
+    CopyBox<T>(*typedSource, *typedDestination, box, static_cast<T>(fillValue));
+  }
+  return true;
+}
+
+template <typename... Types>
+bool CopyBoxAsAnyOf(const IDataArray& source, IDataArray& destination, const Box& box, int fillValue)
+{
+  return (CopyBoxAs<Types>(source, destination, box, fillValue) || ...);
+}
+} // namespace Detail
+
+/**
+ * @brief Type dispatching overload of CopyBox for the primitive DataArray types.
+ * @return false if the two arrays are not DataArrays of the same primitive type; nothing is copied then
+ */
+inline bool CopyBox(const IDataArray& source, IDataArray& destination, const Box& box, int fillValue)
+{
+  return Detail::CopyBoxAsAnyOf<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, bool>(source, destination, box, fillValue);
+}
+} // namespace ImageBoxCopy
@@ -51,7 +51,9 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/GridStencil.hpp"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
 
@@ -59,13 +61,15 @@
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying image
  */
+template <typename FieldType, typename DerivType>
 class FindImageDerivativesImpl
 {
 public:
-  FindImageDerivativesImpl(ImageGeom* image, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindImageDerivativesImpl(ImageGeom* image, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Image(image)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindImageDerivativesImpl() = default;
@@ -80,9 +84,9 @@ public:
     double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
     aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
     size_t index = 0;
-    int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t numComps = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     std::vector<double> plusValues(numComps);
     std::vector<double> minusValues(numComps);
     std::vector<double> dValuesdXi(numComps);
@@ -208,11 +212,11 @@ public:
           index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
           for(size_t i = 0; i < numComps; i++)
           {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3] = static_cast<DerivType>(xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 1] = static_cast<DerivType>(xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 2] = static_cast<DerivType>(xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i]);
           }
 
           if(counter > progIncrement)
@@ -330,7 +334,7 @@ public:
   }
 
   void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, const double* field) const
+                                     std::vector<double>& plusValues, std::vector<double>& minusValues, const FieldType* field) const
   {
     size_t index1 = 0;
     size_t index2 = 0;
@@ -354,8 +358,8 @@ public:
       computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
       for(int32_t i = 0; i < numComps; i++)
       {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
+        plusValues[i] = static_cast<double>(field[index1 * numComps + i]);
+        minusValues[i] = static_cast<double>(field[index2 * numComps + i]);
       }
     }
 
@@ -367,8 +371,9 @@ public:
 
 private:
   ImageGeom* m_Image;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 
   enum FiniteDifferenceType_t
   {
@@ -402,6 +407,8 @@ ImageGeom::ImageGeom()
   m_Dimensions[1] = 0;
   m_Dimensions[2] = 0;
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_ElementsContainingVert = ElementDynamicList::NullPointer();
+  m_ElementNeighbors = ElementDynamicList::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -805,7 +812,12 @@ size_t ImageGeom::getNumberOfElements() const
 // -----------------------------------------------------------------------------
 int ImageGeom::findElementsContainingVert()
 {
-  return -1;
+  m_ElementsContainingVert = GridStencil::FindElementsContainingVert(getDimensions());
+  if(m_ElementsContainingVert.get() == nullptr)
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -813,14 +825,15 @@ int ImageGeom::findElementsContainingVert()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer ImageGeom::getElementsContainingVert() const
 {
-  return ElementDynamicList::NullPointer();
+  return m_ElementsContainingVert;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImageGeom::setElementsContainingVert(ElementDynamicList::Pointer SIMPL_NOT_USED(elementsContainingVert))
+void ImageGeom::setElementsContainingVert(ElementDynamicList::Pointer elementsContainingVert)
 {
+  m_ElementsContainingVert = elementsContainingVert;
 }
 
 // -----------------------------------------------------------------------------
@@ -828,6 +841,7 @@ void ImageGeom::setElementsContainingVert(ElementDynamicList::Pointer SIMPL_NOT_
 // -----------------------------------------------------------------------------
 void ImageGeom::deleteElementsContainingVert()
 {
+  m_ElementsContainingVert = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -835,7 +849,12 @@ void ImageGeom::deleteElementsContainingVert()
 // -----------------------------------------------------------------------------
 int ImageGeom::findElementNeighbors()
 {
-  return -1;
+  m_ElementNeighbors = GridStencil::FindElementNeighbors(getDimensions(), GridStencil::Neighborhood::Face6);
+  if(m_ElementNeighbors.get() == nullptr)
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -843,14 +862,15 @@ int ImageGeom::findElementNeighbors()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer ImageGeom::getElementNeighbors() const
 {
-  return ElementDynamicList::NullPointer();
+  return m_ElementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(elementNeighbors))
+void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer elementNeighbors)
 {
+  m_ElementNeighbors = elementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
@@ -858,6 +878,7 @@ void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(e
 // -----------------------------------------------------------------------------
 void ImageGeom::deleteElementNeighbors()
 {
+  m_ElementNeighbors = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -988,6 +1009,14 @@ void ImageGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ImageGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   SizeVec3Type dims = getDimensions();
@@ -1007,7 +1036,12 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
   ParallelData3DAlgorithm dataAlg;
   dataAlg.setRange(dims[2], dims[1], dims[0]);
   dataAlg.setGrain(grain);
-  dataAlg.execute(FindImageDerivativesImpl(this, field, derivatives));
+  int32_t numComps = field->getNumberOfComponents();
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindImageDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -58,21 +58,23 @@
  * @brief The FindQuadDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying quadrilaterals
  */
+template <typename FieldType, typename DerivType>
 class FindQuadDerivativesImpl
 {
 public:
-  FindQuadDerivativesImpl(QuadGeom* quads, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindQuadDerivativesImpl(QuadGeom* quads, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Quads(quads)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
 
   void compute(size_t start, size_t end) const
   {
-    int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t cDims = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     double values[4] = {0.0, 0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     size_t verts[4] = {0, 0, 0, 0};
@@ -88,12 +90,12 @@ public:
       {
         for(size_t k = 0; k < 4; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = static_cast<double>(fieldPtr[cDims * verts[k] + j]);
         }
         DerivativeHelpers::QuadDeriv()(m_Quads, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<DerivType>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<DerivType>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<DerivType>(derivs[2]);
       }
 
       if(counter > progIncrement)
@@ -112,8 +114,9 @@ public:
 
 private:
   QuadGeom* m_Quads;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
@@ -490,6 +493,14 @@ void QuadGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t QuadGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t numQuads = getNumberOfQuads();
@@ -499,9 +510,14 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
+  int32_t numComps = field->getNumberOfComponents();
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numQuads);
-  dataAlg.execute(FindQuadDerivativesImpl(this, field, derivatives));
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindQuadDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -50,7 +50,9 @@
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/GridStencil.hpp"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
 
@@ -58,13 +60,15 @@
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying rectilinear grid
  */
+template <typename FieldType, typename DerivType>
 class FindRectGridDerivativesImpl
 {
 public:
-  FindRectGridDerivativesImpl(RectGridGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindRectGridDerivativesImpl(RectGridGeom* image, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_RectGrid(image)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindRectGridDerivativesImpl() = default;
@@ -79,9 +83,9 @@ public:
     double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
     aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
     size_t index = 0;
-    int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t numComps = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     std::vector<double> plusValues(numComps);
     std::vector<double> minusValues(numComps);
     std::vector<double> dValuesdXi(numComps);
@@ -207,11 +211,11 @@ public:
           index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
           for(size_t i = 0; i < numComps; i++)
           {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3] = static_cast<DerivType>(xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 1] = static_cast<DerivType>(xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 2] = static_cast<DerivType>(xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i]);
           }
 
           if(counter > progIncrement)
@@ -329,7 +333,7 @@ public:
   }
 
   void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
+                                     std::vector<double>& plusValues, std::vector<double>& minusValues, const FieldType* field) const
   {
     size_t index1 = 0;
     size_t index2 = 0;
@@ -353,8 +357,8 @@ public:
       computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
       for(int32_t i = 0; i < numComps; i++)
       {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
+        plusValues[i] = static_cast<double>(field[index1 * numComps + i]);
+        minusValues[i] = static_cast<double>(field[index2 * numComps + i]);
       }
     }
 
@@ -366,8 +370,9 @@ public:
 
 private:
   RectGridGeom* m_RectGrid;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 
   enum FiniteDifferenceType_t
   {
@@ -402,6 +407,8 @@ RectGridGeom::RectGridGeom()
   m_yBounds = FloatArrayType::NullPointer();
   m_zBounds = FloatArrayType::NullPointer();
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_ElementsContainingVert = ElementDynamicList::NullPointer();
+  m_ElementNeighbors = ElementDynamicList::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -825,7 +832,12 @@ size_t RectGridGeom::getNumberOfElements() const
 // -----------------------------------------------------------------------------
 int RectGridGeom::findElementsContainingVert()
 {
-  return -1;
+  m_ElementsContainingVert = GridStencil::FindElementsContainingVert(getDimensions());
+  if(m_ElementsContainingVert.get() == nullptr)
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -833,14 +845,15 @@ int RectGridGeom::findElementsContainingVert()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer RectGridGeom::getElementsContainingVert() const
 {
-  return ElementDynamicList::NullPointer();
+  return m_ElementsContainingVert;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void RectGridGeom::setElementsContainingVert(ElementDynamicList::Pointer SIMPL_NOT_USED(elementsContainingVert))
+void RectGridGeom::setElementsContainingVert(ElementDynamicList::Pointer elementsContainingVert)
 {
+  m_ElementsContainingVert = elementsContainingVert;
 }
 
 // -----------------------------------------------------------------------------
@@ -848,6 +861,7 @@ void RectGridGeom::setElementsContainingVert(ElementDynamicList::Pointer SIMPL_N
 // -----------------------------------------------------------------------------
 void RectGridGeom::deleteElementsContainingVert()
 {
+  m_ElementsContainingVert = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -855,7 +869,12 @@ void RectGridGeom::deleteElementsContainingVert()
 // -----------------------------------------------------------------------------
 int RectGridGeom::findElementNeighbors()
 {
-  return -1;
+  m_ElementNeighbors = GridStencil::FindElementNeighbors(getDimensions(), GridStencil::Neighborhood::Face6);
+  if(m_ElementNeighbors.get() == nullptr)
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -863,14 +882,15 @@ int RectGridGeom::findElementNeighbors()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer RectGridGeom::getElementNeighbors() const
 {
-  return ElementDynamicList::NullPointer();
+  return m_ElementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(elementNeighbors))
+void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer elementNeighbors)
 {
+  m_ElementNeighbors = elementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
@@ -878,6 +898,7 @@ void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USE
 // -----------------------------------------------------------------------------
 void RectGridGeom::deleteElementNeighbors()
 {
+  m_ElementNeighbors = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -1029,6 +1050,14 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t RectGridGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   SizeVec3Type dims = getDimensions();
@@ -1047,7 +1076,12 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   ParallelData3DAlgorithm dataAlg;
   dataAlg.setRange(dims[2], dims[1], dims[0]);
   dataAlg.setGrain(grain);
-  dataAlg.execute(FindRectGridDerivativesImpl(this, field, derivatives));
+  int32_t numComps = field->getNumberOfComponents();
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindRectGridDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
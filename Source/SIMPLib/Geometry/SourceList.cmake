@@ -6,11 +6,13 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/CompositeTransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/EdgeGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/GeometryHelpers.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/GridStencil.hpp
   ${SIMPLib_SOURCE_DIR}/Geometry/HexahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry2D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/ImageBoxCopy.hpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ITransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
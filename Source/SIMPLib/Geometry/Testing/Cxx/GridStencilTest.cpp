@@ -0,0 +1,158 @@
+
+#include <cstdlib>
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include "SIMPLib/Geometry/GridStencil.hpp"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GridStencilTest
+{
+public:
+  GridStencilTest() = default;
+
+  virtual ~GridStencilTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::set<size_t> BruteForceNeighbors(const SizeVec3Type& dims, GridStencil::Neighborhood neighborhood, size_t x, size_t y, size_t z)
+  {
+    const int32_t maxOrder = static_cast<int32_t>(neighborhood) + 1;
+    std::set<size_t> neighbors;
+    for(int64_t dz = -1; dz <= 1; dz++)
+    {
+      for(int64_t dy = -1; dy <= 1; dy++)
+      {
+        for(int64_t dx = -1; dx <= 1; dx++)
+        {
+          const int32_t order = static_cast<int32_t>(std::abs(dx) + std::abs(dy) + std::abs(dz));
+          const int64_t nx = static_cast<int64_t>(x) + dx;
+          const int64_t ny = static_cast<int64_t>(y) + dy;
+          const int64_t nz = static_cast<int64_t>(z) + dz;
+          if(order == 0 || order > maxOrder || nx < 0 || ny < 0 || nz < 0)
+          {
+            continue;
+          }
+          if(nx >= static_cast<int64_t>(dims[0]) || ny >= static_cast<int64_t>(dims[1]) || nz >= static_cast<int64_t>(dims[2]))
+          {
+            continue;
+          }
+          neighbors.insert(static_cast<size_t>((nz * static_cast<int64_t>(dims[1]) + ny) * static_cast<int64_t>(dims[0]) + nx));
+        }
+      }
+    }
+    return neighbors;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighborhoods()
+  {
+    // 3D, 2D (single y and single z layer), 1D and single cell grids
+    std::vector<SizeVec3Type> allDims = {SizeVec3Type(5, 4, 3), SizeVec3Type(7, 1, 4), SizeVec3Type(6, 5, 1), SizeVec3Type(1, 9, 1), SizeVec3Type(1, 1, 1), SizeVec3Type(2, 2, 2)};
+    std::vector<GridStencil::Neighborhood> neighborhoods = {GridStencil::Neighborhood::Face6, GridStencil::Neighborhood::Edge18, GridStencil::Neighborhood::Vertex26};
+
+    for(const SizeVec3Type& dims : allDims)
+    {
+      const size_t numCells = dims[0] * dims[1] * dims[2];
+      for(GridStencil::Neighborhood neighborhood : neighborhoods)
+      {
+        GridStencil::Stencil stencil(dims, neighborhood);
+        std::vector<int32_t> visits(numCells, 0);
+        std::vector<std::vector<size_t>> found(numCells);
+        std::vector<uint8_t> directionsValid(numCells, 1);
+        GridStencil::Execute(dims, neighborhood, [&](const GridStencil::Neighbors& neighbors) {
+          const size_t cell = neighbors.center();
+          visits[cell]++;
+          for(size_t i = 0; i < neighbors.size(); i++)
+          {
+            found[cell].push_back(neighbors[i]);
+            // The reported direction must point at the reported neighbour
+            const std::array<int32_t, 3>& offset = stencil.offset(neighbors.direction(i));
+            const int64_t expected = static_cast<int64_t>(cell) + (offset[2] * static_cast<int64_t>(dims[1]) + offset[1]) * static_cast<int64_t>(dims[0]) + offset[0];
+            if(expected != static_cast<int64_t>(neighbors[i]))
+            {
+              directionsValid[cell] = 0;
+            }
+          }
+        });
+
+        for(size_t z = 0; z < dims[2]; z++)
+        {
+          for(size_t y = 0; y < dims[1]; y++)
+          {
+            for(size_t x = 0; x < dims[0]; x++)
+            {
+              const size_t cell = (z * dims[1] + y) * dims[0] + x;
+              DREAM3D_REQUIRE_EQUAL(visits[cell], 1)
+              DREAM3D_REQUIRE_EQUAL(directionsValid[cell], 1)
+              std::set<size_t> expected = BruteForceNeighbors(dims, neighborhood, x, y, z);
+              std::set<size_t> actual(found[cell].begin(), found[cell].end());
+              DREAM3D_REQUIRE_EQUAL(found[cell].size(), actual.size())
+              DREAM3D_REQUIRE(expected == actual)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestImageGeomConnectivity()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(SizeVec3Type(4, 3, 2));
+
+    DREAM3D_REQUIRE_EQUAL(geom->findElementNeighbors(), 0)
+    ElementDynamicList::Pointer neighbors = geom->getElementNeighbors();
+    DREAM3D_REQUIRE_VALID_POINTER(neighbors.get())
+    // Corner, edge and face cells of a 4x3x2 grid
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 3)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(1), 4)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(5), 5)
+    for(size_t i = 0; i < neighbors->getNumberOfElements(5); i++)
+    {
+      const MeshIndexType neighbor = neighbors->getElementListPointer(5)[i];
+      DREAM3D_REQUIRE(neighbor == 1 || neighbor == 4 || neighbor == 6 || neighbor == 9 || neighbor == 17)
+    }
+
+    DREAM3D_REQUIRE_EQUAL(geom->findElementsContainingVert(), 0)
+    ElementDynamicList::Pointer cellsOfVert = geom->getElementsContainingVert();
+    DREAM3D_REQUIRE_VALID_POINTER(cellsOfVert.get())
+    size_t total = 0;
+    for(size_t i = 0; i < 5 * 4 * 3; i++)
+    {
+      total += cellsOfVert->getNumberOfElements(i);
+    }
+    DREAM3D_REQUIRE_EQUAL(total, 4 * 3 * 2 * 8)
+    DREAM3D_REQUIRE_EQUAL(cellsOfVert->getNumberOfElements(0), 1)
+    // Point (1, 1, 1) is shared by eight cells
+    DREAM3D_REQUIRE_EQUAL(cellsOfVert->getNumberOfElements((1 * 4 + 1) * 5 + 1), 8)
+
+    geom->deleteElementNeighbors();
+    DREAM3D_REQUIRE(nullptr == geom->getElementNeighbors())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GridStencilTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestNeighborhoods());
+    DREAM3D_REGISTER_TEST(TestImageGeomConnectivity());
+  }
+
+private:
+  GridStencilTest(const GridStencilTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GridStencilTest&) = delete;  // Move assignment Not Implemented
+};
@@ -0,0 +1,184 @@
+
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MeshQualityKernelsTest
+{
+public:
+  MeshQualityKernelsTest() = default;
+
+  virtual ~MeshQualityKernelsTest() = default;
+
+  const float k_Epsilon = 1.0E-5f;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer CreateVertices(const std::vector<float>& coords)
+  {
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(coords.size() / 3, std::vector<size_t>(1, 3), QString("Vertices"), true);
+    std::copy(coords.begin(), coords.end(), vertices->begin());
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  SizeTArrayType::Pointer CreateElements(const std::vector<size_t>& ids, size_t numVertsPerElem, size_t numCopies)
+  {
+    SizeTArrayType::Pointer elements = SizeTArrayType::CreateArray(numCopies, std::vector<size_t>(1, numVertsPerElem), QString("Elements"), true);
+    for(size_t i = 0; i < numCopies; i++)
+    {
+      std::copy(ids.begin(), ids.end(), elements->begin() + i * numVertsPerElem);
+    }
+    return elements;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexahedra()
+  {
+    // Unit cube, more elements than one tile so the tail of the last tile is exercised
+    FloatArrayType::Pointer vertices = CreateVertices({0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+    SizeTArrayType::Pointer hexes = CreateElements({0, 1, 2, 3, 4, 5, 6, 7}, 8, 1000);
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(1000, QString("Volumes"), true);
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(1000, std::vector<size_t>(1, 3), QString("Centroids"), true);
+
+    GeometryHelpers::ElementMetrics metrics;
+    metrics.sizes = volumes->getPointer(0);
+    metrics.centroids = centroids->getPointer(0);
+    GeometryHelpers::Topology::FindElementMetrics<GeometryHelpers::ElementShape::Hexahedron>(*hexes, *vertices, metrics);
+
+    for(size_t i = 0; i < 1000; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes->getValue(i) - 1.0f) < k_Epsilon)
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE(std::fabs(centroids->getValue(3 * i + j) - 0.5f) < k_Epsilon)
+      }
+    }
+
+    volumes->initializeWithZeros();
+    GeometryHelpers::Topology::FindHexVolumes<size_t>(hexes, vertices, volumes);
+    DREAM3D_REQUIRE(std::fabs(volumes->getValue(999) - 1.0f) < k_Epsilon)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetrahedra()
+  {
+    // Regular tetrahedron inscribed in the cube [0, 2]^3, every dihedral angle is acos(1/3) = 70.53 degrees
+    FloatArrayType::Pointer vertices = CreateVertices({0, 0, 0, 2, 2, 0, 2, 0, 2, 0, 2, 2});
+    SizeTArrayType::Pointer tets = CreateElements({0, 1, 2, 3}, 4, 100);
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(100, QString("Volumes"), true);
+    FloatArrayType::Pointer jacobians = FloatArrayType::CreateArray(100, QString("Jacobians"), true);
+    FloatArrayType::Pointer angles = FloatArrayType::CreateArray(100, QString("Angles"), true);
+
+    GeometryHelpers::ElementMetrics metrics;
+    metrics.sizes = volumes->getPointer(0);
+    metrics.jacobians = jacobians->getPointer(0);
+    metrics.minDihedralAngles = angles->getPointer(0);
+    GeometryHelpers::Topology::FindElementMetrics<GeometryHelpers::ElementShape::Tetrahedron>(*tets, *vertices, metrics);
+
+    const float dihedral = static_cast<float>(std::acos(1.0 / 3.0) * SIMPLib::Constants::k_180OverPiD);
+    DREAM3D_REQUIRE(std::fabs(dihedral - 70.5288f) < 1.0E-3f)
+    for(size_t i = 0; i < 100; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(std::fabs(volumes->getValue(i)) - 8.0f / 3.0f) < k_Epsilon)
+      DREAM3D_REQUIRE(std::fabs(jacobians->getValue(i) - 6.0f * volumes->getValue(i)) < k_Epsilon)
+      DREAM3D_REQUIRE(std::fabs(angles->getValue(i) - dihedral) < 1.0E-3f)
+    }
+
+    // Corner tetrahedron, the edges at the origin have right dihedral angles and the ones of the
+    // slanted face acos(1/sqrt(3)) = 54.74 degrees
+    FloatArrayType::Pointer cornerVertices = CreateVertices({0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1});
+    metrics = GeometryHelpers::ElementMetrics();
+    metrics.minDihedralAngles = angles->getPointer(0);
+    GeometryHelpers::Topology::FindElementMetrics<GeometryHelpers::ElementShape::Tetrahedron>(*tets, *cornerVertices, metrics);
+    const float cornerDihedral = static_cast<float>(std::acos(1.0 / std::sqrt(3.0)) * SIMPLib::Constants::k_180OverPiD);
+    for(size_t i = 0; i < 100; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(angles->getValue(i) - cornerDihedral) < 1.0E-3f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSurfaceElements()
+  {
+    FloatArrayType::Pointer vertices = CreateVertices({0, 0, 0, 3, 0, 0, 3, 2, 0, 0, 2, 0});
+
+    SizeTArrayType::Pointer tris = CreateElements({0, 1, 2}, 3, 70);
+    FloatArrayType::Pointer triAreas = FloatArrayType::CreateArray(70, QString("Areas"), true);
+    GeometryHelpers::Topology::Find2DElementAreas<size_t>(tris, vertices, triAreas);
+
+    SizeTArrayType::Pointer quads = CreateElements({0, 1, 2, 3}, 4, 70);
+    FloatArrayType::Pointer quadAreas = FloatArrayType::CreateArray(70, QString("Areas"), true);
+    GeometryHelpers::Topology::Find2DElementAreas<size_t>(quads, vertices, quadAreas);
+
+    SizeTArrayType::Pointer edges = CreateElements({0, 2}, 2, 70);
+    FloatArrayType::Pointer lengths = FloatArrayType::CreateArray(70, QString("Lengths"), true);
+    GeometryHelpers::ElementMetrics metrics;
+    metrics.sizes = lengths->getPointer(0);
+    GeometryHelpers::Topology::FindElementMetrics<GeometryHelpers::ElementShape::Edge>(*edges, *vertices, metrics);
+
+    for(size_t i = 0; i < 70; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(triAreas->getValue(i) - 3.0f) < k_Epsilon)
+      DREAM3D_REQUIRE(std::fabs(quadAreas->getValue(i) - 6.0f) < k_Epsilon)
+      DREAM3D_REQUIRE(std::fabs(lengths->getValue(i) - std::sqrt(13.0f)) < k_Epsilon)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestOrphanVertexAverage()
+  {
+    // Vertex 3 belongs to no triangle
+    SizeTArrayType::Pointer tris = CreateElements({0, 1, 2}, 3, 2);
+    DynamicListArray<uint16_t, size_t>::Pointer elemsContainingVert = DynamicListArray<uint16_t, size_t>::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, size_t>(tris, elemsContainingVert, 4);
+
+    FloatArrayType::Pointer cellValues = FloatArrayType::CreateArray(2, QString("CellValues"), true);
+    cellValues->setValue(0, 1.0f);
+    cellValues->setValue(1, 3.0f);
+    DoubleArrayType::Pointer vertexValues = DoubleArrayType::CreateArray(4, QString("VertexValues"), true);
+    vertexValues->initializeWithValue(-1.0);
+
+    std::vector<GeometryHelpers::AveragedArray<float, double>> arrays = {GeometryHelpers::MakeAveragedArray(*cellValues, *vertexValues)};
+    GeometryHelpers::Generic::AverageCellArrayValues<size_t, float, uint16_t, double>(*elemsContainingVert, 4, arrays);
+
+    for(size_t i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(vertexValues->getValue(i), 2.0)
+    }
+    DREAM3D_REQUIRE_EQUAL(vertexValues->getValue(3), 0.0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### MeshQualityKernelsTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestHexahedra());
+    DREAM3D_REGISTER_TEST(TestTetrahedra());
+    DREAM3D_REGISTER_TEST(TestSurfaceElements());
+    DREAM3D_REGISTER_TEST(TestOrphanVertexAverage());
+  }
+
+private:
+  MeshQualityKernelsTest(const MeshQualityKernelsTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const MeshQualityKernelsTest&) = delete;         // Move assignment Not Implemented
+};
@@ -55,22 +55,24 @@
  * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying triangles
  */
+template <typename FieldType, typename DerivType>
 class FindTetDerivativesImpl
 {
 public:
-  FindTetDerivativesImpl(TetrahedralGeom* tets, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindTetDerivativesImpl(TetrahedralGeom* tets, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Tets(tets)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindTetDerivativesImpl() = default;
 
   void compute(size_t start, size_t end) const
   {
-    int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t cDims = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     double values[4] = {0.0, 0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     size_t verts[4]{0, 0, 0, 0};
@@ -86,12 +88,12 @@ public:
       {
         for(size_t k = 0; k < 4; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = static_cast<double>(fieldPtr[cDims * verts[k] + j]);
         }
         DerivativeHelpers::TetDeriv()(m_Tets, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<DerivType>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<DerivType>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<DerivType>(derivs[2]);
       }
 
       if(counter > progIncrement)
@@ -110,8 +112,9 @@ public:
 
 private:
   TetrahedralGeom* m_Tets;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
@@ -566,6 +569,14 @@ void TetrahedralGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t TetrahedralGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t numTets = getNumberOfTets();
@@ -575,9 +586,14 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
+  int32_t numComps = field->getNumberOfComponents();
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numTets);
-  dataAlg.execute(FindTetDerivativesImpl(this, field, derivatives));
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindTetDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
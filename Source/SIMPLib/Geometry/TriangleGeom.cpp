@@ -55,22 +55,24 @@
  * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
  * derivative of an arbitrary dimensional field on the underlying triangles
  */
+template <typename FieldType, typename DerivType>
 class FindTriangleDerivativesImpl
 {
 public:
-  FindTriangleDerivativesImpl(TriangleGeom* tris, const DoubleArrayType::Pointer& field, const DoubleArrayType::Pointer& derivs)
+  FindTriangleDerivativesImpl(TriangleGeom* tris, const FieldType* field, DerivType* derivs, int32_t numComps)
   : m_Tris(tris)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_NumComps(numComps)
   {
   }
   virtual ~FindTriangleDerivativesImpl() = default;
 
   void compute(size_t start, size_t end) const
   {
-    int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    int32_t cDims = m_NumComps;
+    const FieldType* fieldPtr = m_Field;
+    DerivType* derivsPtr = m_Derivatives;
     double values[3] = {0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     size_t verts[3]{0, 0, 0};
@@ -86,12 +88,12 @@ public:
       {
         for(size_t k = 0; k < 3; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = static_cast<double>(fieldPtr[cDims * verts[k] + j]);
         }
         DerivativeHelpers::TriangleDeriv()(m_Tris, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<DerivType>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<DerivType>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<DerivType>(derivs[2]);
       }
 
       if(counter > progIncrement)
@@ -110,8 +112,9 @@ public:
 
 private:
   TriangleGeom* m_Tris;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  const FieldType* m_Field;
+  DerivType* m_Derivatives;
+  int32_t m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
@@ -485,6 +488,14 @@ void TriangleGeom::getShapeFunctions(double pCoords[3], double* shape) const
 //
 // -----------------------------------------------------------------------------
 void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives(std::static_pointer_cast<IDataArray>(field), std::static_pointer_cast<IDataArray>(derivatives), observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t TriangleGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t numTris = getNumberOfTris();
@@ -494,9 +505,14 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
+  int32_t numComps = field->getNumberOfComponents();
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numTris);
-  dataAlg.execute(FindTriangleDerivativesImpl(this, field, derivatives));
+  if(!DerivativeHelpers::ExecuteWithFieldTypes(*field, *derivatives, [&](const auto* fieldPtr, auto* derivsPtr) { dataAlg.execute(FindTriangleDerivativesImpl(this, fieldPtr, derivsPtr, numComps)); }))
+  {
+    return -1;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
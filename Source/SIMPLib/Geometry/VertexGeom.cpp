@@ -302,6 +302,15 @@ void VertexGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType
   derivatives->initializeWithZeros();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t VertexGeom::findDerivatives(IDataArray::Pointer field, IDataArray::Pointer derivatives, Observable* observable)
+{
+  derivatives->initializeWithZeros();
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -35,6 +35,8 @@
 
 #include "H5DataArrayReader.h"
 
+#include <functional>
+#include <numeric>
 #include <vector>
 
 #include "H5Support/QH5Lite.h"
@@ -44,6 +46,7 @@ using namespace H5Support;
 
 #include <QtCore/QDebug>
 
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -549,3 +552,34 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   }
   return iDataArray;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  int err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(metaDataOnly)
+  {
+    return BitMaskArray::CreateArray(numTuples, name, false);
+  }
+
+  BitMaskArray::Pointer mask = BitMaskArray::CreateArray(numTuples, name, false);
+  err = mask->readH5Data(gid);
+  if(err < 0)
+  {
+    qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
+    return IDataArray::NullPointer();
+  }
+  return mask;
+}
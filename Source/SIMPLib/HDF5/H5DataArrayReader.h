@@ -95,6 +95,15 @@ public:
    */
   static IDataArrayShPtrType ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadBitMaskArray
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return
+   */
+  static IDataArrayShPtrType ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+
 protected:
   H5DataArrayReader();
 
@@ -0,0 +1,64 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <mutex>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The H5ScopedLock class holds the process wide HDF5 lock for as long as it lives. Unless the
+ * HDF5 library was built thread safe, code that may run on several threads at once (for example the
+ * tiles of a montage) takes this lock around its HDF5 calls so that the rest of its work can still
+ * run concurrently. The lock is recursive, so a reader that calls into another reader does not
+ * deadlock. When the library is thread safe the lock does nothing.
+ */
+class SIMPLib_EXPORT H5ScopedLock
+{
+public:
+  H5ScopedLock();
+  ~H5ScopedLock();
+
+  /**
+   * @brief Returns true if the HDF5 library was built thread safe.
+   * @return
+   */
+  static bool IsLibraryThreadSafe();
+
+private:
+  std::unique_lock<std::recursive_mutex> m_Lock;
+
+public:
+  H5ScopedLock(const H5ScopedLock&) = delete;            // Copy Constructor Not Implemented
+  H5ScopedLock(H5ScopedLock&&) = delete;                 // Move Constructor Not Implemented
+  H5ScopedLock& operator=(const H5ScopedLock&) = delete; // Copy Assignment Not Implemented
+  H5ScopedLock& operator=(H5ScopedLock&&) = delete;      // Move Assignment Not Implemented
+};
@@ -9,6 +9,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.h
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ScopedLock.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5StatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5TransformationStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/VTKH5Constants.h
@@ -21,6 +22,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ScopedLock.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5StatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5TransformationStatsDataDelegate.cpp
 
@@ -84,10 +84,10 @@ ImportDream3DImageContainer<TElementIdentifier, TElement>
 ::DeallocateManagedMemory()
 {
   // Encapsulate all image memory deallocation here
-  if(this->GetContainerManageMemory())
+  // Buffers adopted from a DataArray were allocated with new[] as well, so they are released the same way
+  if(this->GetContainerManageMemory() && nullptr != this->GetBufferPointer())
   {
     Element* data = this->GetBufferPointer();
-    data->~Element();
     delete[](data);
     this->SetImportPointer(nullptr);
   }
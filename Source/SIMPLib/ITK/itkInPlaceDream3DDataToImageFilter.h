@@ -60,6 +60,16 @@ public:
   itkGetConstMacro(InPlace, bool);
   itkBooleanMacro(InPlace);
 
+  /**
+   * @brief When the filter is not running in place, only the requested region of the output is
+   * copied out of the DataArray on each update instead of the whole volume. Combined with a
+   * streaming consumer this keeps the ITK side of the pipeline at one slab at a time. In place
+   * execution already exposes the whole buffer without copying, so this flag has no effect there.
+   */
+  itkSetMacro(Streaming, bool);
+  itkGetConstMacro(Streaming, bool);
+  itkBooleanMacro(Streaming);
+
 protected:
   InPlaceDream3DDataToImageFilter();
   ~InPlaceDream3DDataToImageFilter();
@@ -68,6 +78,13 @@ protected:
 
   void GenerateOutputInformation() override;
   void GenerateData() override;
+
+  /**
+   * @brief Copies the pixels of the output's requested region out of the DataArray buffer, one x-row at a time
+   * @param source
+   */
+  void CopyRequestedRegion(const PixelType* source);
+
   DataContainerShPtrType m_DataContainer;
 
 private:
@@ -77,6 +94,7 @@ private:
   typename ImportImageContainerType::Pointer m_ImportImageContainer;
   bool m_InPlace = true;                         // enable the possibility of in-place
   bool m_PixelContainerWillOwnTheBuffer = false; // By default, this filter does not take data ownership
+  bool m_Streaming = false;                      // copy only the requested region when not in-place
 
 public:
   InPlaceDream3DDataToImageFilter(const InPlaceDream3DDataToImageFilter&) = delete;            // Copy Constructor Not Implemented
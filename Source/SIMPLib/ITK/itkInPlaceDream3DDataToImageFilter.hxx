@@ -2,6 +2,10 @@
 
 #include "itkInPlaceDream3DDataToImageFilter.h"
 
+#include <algorithm>
+
+#include <itkImageRegionIteratorWithIndex.h>
+
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -102,21 +106,26 @@ void InPlaceDream3DDataToImageFilter< PixelType, VDimension >::GenerateData()
   // Get data pointer
   AttributeMatrix::Pointer ma = m_DataContainer->getAttributeMatrix(m_AttributeMatrixArrayName.c_str());
   IDataArray::Pointer dataArray = ma->getAttributeArray(m_DataArrayName.c_str());
-  size_t size = dataArray->getSize();
-  PixelType *buffer;
-  if(m_InPlace)
+  size_t size = dataArray->getNumberOfTuples();
+  PixelType* buffer = static_cast<PixelType*>(dataArray->getVoidPointer(0));
+  ImagePointer outputPtr = this->GetOutput();
+
+  if(!m_InPlace)
   {
-    if (m_PixelContainerWillOwnTheBuffer)
-    {
-      dataArray->releaseOwnership();
-    }
-    buffer = static_cast<PixelType*>(dataArray->getVoidPointer( 0 ));
+    // The caller wants the DataArray protected from in-place ITK filters so the pixels have to be
+    // copied. Only copy what was actually requested; a streaming consumer asks for one slab at a time.
+    m_ImportImageContainer = nullptr;
+    outputPtr->SetBufferedRegion(m_Streaming ? outputPtr->GetRequestedRegion() : outputPtr->GetLargestPossibleRegion());
+    outputPtr->Allocate();
+    CopyRequestedRegion(buffer);
+    return;
   }
-  else
+
+  // Adopt the DataArray buffer directly. DataArray allocates with new[] which is also how the import
+  // container frees memory it manages, so ownership can move from the array to the image.
+  if(m_PixelContainerWillOwnTheBuffer)
   {
-    m_PixelContainerWillOwnTheBuffer = true;
-    buffer = new PixelType[size];
-    ::memcpy( buffer, static_cast<PixelType*>(dataArray->getVoidPointer( 0 )), size * sizeof( PixelType ) );
+    dataArray->releaseOwnership();
   }
   if( !m_ImportImageContainer || buffer != m_ImportImageContainer->GetImportPointer() )
   {
@@ -125,9 +134,35 @@ void InPlaceDream3DDataToImageFilter< PixelType, VDimension >::GenerateData()
         size, m_PixelContainerWillOwnTheBuffer);
   }
   // get pointer to the output
-  ImagePointer outputPtr = this->GetOutput();
   outputPtr->SetBufferedRegion( outputPtr->GetLargestPossibleRegion() );
   outputPtr->SetPixelContainer( m_ImportImageContainer );
- }
+}
+
+template< typename PixelType, unsigned int VDimension>
+void InPlaceDream3DDataToImageFilter< PixelType, VDimension >::CopyRequestedRegion(const PixelType* source)
+{
+  ImagePointer outputPtr = this->GetOutput();
+  const typename ImageType::RegionType& largestRegion = outputPtr->GetLargestPossibleRegion();
+  const typename ImageType::RegionType& bufferedRegion = outputPtr->GetBufferedRegion();
+
+  // Walk the start of every x-row of the buffered region; each row is contiguous in both buffers
+  typename ImageType::SizeType rowStartSize = bufferedRegion.GetSize();
+  const SizeValueType rowLength = rowStartSize[0];
+  rowStartSize[0] = 1;
+  typename ImageType::RegionType rowStarts(bufferedRegion.GetIndex(), rowStartSize);
+
+  for(ImageRegionIteratorWithIndex<ImageType> it(outputPtr, rowStarts); !it.IsAtEnd(); ++it)
+  {
+    const typename ImageType::IndexType& index = it.GetIndex();
+    SizeValueType sourceOffset = 0;
+    SizeValueType stride = 1;
+    for(unsigned int d = 0; d < VDimension; d++)
+    {
+      sourceOffset += static_cast<SizeValueType>(index[d] - largestRegion.GetIndex()[d]) * stride;
+      stride *= largestRegion.GetSize()[d];
+    }
+    std::copy(source + sourceOffset, source + sourceOffset + rowLength, &(it.Value()));
+  }
+}
 
 }// end of itk namespace
@@ -71,6 +71,7 @@ protected:
 
   void GenerateData() override;
   void GenerateOutputInformation() override;
+  void GenerateInputRequestedRegion() override;
 
   void CheckValidArrayPathComponentName(std::string var) const;
 
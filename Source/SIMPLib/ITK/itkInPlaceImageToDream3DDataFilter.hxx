@@ -3,6 +3,9 @@
 #include "itkInPlaceImageToDream3DDataFilter.h"
 #include "itkGetComponentsDimensions.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+
+#include <algorithm>
+
 #include <QString>
 
 namespace itk
@@ -93,6 +96,18 @@ void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateOutputInfor
   dataContainer->setGeometry(imageGeom);
 }
 
+template <typename PixelType, unsigned int VDimension>
+void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+  // The whole image ends up in the DataArray so the whole image has to be buffered upstream
+  ImagePointer inputPtr = dynamic_cast<ImageType*>(this->GetInput(0));
+  if(inputPtr)
+  {
+    inputPtr->SetRequestedRegionToLargestPossibleRegion();
+  }
+}
+
 template <typename PixelType, unsigned int VDimension>
 void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateData()
 {
@@ -141,19 +156,42 @@ void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateData()
       attrMat->removeAttributeArray(m_DataArrayName.c_str());
     }
   }
+  const size_t numElements = imageGeom->getNumberOfElements();
+  if(inputPtr->GetBufferedRegion() != inputPtr->GetLargestPossibleRegion())
+  {
+    itkExceptionMacro("Input image buffer does not cover the largest possible region.");
+  }
+  ValueType* buffer = reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer());
   typename DataArrayPixelType::Pointer data;
-  inputPtr->SetBufferedRegion(inputPtr->GetLargestPossibleRegion());
   if(m_InPlace)
   {
-    inputPtr->GetPixelContainer()->SetContainerManageMemory(false);
-    data = DataArrayPixelType::WrapPointer(reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), imageGeom->getNumberOfElements(), cDims, this->GetDataArrayName().c_str(), true);
+    typename ImageType::PixelContainer* pixelContainer = inputPtr->GetPixelContainer();
+    // When every ITK filter ran in place the image is still backed by the buffer of the array we are
+    // writing back to. Wrapping it again would leave two arrays owning one buffer, so just move the
+    // ownership back to the existing array.
+    typename DataArrayPixelType::Pointer existing = std::dynamic_pointer_cast<DataArrayPixelType>(attrMat->getAttributeArray(m_DataArrayName.c_str()));
+    if(nullptr != existing && existing->getPointer(0) == buffer && existing->getComponentDimensions() == cDims)
+    {
+      if(pixelContainer->GetContainerManageMemory())
+      {
+        pixelContainer->SetContainerManageMemory(false);
+        existing->takeOwnership();
+      }
+      outputPtr->Set(dataContainer);
+      return;
+    }
+    // Adopt the image buffer. The pixel container allocates with new[] which is how DataArray frees its
+    // memory, but the array may only free it if the container was responsible for it in the first place.
+    const bool ownsData = pixelContainer->GetContainerManageMemory();
+    pixelContainer->SetContainerManageMemory(false);
+    data = DataArrayPixelType::WrapPointer(buffer, numElements, cDims, this->GetDataArrayName().c_str(), ownsData);
   }
   else
   {
-    data = DataArrayPixelType::CreateArray(imageGeom->getNumberOfElements(), cDims, m_DataArrayName.c_str(), true);
+    data = DataArrayPixelType::CreateArray(numElements, cDims, m_DataArrayName.c_str(), true);
     if(nullptr != data.get())
     {
-      ::memcpy(data->getPointer(0), reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), imageGeom->getNumberOfElements() * sizeof(ValueType));
+      std::copy(buffer, buffer + data->getSize(), data->getPointer(0));
     }
   }
   attrMat->addOrReplaceAttributeArray(data);
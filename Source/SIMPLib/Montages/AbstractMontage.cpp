@@ -32,7 +32,16 @@
 
 #include "AbstractMontage.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -77,6 +86,169 @@ std::vector<DataArrayPath> AbstractMontage::getDataArrayPaths() const
   return paths;
 }
 
+namespace
+{
+/**
+ * @brief Returns a new DataContainer with the tile's name, geometry and AttributeMatrix layout that
+ * lists the tile's arrays without taking them from their AttributeMatrix. A task can then add the
+ * tile to its own DataContainerArray, rename it, or add and remove arrays without changing the montage.
+ * @param tile
+ * @return
+ */
+DataContainerShPtr ShallowCopyTile(const DataContainer& tile)
+{
+  DataContainer::Pointer copy = DataContainer::New(tile.getName());
+  copy->setGeometry(tile.getGeometry());
+  for(const auto& am : tile.getAttributeMatrices())
+  {
+    AttributeMatrix::Pointer amCopy = AttributeMatrix::New(am->getTupleDimensions(), am->getName(), am->getType());
+    for(const auto& array : am->getChildren())
+    {
+      amCopy->insertOrAssignShared(array);
+    }
+    copy->addOrReplaceAttributeMatrix(amCopy);
+  }
+  return copy;
+}
+
+/**
+ * @brief The TileWorker class pulls tile positions from a shared counter until every tile has been
+ * handed out or a tile has failed. Each ParallelTaskAlgorithm task runs one worker.
+ */
+class TileWorker
+{
+public:
+  struct SharedState
+  {
+    const AbstractMontage::CollectionType& tiles;
+    AbstractMontage::CollectionType& results;
+    const AbstractMontage::TileTask& task;
+    const AbstractMontage::TileExecutionOptions& options;
+    std::atomic<size_t> nextTile = {0};
+    std::atomic<int> firstError = {0};
+    std::mutex loaderMutex;
+  };
+
+  explicit TileWorker(SharedState& state)
+  : m_State(state)
+  {
+  }
+
+  void operator()() const
+  {
+    const size_t tileCount = m_State.tiles.size();
+    for(size_t tile = m_State.nextTile++; tile < tileCount; tile = m_State.nextTile++)
+    {
+      if(m_State.firstError.load() < 0)
+      {
+        return;
+      }
+
+      int err = processTile(tile);
+      if(err < 0)
+      {
+        int expected = 0;
+        m_State.firstError.compare_exchange_strong(expected, err);
+      }
+
+      if(m_State.options.progress != nullptr)
+      {
+        m_State.options.progress->increment(1);
+      }
+      if(m_State.options.tileFinished)
+      {
+        m_State.options.tileFinished(tile, err);
+      }
+    }
+  }
+
+private:
+  int processTile(size_t tile) const
+  {
+    DataContainerShPtr dc = m_State.tiles[tile];
+    if(m_State.options.loader)
+    {
+      // Most readers are not thread safe, so tiles are loaded one at a time
+      std::lock_guard<std::mutex> lock(m_State.loaderMutex);
+      dc = m_State.options.loader(tile, m_State.tiles[tile]);
+      if(nullptr == dc)
+      {
+        return AbstractMontage::k_TileLoadError;
+      }
+    }
+    else if(nullptr == dc)
+    {
+      return 0;
+    }
+    else
+    {
+      // The montage's own DataContainer may be parented, and so re-parented, by the task
+      dc = ShallowCopyTile(*dc);
+    }
+
+    int err = 0;
+    DataContainerShPtr result = m_State.task(tile, dc, err);
+    // Drop the loaded tile now rather than when the next one replaces it
+    dc.reset();
+    if(err < 0)
+    {
+      return err;
+    }
+    m_State.results[tile] = result;
+    return 0;
+  }
+
+  SharedState& m_State;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AbstractMontage::executeTiles(const TileTask& task, CollectionType& results, const TileExecutionOptions& options) const
+{
+  CollectionType tiles = getDataContainers();
+  results.assign(tiles.size(), nullptr);
+  if(tiles.empty())
+  {
+    return 0;
+  }
+
+  size_t workerCount = options.maxConcurrentTiles;
+  if(workerCount == 0)
+  {
+    workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  workerCount = std::min(workerCount, tiles.size());
+
+  TileWorker::SharedState state{tiles, results, task, options};
+  ParallelTaskAlgorithm taskAlg;
+  taskAlg.setMaxThreads(static_cast<uint32_t>(workerCount));
+  for(size_t i = 0; i < workerCount; i++)
+  {
+    taskAlg.execute(TileWorker(state));
+  }
+  taskAlg.wait();
+
+  return state.firstError.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractMontage::Pointer AbstractMontage::assembleTiles(const CollectionType& results) const
+{
+  DataContainerArrayShPtr dca = DataContainerArray::New();
+  for(const auto& dc : results)
+  {
+    if(nullptr != dc)
+    {
+      dca->addOrReplaceDataContainer(dc);
+    }
+  }
+  return propagate(dca);
+}
+
 // -----------------------------------------------------------------------------
 AbstractMontage::Pointer AbstractMontage::NullPointer()
 {
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include <QtCore/QString>
 
 #include "H5Support/H5SupportTypeDefs.h"
@@ -49,6 +52,8 @@ using DataContainerShPtr = std::shared_ptr<DataContainer>;
 class DataContainerArray;
 using DataContainerArrayShPtr = std::shared_ptr<DataContainerArray>;
 
+class ProgressTracker;
+
 /**
  * @brief The AbstractMontage class is the base for the various types of montages and
  * contains the common API between the types.  It does not have access to individual tiles,
@@ -71,6 +76,44 @@ public:
   using Iterator = CollectionType::iterator;
   using ConstIterator = CollectionType::const_iterator;
 
+  /**
+   * @brief Returns the DataContainer of a tile on demand, for example by reading it from a file.
+   * The first argument is the tile's position in getDataContainers() and the second the DataContainer
+   * the montage currently holds for it, which may be an empty placeholder that only carries the name.
+   * Returning nullptr fails the tile with k_TileLoadError. Loaders are never called concurrently.
+   */
+  using TileLoader = std::function<DataContainerShPtr(size_t, const DataContainerShPtr&)>;
+
+  /**
+   * @brief Processes a single tile and returns the DataContainer that becomes the tile's result.
+   * The result should keep the tile's name so that assembleTiles() can place it. A negative value
+   * written to the int argument fails the tile.
+   */
+  using TileTask = std::function<DataContainerShPtr(size_t, const DataContainerShPtr&, int&)>;
+
+  /**
+   * @brief Called once per finished tile with the tile's position and error code.
+   */
+  using TileCallback = std::function<void(size_t, int)>;
+
+  /**
+   * @brief The TileExecutionOptions struct configures executeTiles().
+   *
+   * maxConcurrentTiles limits the number of tiles processed at the same time; 0 uses the hardware
+   * concurrency. loader loads each tile on demand; when empty the DataContainers already held by the
+   * montage are used. progress is incremented by one and tileFinished is called from the worker thread
+   * for every finished tile.
+   */
+  struct TileExecutionOptions
+  {
+    size_t maxConcurrentTiles = 0;
+    TileLoader loader;
+    ProgressTracker* progress = nullptr;
+    TileCallback tileFinished;
+  };
+
+  static constexpr int k_TileLoadError = -11000;
+
   ~AbstractMontage() override;
 
   /**
@@ -103,6 +146,38 @@ public:
    */
   std::vector<DataArrayPath> getDataArrayPaths() const;
 
+  /**
+   * @brief Runs task once for every tile of the montage with at most options.maxConcurrentTiles tiles
+   * in flight. Tiles are handed out in order to a fixed set of workers, so a worker starts its next
+   * tile as soon as it finishes one. When a loader is given each tile is loaded right before its task
+   * runs and dropped as soon as the task returns, so only the tiles in flight and the returned results
+   * are held in memory. Tiles without a DataContainer and without a loader are skipped.
+   *
+   * Without a loader the task receives a shallow copy of the montage's DataContainer: a new
+   * DataContainer and AttributeMatrices that share the tile's geometry and arrays. The task may add it
+   * to a DataContainerArray, rename it or change its arrays' layout without touching the montage, but
+   * values written into a shared array or geometry show through.
+   *
+   * Loaders and tasks run on several threads. Code in them that reads or writes HDF5 files, such as
+   * the DataContainerReader and DataContainerWriter filters, holds the process wide H5ScopedLock
+   * while it does, so only the HDF5 calls are serialized.
+   *
+   * Once a tile fails no further tiles are started; tiles already in flight are finished.
+   * @param task
+   * @param results Receives each tile's result at the tile's position; failed and skipped tiles are nullptr
+   * @param options
+   * @return 0 on success, otherwise the error code of the first tile that failed
+   */
+  int executeTiles(const TileTask& task, CollectionType& results, const TileExecutionOptions& options = TileExecutionOptions()) const;
+
+  /**
+   * @brief Returns a copy of the montage that references the given tile results instead of the
+   * original DataContainers. Results are matched to tiles by name, see propagate().
+   * @param results
+   * @return
+   */
+  Pointer assembleTiles(const CollectionType& results) const;
+
   /**
    * @brief Returns an HTML string containing information about the montage.
    * @return
@@ -32,6 +32,8 @@
 
 #include "MontageSupport.h"
 
+#include <mutex>
+
 #include <QtCore/QString>
 
 #include "H5Support/H5ScopedSentinel.h"
@@ -44,7 +46,11 @@ using namespace H5Support;
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/QtBackwardCompatibilityMacro.h"
 #include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/HDF5/H5ScopedLock.h"
 #include "SIMPLib/Montages/GridMontage.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -143,3 +149,90 @@ DataContainerArray::MontageCollection MontageSupport::IO::ReadMontagesFromHDF5(h
 
   return montageCollection;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractMontage::TileLoader MontageSupport::IO::CreateDREAM3DTileLoader(const QString& filePath)
+{
+  // executeTiles() never calls a loader concurrently, so the cached structure needs no lock
+  std::shared_ptr<DataContainerArrayProxy> structure;
+  return [filePath, structure](size_t /* tile */, const DataContainerShPtr& placeholder) mutable -> DataContainerShPtr {
+    if(nullptr == placeholder)
+    {
+      return nullptr;
+    }
+
+    // Tasks of other tiles may read or write HDF5 files while this tile loads
+    H5ScopedLock h5Lock;
+    SIMPLH5DataReader::Pointer reader = SIMPLH5DataReader::New();
+    if(!reader->openFile(filePath))
+    {
+      return nullptr;
+    }
+    if(nullptr == structure)
+    {
+      int err = 0;
+      DataContainerArrayProxy fileStructure = reader->readDataContainerArrayStructure(nullptr, err);
+      if(err < 0)
+      {
+        return nullptr;
+      }
+      structure = std::make_shared<DataContainerArrayProxy>(fileStructure);
+    }
+
+    const QString dcName = placeholder->getName();
+    DataContainerArrayProxy proxy = *structure;
+    if(!proxy.contains(dcName))
+    {
+      return nullptr;
+    }
+    for(DataContainerProxy& dcProxy : proxy.getDataContainers())
+    {
+      dcProxy.setFlag(dcProxy.getName() == dcName ? Qt::Checked : Qt::Unchecked);
+    }
+
+    DataContainerArray::Pointer dca = reader->readSIMPLDataUsingProxy(proxy, false);
+    if(nullptr == dca)
+    {
+      return nullptr;
+    }
+    return dca->getDataContainer(dcName);
+  };
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractMontage::TileTask MontageSupport::CreatePipelineTileTask(const FilterPipelineShPtr& pipeline, const QString& dataContainerName)
+{
+  // Copying goes through the pipeline's JSON and the filter factories, so copies are made one at a time
+  std::shared_ptr<std::mutex> copyMutex = std::make_shared<std::mutex>();
+  return [pipeline, dataContainerName, copyMutex](size_t /* tile */, const DataContainerShPtr& dc, int& err) -> DataContainerShPtr {
+    FilterPipeline::Pointer tilePipeline;
+    {
+      std::lock_guard<std::mutex> lock(*copyMutex);
+      tilePipeline = pipeline->deepCopy();
+    }
+
+    const QString tileName = dc->getName();
+    const QString pipelineName = dataContainerName.isEmpty() ? tileName : dataContainerName;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addOrReplaceDataContainer(dc);
+    dc->setName(pipelineName);
+    dca = tilePipeline->execute(dca);
+
+    DataContainerShPtr result = (nullptr != dca) ? dca->getDataContainer(pipelineName) : DataContainerShPtr();
+    dc->setName(tileName);
+    if(nullptr != result)
+    {
+      result->setName(tileName);
+    }
+    err = tilePipeline->getErrorCode();
+    if(err < 0)
+    {
+      return nullptr;
+    }
+    return result;
+  };
+}
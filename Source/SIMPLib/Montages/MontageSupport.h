@@ -37,9 +37,10 @@
 #include "H5Support/H5SupportTypeDefs.h"
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Montages/AbstractMontage.h"
 
-class AbstractMontage;
-using AbstractMontageShPtr = std::shared_ptr<AbstractMontage>;
+class FilterPipeline;
+using FilterPipelineShPtr = std::shared_ptr<FilterPipeline>;
 
 namespace MontageSupport
 {
@@ -48,5 +49,31 @@ namespace IO
 AbstractMontageShPtr ReadMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err);
 
 DataContainerArray::MontageCollection ReadMontagesFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err);
+
+/**
+ * @brief Returns a tile loader for AbstractMontage::executeTiles() that reads the DataContainer named
+ * like the montage's placeholder for the tile from a .dream3d file. The file structure is read once on
+ * the first call; each tile then reads only its own DataContainer. The reads hold the process wide
+ * H5ScopedLock.
+ * @param filePath
+ * @return
+ */
+AbstractMontage::TileLoader CreateDREAM3DTileLoader(const QString& filePath);
 } // namespace IO
+
+/**
+ * @brief Returns a tile task for AbstractMontage::executeTiles() that runs a copy of the pipeline on a
+ * DataContainerArray holding only the tile and returns the tile's DataContainer afterwards. Every tile
+ * gets its own deep copy of the pipeline because filters keep state while they execute.
+ *
+ * When dataContainerName is not empty the tile is presented to the pipeline under that name, so a
+ * pipeline whose paths refer to a single DataContainer runs on every tile; the tile and the result get
+ * the tile's name back afterwards. The pipeline runs on a shallow copy of the tile, see
+ * AbstractMontage::executeTiles(). Tiles run concurrently; the filters that read or write HDF5 files
+ * hold the process wide H5ScopedLock while they do.
+ * @param pipeline
+ * @param dataContainerName
+ * @return
+ */
+AbstractMontage::TileTask CreatePipelineTileTask(const FilterPipelineShPtr& pipeline, const QString& dataContainerName = QString());
 } // namespace MontageSupport
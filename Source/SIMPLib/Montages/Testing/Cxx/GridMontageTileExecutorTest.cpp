@@ -0,0 +1,316 @@
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Montages/GridMontage.h"
+#include "SIMPLib/Montages/MontageSupport.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GridMontageTileExecutorTest
+{
+public:
+  GridMontageTileExecutorTest() = default;
+
+  virtual ~GridMontageTileExecutorTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  GridMontage::Pointer CreateMontage(size_t rows, size_t cols)
+  {
+    GridMontage::Pointer montage = GridMontage::New("Montage", rows, cols);
+    for(size_t row = 0; row < rows; row++)
+    {
+      for(size_t col = 0; col < cols; col++)
+      {
+        montage->setDataContainer(montage->getTileIndex(row, col), DataContainer::New(QString("Tile_%1_%2").arg(row).arg(col)));
+      }
+    }
+    return montage;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void AddTileData(const DataContainer::Pointer& dc, int32_t tile)
+  {
+    AttributeMatrix::Pointer am = AttributeMatrix::New({10}, "CellData", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(10, QString("Data"), true);
+    for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+    {
+      data->setValue(i, (i % 2 == 0) ? 0 : tile);
+    }
+    am->insertOrAssign(data);
+    dc->addOrReplaceAttributeMatrix(am);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::GridMontageTileExecutorTest::TestFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLazyExecution()
+  {
+    const size_t maxConcurrentTiles = 3;
+    GridMontage::Pointer montage = CreateMontage(4, 5);
+    AbstractMontage::CollectionType placeholders = montage->getDataContainers();
+
+    std::atomic<int32_t> inFlight = {0};
+    std::atomic<int32_t> maxInFlight = {0};
+    std::atomic<int32_t> loads = {0};
+    std::mutex finishedMutex;
+    std::vector<int32_t> finished(placeholders.size(), 0);
+
+    AbstractMontage::TileExecutionOptions options;
+    options.maxConcurrentTiles = maxConcurrentTiles;
+    options.loader = [&](size_t tile, const DataContainer::Pointer& placeholder) {
+      loads++;
+      DataContainer::Pointer dc = DataContainer::New(placeholder->getName());
+      AttributeMatrix::Pointer am = AttributeMatrix::New({10}, "CellData", AttributeMatrix::Type::Cell);
+      Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(10, QString("Data"), true);
+      data->initializeWithValue(static_cast<int32_t>(tile));
+      am->insertOrAssign(data);
+      dc->addOrReplaceAttributeMatrix(am);
+      return dc;
+    };
+    options.tileFinished = [&](size_t tile, int err) {
+      std::lock_guard<std::mutex> lock(finishedMutex);
+      finished[tile] += (err == 0) ? 1 : 100;
+    };
+
+    AbstractMontage::TileTask task = [&](size_t tile, const DataContainer::Pointer& dc, int& err) {
+      int32_t current = ++inFlight;
+      int32_t previous = maxInFlight.load();
+      while(previous < current && !maxInFlight.compare_exchange_weak(previous, current))
+      {
+      }
+
+      Int32ArrayType::Pointer data = dc->getAttributeMatrix("CellData")->getAttributeArrayAs<Int32ArrayType>("Data");
+      int32_t sum = 0;
+      for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+      {
+        sum += data->getValue(i);
+      }
+      err = (sum == static_cast<int32_t>(tile) * 10) ? 0 : -1;
+
+      // Only a small result is kept, the loaded tile itself is released
+      DataContainer::Pointer result = DataContainer::New(dc->getName());
+      AttributeMatrix::Pointer am = AttributeMatrix::New({1}, "Result", AttributeMatrix::Type::Generic);
+      Int32ArrayType::Pointer sumArray = Int32ArrayType::CreateArray(1, QString("Sum"), true);
+      sumArray->setValue(0, sum);
+      am->insertOrAssign(sumArray);
+      result->addOrReplaceAttributeMatrix(am);
+      --inFlight;
+      return result;
+    };
+
+    AbstractMontage::CollectionType results;
+    int err = montage->executeTiles(task, results, options);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(loads.load(), 20)
+    DREAM3D_REQUIRE(maxInFlight.load() <= static_cast<int32_t>(maxConcurrentTiles))
+    DREAM3D_REQUIRE_EQUAL(results.size(), placeholders.size())
+    for(size_t tile = 0; tile < results.size(); tile++)
+    {
+      DREAM3D_REQUIRE_EQUAL(finished[tile], 1)
+      DREAM3D_REQUIRE_VALID_POINTER(results[tile].get())
+      DREAM3D_REQUIRE(results[tile]->getName() == placeholders[tile]->getName())
+      Int32ArrayType::Pointer sumArray = results[tile]->getAttributeMatrix("Result")->getAttributeArrayAs<Int32ArrayType>("Sum");
+      DREAM3D_REQUIRE_EQUAL(sumArray->getValue(0), static_cast<int32_t>(tile) * 10)
+    }
+
+    AbstractMontage::Pointer assembled = montage->assembleTiles(results);
+    DREAM3D_REQUIRE_VALID_POINTER(assembled.get())
+    AbstractMontage::CollectionType assembledTiles = assembled->getDataContainers();
+    for(size_t tile = 0; tile < results.size(); tile++)
+    {
+      DREAM3D_REQUIRE(assembledTiles[tile] == results[tile])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestErrors()
+  {
+    GridMontage::Pointer montage = CreateMontage(6, 6);
+    AbstractMontage::CollectionType results;
+
+    // A failing tile stops the remaining tiles from being started
+    std::atomic<int32_t> started = {0};
+    AbstractMontage::TileExecutionOptions options;
+    options.maxConcurrentTiles = 1;
+    int err = montage->executeTiles(
+        [&](size_t tile, const DataContainer::Pointer& dc, int& tileErr) {
+          started++;
+          tileErr = (tile == 4) ? -77 : 0;
+          return dc;
+        },
+        results, options);
+    DREAM3D_REQUIRE_EQUAL(err, -77)
+    DREAM3D_REQUIRE_EQUAL(started.load(), 5)
+    DREAM3D_REQUIRE(nullptr == results[4])
+    DREAM3D_REQUIRE(nullptr == results[5])
+    DREAM3D_REQUIRE_VALID_POINTER(results[3].get())
+
+    // A loader that returns nothing fails the tile
+    options.maxConcurrentTiles = 0;
+    options.loader = [](size_t tile, const DataContainer::Pointer& placeholder) { return (tile == 7) ? DataContainer::NullPointer() : placeholder; };
+    err = montage->executeTiles([](size_t, const DataContainer::Pointer& dc, int&) { return dc; }, results, options);
+    DREAM3D_REQUIRE_EQUAL(err, AbstractMontage::k_TileLoadError)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDREAM3DTileLoader()
+  {
+    GridMontage::Pointer montage = CreateMontage(2, 3);
+    AbstractMontage::CollectionType placeholders = montage->getDataContainers();
+
+    // Only the tiles are written, the montage holds empty placeholders with the same names
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    for(size_t tile = 0; tile < placeholders.size(); tile++)
+    {
+      DataContainer::Pointer dc = DataContainer::New(placeholders[tile]->getName());
+      AddTileData(dc, static_cast<int32_t>(tile + 1));
+      dca->addOrReplaceDataContainer(dc);
+    }
+    QDir().mkpath(UnitTest::GridMontageTileExecutorTest::TestDir);
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(UnitTest::GridMontageTileExecutorTest::TestFile);
+    writer->setWriteXdmfFile(false);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    std::atomic<int32_t> tilesInFile = {0};
+    AbstractMontage::TileExecutionOptions options;
+    options.loader = MontageSupport::IO::CreateDREAM3DTileLoader(UnitTest::GridMontageTileExecutorTest::TestFile);
+    AbstractMontage::TileTask task = [&](size_t tile, const DataContainer::Pointer& dc, int& err) {
+      // Every tile reads its own DataContainer and nothing else
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix("CellData");
+      Int32ArrayType::Pointer data = (nullptr != am) ? am->getAttributeArrayAs<Int32ArrayType>("Data") : Int32ArrayType::NullPointer();
+      if(nullptr == data || data->getNumberOfTuples() != 10 || data->getValue(1) != static_cast<int32_t>(tile + 1))
+      {
+        err = -1;
+        return DataContainer::NullPointer();
+      }
+      tilesInFile++;
+      return dc;
+    };
+
+    AbstractMontage::CollectionType results;
+    int err = montage->executeTiles(task, results, options);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(tilesInFile.load(), static_cast<int32_t>(placeholders.size()))
+    for(size_t tile = 0; tile < results.size(); tile++)
+    {
+      DREAM3D_REQUIRE_VALID_POINTER(results[tile].get())
+      DREAM3D_REQUIRE(results[tile]->getName() == placeholders[tile]->getName())
+      DREAM3D_REQUIRE(results[tile] != placeholders[tile])
+    }
+
+    // A tile that is not in the file fails to load
+    montage->setDataContainer(montage->getTileIndex(1, 2), DataContainer::New("NotInFile"));
+    err = montage->executeTiles(task, results, options);
+    DREAM3D_REQUIRE_EQUAL(err, AbstractMontage::k_TileLoadError)
+
+    // So does every tile of a file that does not exist
+    options.loader = MontageSupport::IO::CreateDREAM3DTileLoader(UnitTest::GridMontageTileExecutorTest::TestDir + "/DoesNotExist.dream3d");
+    err = montage->executeTiles(task, results, options);
+    DREAM3D_REQUIRE_EQUAL(err, AbstractMontage::k_TileLoadError)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineTileTask()
+  {
+    GridMontage::Pointer montage = CreateMontage(2, 2);
+    AbstractMontage::CollectionType tiles = montage->getDataContainers();
+    QStringList tileNames = montage->getDataContainerNames();
+    for(size_t tile = 0; tile < tiles.size(); tile++)
+    {
+      AddTileData(tiles[tile], static_cast<int32_t>(tile + 1));
+    }
+
+    // The pipeline is written against a single DataContainer named "Tile"
+    ReplaceValueInArray::Pointer replace = ReplaceValueInArray::New();
+    replace->setSelectedArray(DataArrayPath("Tile", "CellData", "Data"));
+    replace->setRemoveValue(0.0);
+    replace->setReplaceValue(-5.0);
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(replace);
+
+    AbstractMontage::TileExecutionOptions options;
+    AbstractMontage::CollectionType results;
+    int err = montage->executeTiles(MontageSupport::CreatePipelineTileTask(pipeline, "Tile"), results, options);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    for(size_t tile = 0; tile < results.size(); tile++)
+    {
+      DREAM3D_REQUIRE_VALID_POINTER(results[tile].get())
+      DREAM3D_REQUIRE(results[tile]->getName() == tileNames[static_cast<int>(tile)])
+      DREAM3D_REQUIRE(tiles[tile]->getName() == tileNames[static_cast<int>(tile)])
+      // The pipeline ran on a shallow copy, so the montage keeps its own DataContainer unparented
+      DREAM3D_REQUIRE(results[tile] != tiles[tile])
+      DREAM3D_REQUIRE(montage->getDataContainers()[tile] == tiles[tile])
+      DREAM3D_REQUIRE(nullptr == tiles[tile]->getParentNode())
+
+      Int32ArrayType::Pointer data = results[tile]->getAttributeMatrix("CellData")->getAttributeArrayAs<Int32ArrayType>("Data");
+      DREAM3D_REQUIRE_VALID_POINTER(data.get())
+      for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(data->getValue(i), (i % 2 == 0) ? -5 : static_cast<int32_t>(tile + 1))
+      }
+    }
+
+    // Without the name mapping the pipeline's path does not exist in any tile
+    err = montage->executeTiles(MontageSupport::CreatePipelineTileTask(pipeline), results, options);
+    DREAM3D_REQUIRE(err < 0)
+    DREAM3D_REQUIRE(nullptr == results[0])
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GridMontageTileExecutorTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestLazyExecution());
+    DREAM3D_REGISTER_TEST(TestErrors());
+    DREAM3D_REGISTER_TEST(TestDREAM3DTileLoader());
+    DREAM3D_REGISTER_TEST(TestPipelineTileTask());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  GridMontageTileExecutorTest(const GridMontageTileExecutorTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GridMontageTileExecutorTest&) = delete;              // Move assignment Not Implemented
+};
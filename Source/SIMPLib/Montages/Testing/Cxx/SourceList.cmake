@@ -1,4 +1,5 @@
 set(TEST_${SUBDIR_NAME}_NAMES
+  GridMontageTileExecutorTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
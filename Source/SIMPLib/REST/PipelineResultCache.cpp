@@ -0,0 +1,568 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineResultCache.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/PluginManager.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+std::unique_ptr<PipelineResultCache> PipelineResultCache::s_Instance;
+
+namespace
+{
+const QString k_ResponseFileName("response.json");
+const QString k_OutputsFileName("outputs.json");
+const QString k_TemporarySuffix(".tmp");
+const QString k_TrashDirName("Trash");
+
+// -----------------------------------------------------------------------------
+void addVersions(QCryptographicHash& hash)
+{
+  hash.addData(SIMPLib::Version::Complete().toUtf8());
+
+  QStringList pluginVersions;
+  for(ISIMPLibPlugin* plugin : PluginManager::Instance()->getPluginsVector())
+  {
+    pluginVersions.push_back(plugin->getPluginFileName() + "=" + plugin->getVersion());
+  }
+  std::sort(pluginVersions.begin(), pluginVersions.end());
+  hash.addData(pluginVersions.join(';').toUtf8());
+}
+
+// -----------------------------------------------------------------------------
+void addJson(QCryptographicHash& hash, const QJsonObject& obj)
+{
+  // QJsonObject keeps its keys sorted so the compact form is canonical
+  QByteArray json = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+  hash.addData(QByteArray::number(json.size()));
+  hash.addData(json);
+}
+
+// -----------------------------------------------------------------------------
+void addPathFingerprints(QCryptographicHash& hash, const QJsonValue& value)
+{
+  if(value.isObject())
+  {
+    QJsonObject obj = value.toObject();
+    for(auto iter = obj.constBegin(); iter != obj.constEnd(); ++iter)
+    {
+      addPathFingerprints(hash, iter.value());
+    }
+  }
+  else if(value.isArray())
+  {
+    for(const QJsonValue& element : value.toArray())
+    {
+      addPathFingerprints(hash, element);
+    }
+  }
+  else if(value.isString())
+  {
+    QString path = value.toString();
+    if(path.isEmpty() || !QDir::isAbsolutePath(path))
+    {
+      return;
+    }
+    QFileInfo fi(path);
+    if(fi.exists())
+    {
+      hash.addData(path.toUtf8());
+      hash.addData(QByteArray::number(fi.size()));
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+int64_t directorySize(const QString& path)
+{
+  int64_t size = 0;
+  for(const QFileInfo& fi : QDir(path).entryInfoList(QDir::Files))
+  {
+    size += fi.size();
+  }
+  return size;
+}
+} // namespace
+
+/**
+ * @brief The PipelineResultCacheTrash class keeps track of the cached files that are open for
+ * reading and defers deleting removed entries until their files are closed.  Deleting a
+ * directory with open files fails on Windows, and on any platform a response may still be
+ * sending them.  It is shared with the open files, so it outlives the cache if need be.
+ */
+class PipelineResultCacheTrash
+{
+public:
+  explicit PipelineResultCacheTrash(const QString& path)
+  : m_Path(path)
+  {
+  }
+
+  /**
+   * @brief Records that a file of the entry was opened for reading
+   * @param key
+   */
+  void acquire(const QByteArray& key)
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_ReaderCounts[key]++;
+  }
+
+  /**
+   * @brief Records that a file of the entry was closed and deletes what is no longer read
+   * @param key
+   */
+  void release(const QByteArray& key)
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(--m_ReaderCounts[key] <= 0)
+    {
+      m_ReaderCounts.remove(key);
+      sweep();
+    }
+  }
+
+  /**
+   * @brief Moves the directory of a removed entry into the trash, so its key can be cached
+   * again right away, and deletes it unless it is still being read.
+   * @param key
+   * @param entryPath
+   */
+  void discard(const QByteArray& key, const QString& entryPath)
+  {
+    QMutexLocker locker(&m_Mutex);
+    QString trashPath = QDir(m_Path).filePath(QString::fromUtf8(key) + "." + QString::fromLatin1(QUuid::createUuid().toRfc4122().toHex()));
+    // If the directory cannot be moved it is deleted in place later
+    bool moved = QDir().mkpath(m_Path) && QDir().rename(entryPath, trashPath);
+    m_Discarded.push_back({key, moved ? trashPath : entryPath});
+    sweep();
+  }
+
+  /**
+   * @brief Deletes whatever is in the trash directory.  Only used before any file is opened.
+   */
+  void empty()
+  {
+    QMutexLocker locker(&m_Mutex);
+    QDir(m_Path).removeRecursively();
+  }
+
+private:
+  QString m_Path;
+  QMutex m_Mutex;
+  QHash<QByteArray, int> m_ReaderCounts;
+  std::list<std::pair<QByteArray, QString>> m_Discarded;
+
+  void sweep()
+  {
+    for(auto iter = m_Discarded.begin(); iter != m_Discarded.end();)
+    {
+      // A failed delete is tried again on the next sweep
+      if(!m_ReaderCounts.contains(iter->first) && QDir(iter->second).removeRecursively())
+      {
+        iter = m_Discarded.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+};
+
+namespace
+{
+/**
+ * @brief The CachedFile class is a file of a cache entry that is registered as a reader of
+ * the entry for as long as it exists.
+ */
+class CachedFile : public QFile
+{
+public:
+  CachedFile(const QString& name, std::shared_ptr<PipelineResultCacheTrash> trash, const QByteArray& key)
+  : QFile(name)
+  , m_Trash(std::move(trash))
+  , m_Key(key)
+  {
+    m_Trash->acquire(m_Key);
+  }
+
+  ~CachedFile() override
+  {
+    close();
+    m_Trash->release(m_Key);
+  }
+
+  CachedFile(const CachedFile&) = delete;            // Copy Constructor Not Implemented
+  CachedFile(CachedFile&&) = delete;                 // Move Constructor Not Implemented
+  CachedFile& operator=(const CachedFile&) = delete; // Copy Assignment Not Implemented
+  CachedFile& operator=(CachedFile&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  std::shared_ptr<PipelineResultCacheTrash> m_Trash;
+  QByteArray m_Key;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache* PipelineResultCache::Instance()
+{
+  return s_Instance.get();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::CreateInstance(ServerSettings* settings)
+{
+  s_Instance.reset();
+  if(!settings->resultCacheEnabled)
+  {
+    return;
+  }
+
+  QString path = settings->resultCachePath;
+  // Convert relative path to absolute, based on the directory of the config file.
+  if(QDir::isRelativePath(path))
+  {
+    QFileInfo configFile(settings->configFileName);
+    path = QFileInfo(configFile.absolutePath(), path).absoluteFilePath();
+  }
+  s_Instance = std::unique_ptr<PipelineResultCache>(new PipelineResultCache(path, settings->resultCacheMaxDiskSize, settings->preflightCacheEntries));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::PipelineResultCache(const QString& path, int64_t maxDiskSize, int32_t preflightEntries)
+: m_Path(path)
+, m_MaxDiskSize(maxDiskSize)
+, m_PreflightResults(preflightEntries)
+, m_Trash(std::make_shared<PipelineResultCacheTrash>(QDir(path).filePath(k_TrashDirName)))
+{
+  QDir().mkpath(m_Path);
+  loadExistingEntries();
+  qDebug("PipelineResultCache: path=%s, entries=%i, disk usage=%lld bytes", qPrintable(m_Path), m_ExecuteEntries.size(), static_cast<long long>(m_DiskUsage));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::~PipelineResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineResultCache::CreateExecuteKey(const QJsonObject& pipelineObj, const QJsonObject& pipelineMetadataObj, const HttpRequest& request)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData("ExecutePipeline");
+  addVersions(hash);
+  addJson(hash, pipelineObj);
+  addJson(hash, pipelineMetadataObj);
+  addPathFingerprints(hash, pipelineObj);
+
+  QMultiMap<QByteArray, QByteArray> parameterMap = request.getParameterMap();
+  for(auto iter = parameterMap.constBegin(); iter != parameterMap.constEnd(); ++iter)
+  {
+    if(iter.key() == "Pipeline" || iter.key() == "PipelineMetadata")
+    {
+      continue;
+    }
+    hash.addData(iter.key());
+    hash.addData(QByteArray::number(iter.value().size()));
+    hash.addData(iter.value());
+
+    QTemporaryFile* uploadedFile = request.getUploadedFile(iter.key());
+    if(uploadedFile != nullptr)
+    {
+      uploadedFile->seek(0);
+      hash.addData(QByteArray::number(uploadedFile->size()));
+      hash.addData(uploadedFile);
+      uploadedFile->seek(0);
+    }
+  }
+
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineResultCache::CreatePreflightKey(const QJsonObject& pipelineObj)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData("PreflightPipeline");
+  addVersions(hash);
+  addJson(hash, pipelineObj);
+  addPathFingerprints(hash, pipelineObj);
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::findExecuteResult(const QByteArray& key, QJsonObject& responseObj, QStringList& outputNames, std::vector<std::unique_ptr<QFile>>& outputFiles)
+{
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_ExecuteEntries.find(key);
+  if(iter == m_ExecuteEntries.end())
+  {
+    return false;
+  }
+
+  QDir entryDir(entryPath(key));
+  QFile responseFile(entryDir.filePath(k_ResponseFileName));
+  QFile outputsFile(entryDir.filePath(k_OutputsFileName));
+  if(!responseFile.open(QFile::ReadOnly) || !outputsFile.open(QFile::ReadOnly))
+  {
+    removeEntry(key);
+    return false;
+  }
+  QJsonObject cachedResponse = QJsonDocument::fromJson(responseFile.readAll()).object();
+  QJsonArray cachedOutputs = QJsonDocument::fromJson(outputsFile.readAll()).array();
+
+  QStringList names;
+  std::vector<std::unique_ptr<QFile>> files;
+  for(int i = 0; i < cachedOutputs.size(); i++)
+  {
+    auto file = std::make_unique<CachedFile>(entryDir.filePath(QString("%1.dat").arg(i)), m_Trash, key);
+    if(!file->open(QFile::ReadOnly))
+    {
+      removeEntry(key);
+      return false;
+    }
+    names.push_back(cachedOutputs[i].toString());
+    files.push_back(std::move(file));
+  }
+
+  m_LruOrder.splice(m_LruOrder.begin(), m_LruOrder, iter->lruPosition);
+
+  responseObj = cachedResponse;
+  outputNames = names;
+  outputFiles = std::move(files);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::insertExecuteResult(const QByteArray& key, const QJsonObject& responseObj, const QStringList& outputNames, const QStringList& outputFilePaths)
+{
+  int64_t size = 0;
+  for(const QString& filePath : outputFilePaths)
+  {
+    size += QFileInfo(filePath).size();
+  }
+  if(size > m_MaxDiskSize || outputNames.size() != outputFilePaths.size())
+  {
+    return;
+  }
+
+  // Copy into a private directory first so that readers never see a partial entry
+  QString tempPath = entryPath(key) + "." + QString::fromLatin1(QUuid::createUuid().toRfc4122().toHex()) + k_TemporarySuffix;
+  QDir tempDir(tempPath);
+  bool success = QDir().mkpath(tempPath);
+
+  QFile responseFile(tempDir.filePath(k_ResponseFileName));
+  success = success && responseFile.open(QFile::WriteOnly) && responseFile.write(QJsonDocument(responseObj).toJson(QJsonDocument::Compact)) >= 0;
+  responseFile.close();
+
+  QFile outputsFile(tempDir.filePath(k_OutputsFileName));
+  success = success && outputsFile.open(QFile::WriteOnly) && outputsFile.write(QJsonDocument(QJsonArray::fromStringList(outputNames)).toJson(QJsonDocument::Compact)) >= 0;
+  outputsFile.close();
+
+  for(int i = 0; i < outputFilePaths.size() && success; i++)
+  {
+    success = QFile::copy(outputFilePaths[i], tempDir.filePath(QString("%1.dat").arg(i)));
+  }
+
+  QMutexLocker locker(&m_Mutex);
+  if(!success || m_ExecuteEntries.contains(key) || !QDir().rename(tempPath, entryPath(key)))
+  {
+    tempDir.removeRecursively();
+    return;
+  }
+
+  size = directorySize(entryPath(key));
+  m_LruOrder.push_front(key);
+  Entry entry;
+  entry.size = size;
+  entry.lruPosition = m_LruOrder.begin();
+  m_ExecuteEntries.insert(key, entry);
+  m_DiskUsage += size;
+
+  evict();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::findPreflightResult(const QByteArray& key, QJsonObject& responseObj)
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonObject* cachedResponse = m_PreflightResults.object(key);
+  if(cachedResponse == nullptr)
+  {
+    return false;
+  }
+  responseObj = *cachedResponse;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::insertPreflightResult(const QByteArray& key, const QJsonObject& responseObj)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_PreflightResults.insert(key, new QJsonObject(responseObj));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::invalidate(const QByteArray& key)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_ExecuteEntries.contains(key))
+  {
+    removeEntry(key);
+  }
+  m_PreflightResults.remove(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  while(!m_LruOrder.empty())
+  {
+    removeEntry(m_LruOrder.back());
+  }
+  m_PreflightResults.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineResultCache::getDiskUsage() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_DiskUsage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::loadExistingEntries()
+{
+  // Newest entries first, which is the order of the LRU list
+  // Nothing is being read yet, so removed entries of an earlier run can go
+  m_Trash->empty();
+  QFileInfoList entryInfos = QDir(m_Path).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Time);
+  for(const QFileInfo& fi : entryInfos)
+  {
+    if(fi.fileName() == k_TrashDirName)
+    {
+      continue;
+    }
+    if(fi.fileName().endsWith(k_TemporarySuffix))
+    {
+      // Left over from an interrupted insert
+      QDir(fi.absoluteFilePath()).removeRecursively();
+      continue;
+    }
+
+    QByteArray key = fi.fileName().toUtf8();
+    int64_t size = directorySize(fi.absoluteFilePath());
+    m_LruOrder.push_back(key);
+    Entry entry;
+    entry.size = size;
+    entry.lruPosition = std::prev(m_LruOrder.end());
+    m_ExecuteEntries.insert(key, entry);
+    m_DiskUsage += size;
+  }
+
+  evict();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::removeEntry(QByteArray key)
+{
+  auto iter = m_ExecuteEntries.find(key);
+  if(iter == m_ExecuteEntries.end())
+  {
+    return;
+  }
+  m_DiskUsage -= iter->size;
+  m_LruOrder.erase(iter->lruPosition);
+  m_ExecuteEntries.erase(iter);
+
+  m_Trash->discard(key, entryPath(key));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::evict()
+{
+  while(m_DiskUsage > m_MaxDiskSize && !m_LruOrder.empty())
+  {
+    removeEntry(m_LruOrder.back());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::entryPath(const QByteArray& key) const
+{
+  return QDir(m_Path).filePath(QString::fromUtf8(key));
+}
@@ -0,0 +1,200 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QStringList>
+
+#include "QtWebApp/httpserver/ServerSettings.h"
+#include "QtWebApp/httpserver/httprequest.h"
+
+#include "SIMPLib/SIMPLib.h"
+
+class PipelineResultCacheTrash;
+
+/**
+ * @brief The PipelineResultCache class stores the results of REST pipeline requests keyed by
+ * a content hash so that resubmitting an identical request is answered without running the
+ * pipeline again.
+ *
+ * Execute results (the JSON response and every output file) are kept on disk below the
+ * configured cache path and evicted least recently used first once the disk budget is
+ * exceeded.  Preflight results are small and memoised in memory only.  A removed entry is
+ * moved into a trash directory and only deleted once no response is reading its files
+ * anymore.
+ *
+ * Every key includes the SIMPLib version and the file name and version of each loaded plugin,
+ * so upgrading the server never serves stale results.
+ *
+ * Caching is opt-in. The following settings are read from the [resultCache] group of the config file:
+ * <code><pre>
+ * enabled=false
+ * path=ResultCache
+ * maxDiskSize=10737418240
+ * preflightEntries=256
+ * </pre></code>
+ */
+class SIMPLib_EXPORT PipelineResultCache
+{
+public:
+  /**
+   * @brief Returns the server wide instance or nullptr if caching is disabled.
+   * @return
+   */
+  static PipelineResultCache* Instance();
+
+  /**
+   * @brief Creates the server wide instance from the settings.  No instance is created
+   * if the cache is disabled in the settings.
+   * @param settings
+   */
+  static void CreateInstance(ServerSettings* settings);
+
+  ~PipelineResultCache();
+
+  /**
+   * @brief Returns the key of a multipart ExecutePipeline request.  The key covers the
+   * pipeline, its metadata and the content of every other request parameter, including
+   * parameters the request spooled to disk.  Like the preflight key it also covers the size
+   * and modification time of every existing absolute path in the pipeline, since a pipeline
+   * may read server side files that are not part of the request.
+   * @param pipelineObj
+   * @param pipelineMetadataObj
+   * @param request
+   * @return
+   */
+  static QByteArray CreateExecuteKey(const QJsonObject& pipelineObj, const QJsonObject& pipelineMetadataObj, const HttpRequest& request);
+
+  /**
+   * @brief Returns the key of a PreflightPipeline request.  Preflight reads the files the
+   * pipeline refers to, so the size and modification time of every existing absolute path
+   * in the pipeline is part of the key.
+   * @param pipelineObj
+   * @return
+   */
+  static QByteArray CreatePreflightKey(const QJsonObject& pipelineObj);
+
+  /**
+   * @brief Looks up a cached execute result.  On success the output files are returned
+   * already opened for reading so the entry can be evicted while it is being sent; its
+   * files are deleted once the returned files are destroyed.
+   * @param key
+   * @param responseObj
+   * @param outputNames
+   * @param outputFiles
+   * @return
+   */
+  bool findExecuteResult(const QByteArray& key, QJsonObject& responseObj, QStringList& outputNames, std::vector<std::unique_ptr<QFile>>& outputFiles);
+
+  /**
+   * @brief Copies an execute result into the cache and evicts older entries until the disk
+   * budget is met again.  Results larger than the whole budget are not cached.
+   * @param key
+   * @param responseObj
+   * @param outputNames
+   * @param outputFilePaths
+   */
+  void insertExecuteResult(const QByteArray& key, const QJsonObject& responseObj, const QStringList& outputNames, const QStringList& outputFilePaths);
+
+  /**
+   * @brief Looks up a memoised preflight result.
+   * @param key
+   * @param responseObj
+   * @return
+   */
+  bool findPreflightResult(const QByteArray& key, QJsonObject& responseObj);
+
+  /**
+   * @brief Memoises a preflight result.
+   * @param key
+   * @param responseObj
+   */
+  void insertPreflightResult(const QByteArray& key, const QJsonObject& responseObj);
+
+  /**
+   * @brief Removes the entries stored under the key from both caches.
+   * @param key
+   */
+  void invalidate(const QByteArray& key);
+
+  /**
+   * @brief Removes every entry from both caches.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of bytes the execute results currently occupy on disk.
+   * @return
+   */
+  int64_t getDiskUsage() const;
+
+protected:
+  PipelineResultCache(const QString& path, int64_t maxDiskSize, int32_t preflightEntries);
+
+public:
+  PipelineResultCache(const PipelineResultCache&) = delete;            // Copy Constructor Not Implemented
+  PipelineResultCache(PipelineResultCache&&) = delete;                 // Move Constructor Not Implemented
+  PipelineResultCache& operator=(const PipelineResultCache&) = delete; // Copy Assignment Not Implemented
+  PipelineResultCache& operator=(PipelineResultCache&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  struct Entry
+  {
+    int64_t size = 0;
+    std::list<QByteArray>::iterator lruPosition;
+  };
+
+  static std::unique_ptr<PipelineResultCache> s_Instance;
+
+  QString m_Path;
+  int64_t m_MaxDiskSize = 0;
+  int64_t m_DiskUsage = 0;
+
+  mutable QMutex m_Mutex;
+  std::list<QByteArray> m_LruOrder; // Most recently used first
+  QHash<QByteArray, Entry> m_ExecuteEntries;
+  QCache<QByteArray, QJsonObject> m_PreflightResults;
+  std::shared_ptr<PipelineResultCacheTrash> m_Trash;
+
+  void loadExistingEntries();
+  void removeEntry(QByteArray key); // By value, callers pass elements of m_LruOrder
+  void evict();
+  QString entryPath(const QByteArray& key) const;
+};
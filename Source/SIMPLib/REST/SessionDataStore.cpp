@@ -0,0 +1,369 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SessionDataStore.h"
+
+#include <iterator>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSet>
+#include <QtCore/QStringList>
+
+#include "QtWebApp/httpserver/httpsessionstore.h"
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Montages/AbstractMontage.h"
+
+std::unique_ptr<SessionDataStore> SessionDataStore::s_Instance;
+
+namespace
+{
+const QString k_ReaderFilterName("DataContainerReader");
+
+/**
+ * @brief Names of every attribute matrix and array of a snapshot mapped to the data containers
+ * that hold one with that name
+ */
+struct Names
+{
+  QSet<QString> dataContainers;
+  QHash<QString, QSet<QString>> containersByChildName;
+};
+
+// -----------------------------------------------------------------------------
+void collectReferences(const QJsonValue& value, const Names& names, QSet<QString>& containers)
+{
+  if(value.isObject())
+  {
+    QJsonObject obj = value.toObject();
+    // DataArrayPath::writeJson() and the comparison inputs of the threshold filters
+    if(obj.contains("Data Container Name"))
+    {
+      containers.insert(obj["Data Container Name"].toString());
+    }
+    for(auto iter = obj.constBegin(); iter != obj.constEnd(); ++iter)
+    {
+      collectReferences(iter.value(), names, containers);
+    }
+  }
+  else if(value.isArray())
+  {
+    for(const QJsonValue& element : value.toArray())
+    {
+      collectReferences(element, names, containers);
+    }
+  }
+  else if(value.isString())
+  {
+    QString str = value.toString();
+    QStringList tokens = str.split('|');
+    if(tokens.size() == 2 || tokens.size() == 3)
+    {
+      containers.insert(tokens[0]);
+      return;
+    }
+    // Some filters name existing data with plain strings, match those against the snapshot
+    if(names.dataContainers.contains(str))
+    {
+      containers.insert(str);
+    }
+    containers.unite(names.containersByChildName.value(str));
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SessionDataStore* SessionDataStore::Instance()
+{
+  return s_Instance.get();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SessionDataStore::CreateInstance(ServerSettings* settings, HttpSessionStore* sessionStore)
+{
+  s_Instance.reset();
+  if(!settings->sessionDataEnabled)
+  {
+    return;
+  }
+
+  s_Instance = std::unique_ptr<SessionDataStore>(new SessionDataStore(settings->sessionDataMaxMemory));
+
+  QObject::connect(sessionStore, &HttpSessionStore::sessionRemoved, [](const QByteArray& id) {
+    SessionDataStore* store = SessionDataStore::Instance();
+    if(store != nullptr)
+    {
+      store->removeSession(id);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SessionDataStore::SessionDataStore(int64_t maxMemory)
+: m_MaxMemory(maxMemory)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SessionDataStore::~SessionDataStore() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray SessionDataStore::CreateKey(const QJsonObject& readerObj)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(QJsonDocument(readerObj).toJson(QJsonDocument::Compact));
+
+  QFileInfo fi(readerObj["InputFile"].toString());
+  hash.addData(fi.absoluteFilePath().toUtf8());
+  hash.addData(QByteArray::number(fi.size()));
+  hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer SessionDataStore::CreateView(const DataContainerArray& snapshot, const QJsonObject& pipelineObj)
+{
+  const DataContainerArray::Container dcs = snapshot.getDataContainers();
+
+  Names names;
+  for(const auto& dc : dcs)
+  {
+    names.dataContainers.insert(dc->getName());
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      names.containersByChildName[am->getName()].insert(dc->getName());
+      for(const auto& array : am->getChildren())
+      {
+        names.containersByChildName[array->getName()].insert(dc->getName());
+      }
+    }
+  }
+
+  // The reader's proxy lists everything it read, which says nothing about what the pipeline touches
+  QSet<QString> referenced;
+  for(auto iter = pipelineObj.constBegin(); iter != pipelineObj.constEnd(); ++iter)
+  {
+    QJsonObject filterObj = iter.value().toObject();
+    if(filterObj["Filter_Name"].toString() != k_ReaderFilterName)
+    {
+      collectReferences(filterObj, names, referenced);
+    }
+  }
+
+  DataContainerArray::Pointer view = DataContainerArray::New();
+  for(const auto& dc : dcs)
+  {
+    const QString& dcName = dc->getName();
+    DataContainer::Pointer dcView = DataContainer::New(dcName);
+
+    // Filters write to more than the paths they declare: arrays next to their inputs, feature
+    // attribute matrices of the same container and the geometry's lazily built connectivity.
+    // Every container the pipeline reaches is therefore copied as a whole.
+    const bool copy = referenced.contains(dcName);
+
+    IGeometry::Pointer geom = dc->getGeometry();
+    if(geom.get() != nullptr)
+    {
+      dcView->setGeometry(copy ? geom->deepCopy() : geom);
+    }
+
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      AttributeMatrix::Pointer amView = AttributeMatrix::New(am->getTupleDimensions(), am->getName(), am->getType());
+      for(const auto& array : am->getChildren())
+      {
+        if(copy)
+        {
+          amView->insertOrAssign(array->deepCopy());
+        }
+        else
+        {
+          // Shared arrays stay children of the snapshot, which may be iterated by other views
+          amView->insertOrAssignShared(array);
+        }
+      }
+      dcView->insertOrAssign(amView);
+    }
+    view->insertOrAssign(dcView);
+  }
+
+  for(const auto& montage : snapshot.getMontageCollection())
+  {
+    view->addMontage(montage->propagate(view));
+  }
+
+  return view;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t SessionDataStore::EstimateMemory(const DataContainerArray& dca)
+{
+  int64_t size = 0;
+  for(const auto& dc : dca.getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : am->getChildren())
+      {
+        size += static_cast<int64_t>(array->getSize() * array->getTypeSize());
+      }
+    }
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray SessionDataStore::IndexKey(const QByteArray& sessionId, const QByteArray& key)
+{
+  return sessionId + '/' + key;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer SessionDataStore::findSnapshot(const QByteArray& sessionId, const QByteArray& key)
+{
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_Index.find(IndexKey(sessionId, key));
+  if(iter == m_Index.end())
+  {
+    return DataContainerArray::NullPointer();
+  }
+
+  m_Snapshots.splice(m_Snapshots.begin(), m_Snapshots, iter.value());
+  return iter.value()->dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SessionDataStore::insertSnapshot(const QByteArray& sessionId, const QByteArray& key, const DataContainerArray::Pointer& dca)
+{
+  int64_t size = EstimateMemory(*dca);
+  if(size > m_MaxMemory)
+  {
+    return false;
+  }
+
+  QMutexLocker locker(&m_Mutex);
+  QByteArray indexKey = IndexKey(sessionId, key);
+  auto existing = m_Index.find(indexKey);
+  if(existing != m_Index.end())
+  {
+    removeSnapshot(existing.value());
+  }
+
+  Snapshot snapshot;
+  snapshot.sessionId = sessionId;
+  snapshot.key = key;
+  snapshot.dca = dca;
+  snapshot.size = size;
+  m_Snapshots.push_front(snapshot);
+  m_Index.insert(indexKey, m_Snapshots.begin());
+  m_MemoryUsage += size;
+
+  // Executions still holding a view keep the shared arrays alive until they finish
+  while(m_MemoryUsage > m_MaxMemory && m_Snapshots.size() > 1)
+  {
+    removeSnapshot(std::prev(m_Snapshots.end()));
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SessionDataStore::removeSession(const QByteArray& sessionId)
+{
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_Snapshots.begin();
+  while(iter != m_Snapshots.end())
+  {
+    auto next = std::next(iter);
+    if(iter->sessionId == sessionId)
+    {
+      removeSnapshot(iter);
+    }
+    iter = next;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SessionDataStore::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Index.clear();
+  m_Snapshots.clear();
+  m_MemoryUsage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t SessionDataStore::getMemoryUsage() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MemoryUsage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SessionDataStore::removeSnapshot(SnapshotList::iterator iter)
+{
+  m_MemoryUsage -= iter->size;
+  m_Index.remove(IndexKey(iter->sessionId, iter->key));
+  m_Snapshots.erase(iter);
+}
@@ -0,0 +1,184 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "QtWebApp/httpserver/ServerSettings.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+class HttpSessionStore;
+
+/**
+ * @brief The SessionDataStore class keeps the DataContainerArray read by the leading
+ * DataContainerReader of a REST pipeline resident for the session that read it.  A later
+ * pipeline from the same session that starts with an identical reader runs against a view
+ * of the resident data instead of reading the file again.
+ *
+ * Resident snapshots are never handed to a filter.  Each execution gets its own view from
+ * CreateView() in which every container is a new object, so adding, removing or renaming
+ * data never reaches the snapshot.  Filters modify arrays and geometries in place, so every
+ * data container the pipeline refers to is deep copied into the view; only the arrays of data
+ * containers the pipeline never names are shared.  Shared arrays are listed by the view without
+ * being moved out of the snapshot, which remains their parent.
+ *
+ * Snapshots are dropped when their session is removed from the HttpSessionStore and are
+ * evicted least recently used first, across all sessions, once the memory budget is exceeded.
+ *
+ * The following settings are read from the [sessionData] group of the config file:
+ * <code><pre>
+ * enabled=true
+ * maxMemory=4294967296
+ * </pre></code>
+ */
+class SIMPLib_EXPORT SessionDataStore
+{
+public:
+  /**
+   * @brief Returns the server wide instance or nullptr if session data is disabled.
+   * @return
+   */
+  static SessionDataStore* Instance();
+
+  /**
+   * @brief Creates the server wide instance from the settings and releases the data of every
+   * session the session store removes.  No instance is created if session data is disabled
+   * in the settings.
+   * @param settings
+   * @param sessionStore
+   */
+  static void CreateInstance(ServerSettings* settings, HttpSessionStore* sessionStore);
+
+  ~SessionDataStore();
+
+  /**
+   * @brief Returns the key of the data read by a DataContainerReader.  The key covers the
+   * reader's parameters and the size and modification time of its input file.
+   * @param readerObj JSON object of the reader filter
+   * @return
+   */
+  static QByteArray CreateKey(const QJsonObject& readerObj);
+
+  /**
+   * @brief Creates a DataContainerArray for one execution of the pipeline from a resident
+   * snapshot.  Every data container that holds data named anywhere in the pipeline's parameters
+   * is deep copied, including its geometry; the other data containers share their arrays and
+   * geometry with the snapshot without taking them over.
+   * @param snapshot
+   * @param pipelineObj
+   * @return
+   */
+  static DataContainerArray::Pointer CreateView(const DataContainerArray& snapshot, const QJsonObject& pipelineObj);
+
+  /**
+   * @brief Returns the estimated number of bytes held by the attribute arrays of the
+   * DataContainerArray.
+   * @param dca
+   * @return
+   */
+  static int64_t EstimateMemory(const DataContainerArray& dca);
+
+  /**
+   * @brief Returns the resident snapshot of the session stored under the key, or nullptr.
+   * The returned snapshot must not be modified, use CreateView() to execute against it.
+   * @param sessionId
+   * @param key
+   * @return
+   */
+  DataContainerArray::Pointer findSnapshot(const QByteArray& sessionId, const QByteArray& key);
+
+  /**
+   * @brief Makes the DataContainerArray a resident snapshot of the session and evicts older
+   * snapshots until the memory budget is met again.  The caller must not modify the
+   * DataContainerArray afterwards.
+   * @param sessionId
+   * @param key
+   * @param dca
+   * @return False if the data is larger than the whole budget and was not stored
+   */
+  bool insertSnapshot(const QByteArray& sessionId, const QByteArray& key, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Releases every snapshot of the session.
+   * @param sessionId
+   */
+  void removeSession(const QByteArray& sessionId);
+
+  /**
+   * @brief Releases every snapshot.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the estimated number of bytes held by all resident snapshots.
+   * @return
+   */
+  int64_t getMemoryUsage() const;
+
+protected:
+  explicit SessionDataStore(int64_t maxMemory);
+
+public:
+  SessionDataStore(const SessionDataStore&) = delete;            // Copy Constructor Not Implemented
+  SessionDataStore(SessionDataStore&&) = delete;                 // Move Constructor Not Implemented
+  SessionDataStore& operator=(const SessionDataStore&) = delete; // Copy Assignment Not Implemented
+  SessionDataStore& operator=(SessionDataStore&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  struct Snapshot
+  {
+    QByteArray sessionId;
+    QByteArray key;
+    DataContainerArray::Pointer dca;
+    int64_t size = 0;
+  };
+  using SnapshotList = std::list<Snapshot>;
+
+  static std::unique_ptr<SessionDataStore> s_Instance;
+
+  int64_t m_MaxMemory = 0;
+  int64_t m_MemoryUsage = 0;
+
+  mutable QMutex m_Mutex;
+  SnapshotList m_Snapshots; // Most recently used first
+  QHash<QByteArray, SnapshotList::iterator> m_Index;
+
+  static QByteArray IndexKey(const QByteArray& sessionId, const QByteArray& key);
+  void removeSnapshot(SnapshotList::iterator iter);
+};
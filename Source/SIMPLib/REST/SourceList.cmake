@@ -20,6 +20,7 @@ set(SIMPLib_${SUBDIR_NAME}_Moc_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/InvalidateResultCacheController.h
 )
 
 # --------------------------------------------------------------------
@@ -30,6 +31,8 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListenerMessageHandler.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SessionDataStore.h
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ExecutePipelineMessageHandler.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PreflightPipelineMessageHandler.h
@@ -40,6 +43,8 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLRequestMapper.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListener.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListenerMessageHandler.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SessionDataStore.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDirectoryListing.cpp
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/NumFiltersController.cpp
@@ -56,6 +61,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/InvalidateResultCacheController.cpp
 
 )
 
@@ -0,0 +1,146 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonObject>
+
+#include "QtWebApp/httpserver/ServerSettings.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/REST/PipelineResultCache.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PipelineResultCacheTest
+{
+public:
+  PipelineResultCacheTest() = default;
+  virtual ~PipelineResultCacheTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString cachePath()
+  {
+    return UnitTest::PipelineResultCacheTest::TestDir + "/Cache";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir(UnitTest::PipelineResultCacheTest::TestDir).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int trashEntryCount()
+  {
+    return QDir(cachePath() + "/Trash").entryList(QDir::Dirs | QDir::NoDotAndDotDot).size();
+  }
+
+  // -----------------------------------------------------------------------------
+  // An entry that is invalidated while its files are being sent stays readable and is deleted once they are closed
+  // -----------------------------------------------------------------------------
+  void TestRemoveWhileReading()
+  {
+    QDir(UnitTest::PipelineResultCacheTest::TestDir).removeRecursively();
+    DREAM3D_REQUIRE(QDir().mkpath(UnitTest::PipelineResultCacheTest::TestDir))
+    QString outputPath = UnitTest::PipelineResultCacheTest::TestDir + "/Output.txt";
+    QFile outputFile(outputPath);
+    DREAM3D_REQUIRE(outputFile.open(QFile::WriteOnly))
+    outputFile.write("Result");
+    outputFile.close();
+
+    ServerSettings settings;
+    settings.resultCacheEnabled = true;
+    settings.resultCachePath = cachePath();
+    PipelineResultCache::CreateInstance(&settings);
+    PipelineResultCache* cache = PipelineResultCache::Instance();
+    DREAM3D_REQUIRE_VALID_POINTER(cache)
+
+    QByteArray key("Key");
+    QJsonObject responseObj;
+    responseObj["Completed"] = true;
+    cache->insertExecuteResult(key, responseObj, {"Output.txt"}, {outputPath});
+
+    QJsonObject cachedResponseObj;
+    QStringList outputNames;
+    std::vector<std::unique_ptr<QFile>> outputFiles;
+    DREAM3D_REQUIRE(cache->findExecuteResult(key, cachedResponseObj, outputNames, outputFiles))
+    DREAM3D_REQUIRE_EQUAL(outputFiles.size(), 1)
+
+    cache->invalidate(key);
+    DREAM3D_REQUIRE(!QFileInfo::exists(cachePath() + "/" + QString::fromLatin1(key)))
+    DREAM3D_REQUIRE_EQUAL(trashEntryCount(), 1)
+    DREAM3D_REQUIRE(outputFiles[0]->readAll() == "Result")
+
+    // The key is free to be cached again while the old entry is still being read
+    cache->insertExecuteResult(key, responseObj, {"Output.txt"}, {outputPath});
+    std::vector<std::unique_ptr<QFile>> newOutputFiles;
+    DREAM3D_REQUIRE(cache->findExecuteResult(key, cachedResponseObj, outputNames, newOutputFiles))
+
+    outputFiles.clear();
+    DREAM3D_REQUIRE_EQUAL(trashEntryCount(), 0)
+
+    // Files of a removed entry may outlive the cache
+    cache->clear();
+    ServerSettings disabledSettings;
+    PipelineResultCache::CreateInstance(&disabledSettings);
+    DREAM3D_REQUIRE(PipelineResultCache::Instance() == nullptr)
+    newOutputFiles.clear();
+    DREAM3D_REQUIRE_EQUAL(trashEntryCount(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineResultCacheTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRemoveWhileReading())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  PipelineResultCacheTest(const PipelineResultCacheTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineResultCacheTest&);          // Move assignment Not Implemented
+};
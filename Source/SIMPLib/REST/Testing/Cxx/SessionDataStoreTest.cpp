@@ -0,0 +1,160 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/REST/SessionDataStore.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class SessionDataStoreTest
+{
+  const size_t k_NumTuples = 10;
+
+public:
+  SessionDataStoreTest() = default;
+  virtual ~SessionDataStoreTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void addContainer(DataContainerArray& dca, const QString& dcName)
+  {
+    DataContainer::Pointer dc = DataContainer::New(dcName);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({k_NumTuples}, "CellData", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumTuples, "FeatureIds", true);
+    featureIds->initializeWithZeros();
+    am->insertOrAssign(featureIds);
+    FloatArrayType::Pointer confidence = FloatArrayType::CreateArray(k_NumTuples, "Confidence", true);
+    confidence->initializeWithZeros();
+    am->insertOrAssign(confidence);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca.addOrReplaceDataContainer(dc);
+  }
+
+  // -----------------------------------------------------------------------------
+  // A filter naming only FeatureIds may still write Confidence, as FillBadData does with copyTuple
+  // -----------------------------------------------------------------------------
+  void TestViewCopiesReferencedContainers()
+  {
+    DataContainerArray::Pointer snapshot = DataContainerArray::New();
+    addContainer(*snapshot, "Used");
+    addContainer(*snapshot, "Unused");
+
+    QJsonObject pathObj;
+    pathObj["Data Container Name"] = "Used";
+    pathObj["Attribute Matrix Name"] = "CellData";
+    pathObj["Data Array Name"] = "FeatureIds";
+    QJsonObject filterObj;
+    filterObj["Filter_Name"] = "FillBadData";
+    filterObj["FeatureIdsArrayPath"] = pathObj;
+    QJsonObject pipelineObj;
+    pipelineObj["1"] = filterObj;
+
+    DataContainerArray::Pointer view = SessionDataStore::CreateView(*snapshot, pipelineObj);
+
+    for(const QString& name : {QString("FeatureIds"), QString("Confidence")})
+    {
+      DataArrayPath usedPath("Used", "CellData", name);
+      DREAM3D_REQUIRE(view->getAttributeMatrix(usedPath)->getAttributeArray(name) != snapshot->getAttributeMatrix(usedPath)->getAttributeArray(name))
+
+      DataArrayPath unusedPath("Unused", "CellData", name);
+      DREAM3D_REQUIRE(view->getAttributeMatrix(unusedPath)->getAttributeArray(name) == snapshot->getAttributeMatrix(unusedPath)->getAttributeArray(name))
+    }
+
+    FloatArrayType::Pointer confidence = view->getAttributeMatrix(DataArrayPath("Used", "CellData", ""))->getAttributeArrayAs<FloatArrayType>("Confidence");
+    confidence->initializeWithValue(1.0f);
+    FloatArrayType::Pointer original = snapshot->getAttributeMatrix(DataArrayPath("Used", "CellData", ""))->getAttributeArrayAs<FloatArrayType>("Confidence");
+    DREAM3D_REQUIRE_EQUAL(original->getValue(0), 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  // Views list the shared arrays without taking them over, so the snapshot can back any number of them
+  // -----------------------------------------------------------------------------
+  void TestViewsLeaveSnapshotUnchanged()
+  {
+    DataContainerArray::Pointer snapshot = DataContainerArray::New();
+    addContainer(*snapshot, "Unused");
+    AttributeMatrix::Pointer am = snapshot->getAttributeMatrix(DataArrayPath("Unused", "CellData", ""));
+    const auto arrays = am->getChildren();
+
+    DataContainerArray::Pointer first = SessionDataStore::CreateView(*snapshot, QJsonObject());
+    DataContainerArray::Pointer second = SessionDataStore::CreateView(*snapshot, QJsonObject());
+
+    auto requireSnapshotUnchanged = [&]() {
+      DREAM3D_REQUIRE(am->getChildren() == arrays)
+      for(const auto& array : arrays)
+      {
+        DREAM3D_REQUIRE(array->getParentNode() == am.get())
+        DREAM3D_REQUIRE(am->getAttributeArray(array->getName()) == array)
+      }
+    };
+
+    requireSnapshotUnchanged();
+    for(const auto& view : {first, second})
+    {
+      AttributeMatrix::Pointer amView = view->getAttributeMatrix(DataArrayPath("Unused", "CellData", ""));
+      DREAM3D_REQUIRE_VALID_POINTER(amView.get())
+      DREAM3D_REQUIRE(amView != am)
+      DREAM3D_REQUIRE(amView->getChildren() == arrays)
+    }
+
+    first->getAttributeMatrix(DataArrayPath("Unused", "CellData", ""))->removeAttributeArray("Confidence");
+    first = DataContainerArray::NullPointer();
+    requireSnapshotUnchanged();
+
+    second->removeDataContainer("Unused");
+    second = DataContainerArray::NullPointer();
+    requireSnapshotUnchanged();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SessionDataStoreTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestViewCopiesReferencedContainers())
+    DREAM3D_REGISTER_TEST(TestViewsLeaveSnapshotUnchanged())
+  }
+
+private:
+  SessionDataStoreTest(const SessionDataStoreTest&); // Copy Constructor Not Implemented
+  void operator=(const SessionDataStoreTest&);       // Move assignment Not Implemented
+};
@@ -2,7 +2,9 @@
 set(TEST_TESTFILES_DIR ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx/TestFiles)
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  PipelineResultCacheTest
   RESTUnitTest
+  SessionDataStoreTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
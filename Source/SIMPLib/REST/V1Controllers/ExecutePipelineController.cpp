@@ -31,6 +31,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ExecutePipelineController.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QJsonArray>
@@ -52,6 +56,8 @@
 #include "QtWebApp/httpserver/httpsessionstore.h"
 #include "SIMPLStaticFileController.h"
 #include "SIMPLib/REST/PipelineListener.h"
+#include "SIMPLib/REST/PipelineResultCache.h"
+#include "SIMPLib/REST/SessionDataStore.h"
 #include "SIMPLib/REST/V1Controllers/ExecutePipelineMessageHandler.h"
 
 // -----------------------------------------------------------------------------
@@ -71,7 +77,7 @@ ExecutePipelineController::~ExecutePipelineController()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
+void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj, bool useSessionData)
 {
   FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(pipelineObj);
   if(pipeline.get() == nullptr)
@@ -186,8 +192,17 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
 
   if(listener.getErrorMessages().size() <= 0)
   {
-    qDebug() << "Pipeline About to Execute....";
-    pipeline->execute();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    if(useSessionData)
+    {
+      dca = prepareSessionData(pipeline.get(), pipelineObj, {&obs, &listener});
+    }
+
+    if(dca.get() != nullptr)
+    {
+      qDebug() << "Pipeline About to Execute....";
+      pipeline->execute(dca);
+    }
 
     qDebug() << "Pipeline Done Executing...." << pipeline->getErrorCode();
   }
@@ -233,6 +248,68 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
   //  m_ResponseObj[SIMPL::JSON::OutputLinks] = outputLinks;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer ExecutePipelineController::prepareSessionData(FilterPipeline* pipeline, const QJsonObject& pipelineObj, const std::vector<QObject*>& receivers)
+{
+  SessionDataStore* store = SessionDataStore::Instance();
+  if(store == nullptr || pipeline->empty())
+  {
+    return DataContainerArray::New();
+  }
+
+  AbstractFilter::Pointer reader = pipeline->getFilterContainer().front();
+  if(!reader->getEnabled() || reader->getNameOfClass() != "DataContainerReader")
+  {
+    return DataContainerArray::New();
+  }
+
+  QByteArray sessionId = m_ResponseObj[SIMPL::JSON::SessionID].toString().toLatin1();
+  const QString readerKey = QString::number(reader->getPipelineIndex());
+  QJsonObject readerObj = pipelineObj[readerKey].toObject();
+  QByteArray key = SessionDataStore::CreateKey(readerObj);
+
+  // The reader is replaced by the resident data whether or not that still has to be read
+  pipeline->popFront();
+
+  DataContainerArray::Pointer snapshot;
+  if(!m_Request->getHeader("Cache-Control").contains("no-cache"))
+  {
+    snapshot = store->findSnapshot(sessionId, key);
+  }
+
+  if(snapshot.get() != nullptr)
+  {
+    m_Response->setHeader("X-SIMPL-Session-Data", "HIT");
+  }
+  else
+  {
+    FilterPipeline::Pointer readerPipeline = FilterPipeline::New();
+    readerPipeline->pushBack(reader);
+    for(QObject* receiver : receivers)
+    {
+      readerPipeline->addMessageReceiver(receiver);
+    }
+
+    snapshot = readerPipeline->execute();
+    if(readerPipeline->getErrorCode() < 0 || readerPipeline->getExecutionResult() != FilterPipeline::ExecutionResult::Completed)
+    {
+      return DataContainerArray::NullPointer();
+    }
+
+    // Data too large to keep resident is used once as it is
+    if(!store->insertSnapshot(sessionId, key, snapshot))
+    {
+      return snapshot;
+    }
+  }
+
+  QJsonObject remainingObj = pipelineObj;
+  remainingObj.remove(readerKey);
+  return SessionDataStore::CreateView(*snapshot, remainingObj);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -250,7 +327,7 @@ void ExecutePipelineController::serviceJSON()
 
   QJsonObject requestObj = requestDoc.object();
 
-  serviceJSON(requestObj);
+  serviceJSON(requestObj, true);
   if(m_ResponseObj.contains(SIMPL::JSON::ErrorCode) && m_ResponseObj[SIMPL::JSON::ErrorCode].toInt() < 0)
   {
     return;
@@ -275,7 +352,7 @@ void ExecutePipelineController::serviceMultiPart()
     return;
   }
 
-  QByteArray jsonData = m_Request->getParameter("Pipeline");
+  QByteArray jsonData = readFormField("Pipeline");
 
   QJsonParseError jsonParseError;
   QJsonDocument pipelineDoc = QJsonDocument::fromJson(jsonData, &jsonParseError);
@@ -288,19 +365,75 @@ void ExecutePipelineController::serviceMultiPart()
 
   QJsonObject pipelineObj = pipelineDoc.object();
 
+  // Identical requests are answered from the result cache
+  PipelineResultCache* cache = PipelineResultCache::Instance();
+  QByteArray cacheKey;
+  if(cache != nullptr)
+  {
+    cacheKey = PipelineResultCache::CreateExecuteKey(pipelineObj, pipelineMetadataObject, *m_Request);
+    if(m_Request->getHeader("Cache-Control").contains("no-cache"))
+    {
+      cache->invalidate(cacheKey);
+    }
+    else
+    {
+      QJsonObject cachedResponseObj;
+      QStringList cachedOutputNames;
+      std::vector<std::unique_ptr<QFile>> cachedOutputFiles;
+      if(cache->findExecuteResult(cacheKey, cachedResponseObj, cachedOutputNames, cachedOutputFiles))
+      {
+        cachedResponseObj[SIMPL::JSON::SessionID] = m_ResponseObj[SIMPL::JSON::SessionID];
+        m_Response->setHeader("X-SIMPL-Cache", "HIT");
+        sendMultiPartResponse(cachedResponseObj, cachedOutputNames, cachedOutputFiles);
+        return;
+      }
+    }
+  }
+
   pipelineObj = replacePipelineValuesUsingMetadata(pipelineObj, pipelineMetadataObject);
   if(m_ResponseObj.contains(SIMPL::JSON::ErrorCode) && m_ResponseObj[SIMPL::JSON::ErrorCode].toInt() < 0)
   {
     return;
   }
 
-  serviceJSON(pipelineObj);
+  serviceJSON(pipelineObj, false);
   if(m_ResponseObj.contains(SIMPL::JSON::ErrorCode) && m_ResponseObj[SIMPL::JSON::ErrorCode].toInt() < 0)
   {
     return;
   }
 
-  QJsonDocument jdoc(m_ResponseObj);
+  // Open every output file before anything is written so that a failure can still be reported as an error response
+  std::vector<std::unique_ptr<QFile>> outputFiles;
+  for(const QString& tempFilePath : m_TemporaryOutputFilePaths)
+  {
+    auto file = std::make_unique<QFile>(tempFilePath);
+    if(!file->open(QFile::ReadOnly))
+    {
+      QString errString = file->errorString();
+      QString errMsg = tr("%1: Server Response Creation Error - %2").arg(EndPoint()).arg(errString);
+      sendErrorResponse(HttpResponse::HttpStatusCode::InternalServerError, errMsg, -110);
+      return;
+    }
+    outputFiles.push_back(std::move(file));
+  }
+
+  sendMultiPartResponse(m_ResponseObj, m_OutputFilePaths, outputFiles);
+
+  // Only successful executions are cached, a failed one is retried on the next request
+  if(cache != nullptr && m_ResponseObj[SIMPL::JSON::Completed].toBool())
+  {
+    QJsonObject cachedResponseObj = m_ResponseObj;
+    cachedResponseObj.remove(SIMPL::JSON::SessionID);
+    cache->insertExecuteResult(cacheKey, cachedResponseObj, m_OutputFilePaths, m_TemporaryOutputFilePaths);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExecutePipelineController::sendMultiPartResponse(const QJsonObject& responseObj, const QStringList& outputNames, std::vector<std::unique_ptr<QFile>>& outputFiles)
+{
+  QJsonDocument jdoc(responseObj);
 
   m_Response->setStatusCode(HttpResponse::HttpStatusCode::OK);
 
@@ -308,41 +441,35 @@ void ExecutePipelineController::serviceMultiPart()
 
   m_Response->setHeader("Content-Type", QByteArray::fromStdString(tr("multipart/form-data; boundary=\"%1\"").arg(boundary).toStdString()));
 
-  QString body;
-  QTextStream bodyOut(&body);
+  // The body is sent with chunked transfer encoding so that only one block of each output file is held in memory
+  QByteArray part;
+  part.append(boundary.toUtf8()).append("\r\n");
+  part.append("Content-Disposition: form-data; name=\"pipelineResponse\"\r\n");
+  part.append("\r\n");
+  part.append(jdoc.toJson()).append("\n");
+  m_Response->write(part, false);
 
-  // Add pipeline response part to the body
-  bodyOut << boundary << "\r\n";
-  bodyOut << "Content-Disposition: form-data; name=\"pipelineResponse\"\r\n";
-  bodyOut << "\r\n";
-  bodyOut << jdoc.toJson() << "\n";
+  // Base64 encodes 3 bytes at a time, so blocks that are a multiple of 3 can be encoded independently
+  const int64_t blockSize = std::max<int64_t>(3, (m_Request->getMaxMemoryPartSize() / 4) * 3);
 
-  // Add output file data to the body
-  for(int i = 0; i < m_TemporaryOutputFilePaths.size(); i++)
+  for(size_t i = 0; i < outputFiles.size(); i++)
   {
-    QString tempFilePath = m_TemporaryOutputFilePaths[i];
-    QString filePath = m_OutputFilePaths[i];
-    QFile file(tempFilePath);
-    if(file.open(QFile::ReadOnly))
-    {
-      QByteArray fileData = file.readAll();
-      fileData = fileData.toBase64();
+    QFile& file = *outputFiles[i];
 
-      bodyOut << boundary << "\r\n";
-      bodyOut << tr("Content-Disposition: form-data; name=\"%1\"\r\n").arg(filePath);
-      bodyOut << "\r\n";
-      bodyOut << fileData + "\n";
-    }
-    else
+    part.clear();
+    part.append(boundary.toUtf8()).append("\r\n");
+    part.append(tr("Content-Disposition: form-data; name=\"%1\"\r\n").arg(outputNames[static_cast<int>(i)]).toUtf8());
+    part.append("\r\n");
+    m_Response->write(part, false);
+
+    while(!file.atEnd() && m_Response->isConnected())
     {
-      QString errString = file.errorString();
-      QString errMsg = tr("%1: Server Response Creation Error - %2").arg(EndPoint()).arg(errString);
-      sendErrorResponse(HttpResponse::HttpStatusCode::InternalServerError, errMsg, -110);
-      return;
+      m_Response->write(file.read(blockSize).toBase64(), false);
     }
+    m_Response->write("\n", false);
   }
 
-  m_Response->write(body.toUtf8(), true);
+  m_Response->write(QByteArray(), true);
 }
 
 // -----------------------------------------------------------------------------
@@ -525,7 +652,9 @@ void ExecutePipelineController::replaceInputFileParametersUsingMetadata(const QS
   for(QMultiMap<QByteArray, QByteArray>::iterator mapIter = parameterMap.begin(); mapIter != parameterMap.end(); mapIter++)
   {
     QString parameterName = mapIter.key();
-    QByteArray parameterData = mapIter.value();
+    const QByteArray& parameterData = mapIter.value();
+    // Large inputs are spooled to disk by the request instead of being held in the parameter map
+    QTemporaryFile* spooledData = m_Request->getUploadedFile(mapIter.key());
 
     // If the property value is a path and it came from Windows, we must remove the colon because it isn't
     // allowed as part of the path on some file systems.
@@ -549,7 +678,19 @@ void ExecutePipelineController::replaceInputFileParametersUsingMetadata(const QS
       if(tempFile.open(QFile::ReadWrite))
       {
         // Write out the file data to the temporary file we created on the server
-        tempFile.write(parameterData);
+        if(spooledData != nullptr)
+        {
+          const int64_t blockSize = std::max<int64_t>(1, m_Request->getMaxMemoryPartSize());
+          spooledData->seek(0);
+          while(!spooledData->atEnd())
+          {
+            tempFile.write(spooledData->read(blockSize));
+          }
+        }
+        else
+        {
+          tempFile.write(parameterData);
+        }
         tempFile.close();
 
         // Update the pipeline json with the file path that we just wrote out to
@@ -578,13 +719,30 @@ void ExecutePipelineController::replaceInputFileParametersUsingMetadata(const QS
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray ExecutePipelineController::readFormField(const QByteArray& fieldName) const
+{
+  QTemporaryFile* spooledData = m_Request->getUploadedFile(fieldName);
+  if(spooledData == nullptr)
+  {
+    return m_Request->getParameter(fieldName);
+  }
+  // The pipeline and its metadata must be parsed as a whole, so a spooled field is read back completely
+  spooledData->seek(0);
+  QByteArray fieldData = spooledData->readAll();
+  spooledData->seek(0);
+  return fieldData;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 QJsonObject ExecutePipelineController::getPipelineMetadata()
 {
   QJsonParseError jsonParseError;
-  QByteArray jsonData = m_Request->getParameter("PipelineMetadata");
+  QByteArray jsonData = readFormField("PipelineMetadata");
   QJsonDocument pipelineReplacementLookupDoc = QJsonDocument::fromJson(jsonData, &jsonParseError);
   if(jsonParseError.error != QJsonParseError::ParseError::NoError)
   {
@@ -32,6 +32,10 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
+#include <QtCore/QFile>
 #include <QtCore/QJsonObject>
 #include <QtCore/QTemporaryDir>
 
@@ -40,6 +44,8 @@
 #include "QtWebApp/httpserver/httpresponse.h"
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 
@@ -76,14 +82,48 @@ private:
 
   void cleanup();
 
-  void serviceJSON(QJsonObject pipelineObj);
+  /**
+   * @brief Executes the pipeline and fills in the response object.
+   * @param pipelineObj
+   * @param useSessionData Whether a leading DataContainerReader may be answered from the
+   * data resident for the session.  Only server side input files can be matched across requests.
+   */
+  void serviceJSON(QJsonObject pipelineObj, bool useSessionData);
   void serviceJSON();
 
+  /**
+   * @brief Prepares the DataContainerArray the pipeline executes against.  If the pipeline
+   * starts with a DataContainerReader, the reader is taken out of the pipeline and its data
+   * comes from the session's resident snapshot, which is read and stored first if needed.
+   * @param pipeline
+   * @param pipelineObj
+   * @param receivers Message receivers of the pipeline
+   * @return The DataContainerArray to execute against or nullptr if reading the data failed
+   */
+  DataContainerArray::Pointer prepareSessionData(FilterPipeline* pipeline, const QJsonObject& pipelineObj, const std::vector<QObject*>& receivers);
+
   // Functions that process multi-part requests
   void serviceMultiPart();
 
+  /**
+   * @brief Streams the multi-part response made of the JSON response object followed by the
+   * base64 encoded content of each output file.
+   * @param responseObj
+   * @param outputNames Names of the output files as the client knows them
+   * @param outputFiles Output files, already opened for reading
+   */
+  void sendMultiPartResponse(const QJsonObject& responseObj, const QStringList& outputNames, std::vector<std::unique_ptr<QFile>>& outputFiles);
+
   void sendErrorResponse(HttpResponse::HttpStatusCode statusCode, const QString& errorMsg, int errCode);
 
+  /**
+   * @brief Returns the value of a multi-part form field. Fields larger than the request's
+   * in-memory limit are spooled to disk by the request and are read back from there.
+   * @param fieldName
+   * @return
+   */
+  QByteArray readFormField(const QByteArray& fieldName) const;
+
   QJsonObject getPipelineMetadata();
 
   QJsonObject replacePipelineValuesUsingMetadata(QJsonObject pipelineJsonObj, QJsonObject pipelineMetadataObject);
@@ -47,6 +47,7 @@
 #include "QtWebApp/httpserver/httpsessionstore.h"
 
 #include "SIMPLib/REST/PipelineListener.h"
+#include "SIMPLib/REST/PipelineResultCache.h"
 #include "SIMPLib/REST/V1Controllers/PreflightPipelineMessageHandler.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 
@@ -115,6 +116,35 @@ void PreflightPipelineController::service(HttpRequest& request, HttpResponse& re
 
   // Pipeline
   QJsonObject pipelineObj = requestObj[SIMPL::JSON::Pipeline].toObject();
+
+  // A preflight only depends on the pipeline and the input files it names, so unchanged requests are memoised
+  PipelineResultCache* cache = PipelineResultCache::Instance();
+  QByteArray cacheKey;
+  if(cache != nullptr)
+  {
+    cacheKey = PipelineResultCache::CreatePreflightKey(pipelineObj);
+    if(request.getHeader("Cache-Control").contains("no-cache"))
+    {
+      // Preflight again; the fresh result replaces the entry below
+      cache->invalidate(cacheKey);
+    }
+    else
+    {
+      QJsonObject cachedObj;
+      if(cache->findPreflightResult(cacheKey, cachedObj))
+      {
+        for(auto iter = cachedObj.constBegin(); iter != cachedObj.constEnd(); ++iter)
+        {
+          rootObj[iter.key()] = iter.value();
+        }
+        response.setHeader("X-SIMPL-Cache", "HIT");
+        QJsonDocument jdoc(rootObj);
+        response.write(jdoc.toJson(), true);
+        return;
+      }
+    }
+  }
+
   FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(pipelineObj);
   if(pipeline.get() == nullptr)
   {
@@ -189,6 +219,13 @@ void PreflightPipelineController::service(HttpRequest& request, HttpResponse& re
   rootObj[SIMPL::JSON::PipelineErrors] = errors;
   rootObj[SIMPL::JSON::PipelineWarnings] = warnings;
 
+  if(!cacheKey.isEmpty())
+  {
+    QJsonObject cachedObj = rootObj;
+    cachedObj.remove(SIMPL::JSON::SessionID);
+    cache->insertPreflightResult(cacheKey, cachedObj);
+  }
+
   QJsonDocument jdoc(rootObj);
 
   response.write(jdoc.toJson(), true);
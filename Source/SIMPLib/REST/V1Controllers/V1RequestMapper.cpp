@@ -35,6 +35,7 @@
 
 #include "ApiNotFoundController.h"
 #include "ExecutePipelineController.h"
+#include "InvalidateResultCacheController.h"
 #include "ListFilterParametersController.h"
 #include "LoadedPluginsController.h"
 #include "NamesOfFiltersController.h"
@@ -108,6 +109,10 @@ void V1RequestMapper::service(HttpRequest& request, HttpResponse& response)
   {
     PreflightPipelineController(getListenHost(), getListenPort()).service(request, response);
   }
+  else if(path.endsWith(InvalidateResultCacheController::EndPoint()))
+  {
+    InvalidateResultCacheController(getListenHost(), getListenPort()).service(request, response);
+  }
   // All other pathes are mapped to the static file controller.
   // In this case, a single instance is used for multiple requests.
   else
@@ -107,6 +107,22 @@ void ParallelData3DAlgorithm::setGrain(size_t grain)
   m_Grain = grain;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker* ParallelData3DAlgorithm::getProgressTracker() const
+{
+  return m_ProgressTracker;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelData3DAlgorithm::setProgressTracker(ProgressTracker* tracker)
+{
+  m_ProgressTracker = tracker;
+}
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 // -----------------------------------------------------------------------------
 //
@@ -115,4 +131,4 @@ void ParallelData3DAlgorithm::setPartitioner(const tbb::auto_partitioner& partit
 {
   m_Partitioner = partitioner;
 }
-#endif
\ No newline at end of file
+#endif
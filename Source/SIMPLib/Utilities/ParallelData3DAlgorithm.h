@@ -38,6 +38,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLRange3D.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -104,6 +105,20 @@ public:
    */
   void setGrain(size_t grain);
 
+  /**
+   * @brief Returns the progress tracker that completed sub-ranges are reported to.
+   * @return
+   */
+  ProgressTracker* getProgressTracker() const;
+
+  /**
+   * @brief Sets the progress tracker that completed sub-ranges are reported to.  Each
+   * sub-range adds its number of cells to the tracker once the body returns, so the
+   * body itself does not need to report progress.  Pass nullptr to disable.
+   * @param tracker
+   */
+  void setProgressTracker(ProgressTracker* tracker);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   /**
    * @brief Sets the partitioner for parallelization.
@@ -118,6 +133,44 @@ public:
    */
   template <typename Body>
   void execute(const Body& body)
+  {
+    if(m_ProgressTracker != nullptr)
+    {
+      run(ProgressBody<Body>(body, m_ProgressTracker));
+    }
+    else
+    {
+      run(body);
+    }
+  }
+
+private:
+  /**
+   * @brief Wraps a body so that each completed sub-range is added to a ProgressTracker.
+   */
+  template <typename Body>
+  class ProgressBody
+  {
+  public:
+    ProgressBody(const Body& body, ProgressTracker* tracker)
+    : m_Body(body)
+    , m_Tracker(tracker)
+    {
+    }
+
+    void operator()(const SIMPLRange3D& range) const
+    {
+      m_Body(range);
+      m_Tracker->increment(static_cast<int64_t>((range[1] - range[0]) * (range[3] - range[2]) * (range[5] - range[4])));
+    }
+
+  private:
+    const Body& m_Body;
+    ProgressTracker* m_Tracker = nullptr;
+  };
+
+  template <typename Body>
+  void run(const Body& body)
   {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     if(m_RunParallel)
@@ -133,10 +186,10 @@ public:
     }
   }
 
-private:
   SIMPLRange3D m_Range;
   size_t m_Grain = 1;
   bool m_RunParallel = false;
+  ProgressTracker* m_ProgressTracker = nullptr;
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::auto_partitioner m_Partitioner;
 #endif
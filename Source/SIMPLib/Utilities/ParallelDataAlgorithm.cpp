@@ -91,6 +91,22 @@ void ParallelDataAlgorithm::setRange(size_t min, size_t max)
   m_Range = {min, max};
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker* ParallelDataAlgorithm::getProgressTracker() const
+{
+  return m_ProgressTracker;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelDataAlgorithm::setProgressTracker(ProgressTracker* tracker)
+{
+  m_ProgressTracker = tracker;
+}
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 // -----------------------------------------------------------------------------
 //
@@ -106,3 +106,19 @@ void ParallelTaskAlgorithm::wait()
   m_CurThreads = 0;
 #endif
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker* ParallelTaskAlgorithm::getProgressTracker() const
+{
+  return m_ProgressTracker;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::setProgressTracker(ProgressTracker* tracker)
+{
+  m_ProgressTracker = tracker;
+}
@@ -37,6 +37,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -83,6 +84,19 @@ public:
    */
   void setMaxThreads(uint32_t threads);
 
+  /**
+   * @brief Returns the progress tracker that completed tasks are reported to.
+   * @return
+   */
+  ProgressTracker* getProgressTracker() const;
+
+  /**
+   * @brief Sets the progress tracker that completed tasks are reported to.  Each task
+   * adds one unit to the tracker once it returns.  Pass nullptr to disable.
+   * @param tracker
+   */
+  void setProgressTracker(ProgressTracker* tracker);
+
   /**
    * @brief Executes the given object's function operator.  If parallel algorithms
    * is enabled, this process is multi-threaded.  Otherwise, this process is done
@@ -91,6 +105,49 @@ public:
    */
   template <typename Body>
   void execute(const Body& body)
+  {
+    if(m_ProgressTracker != nullptr)
+    {
+      run(ProgressTask<Body>(body, m_ProgressTracker));
+    }
+    else
+    {
+      run(body);
+    }
+  }
+
+  /**
+   * @brief Waits for the threads to finish and resets the current thread count.
+   */
+  void wait();
+
+private:
+  /**
+   * @brief Wraps a task so that its completion is added to a ProgressTracker.
+   */
+  template <typename Body>
+  class ProgressTask
+  {
+  public:
+    ProgressTask(const Body& body, ProgressTracker* tracker)
+    : m_Body(body)
+    , m_Tracker(tracker)
+    {
+    }
+
+    void operator()() const
+    {
+      m_Body();
+      m_Tracker->increment(1);
+    }
+
+  private:
+    Body m_Body;
+    ProgressTracker* m_Tracker = nullptr;
+  };
+
+  template <typename Body>
+  void run(const Body& body)
   {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     if(m_Parallelization)
@@ -109,14 +166,9 @@ public:
     }
   }
 
-  /**
-   * @brief Waits for the threads to finish and resets the current thread count.
-   */
-  void wait();
-
-private:
   bool m_Parallelization = false;
   uint32_t m_MaxThreads = 1;
+  ProgressTracker* m_ProgressTracker = nullptr;
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   uint32_t m_CurThreads = 0;
   std::shared_ptr<tbb::task_group> m_TaskGroup;
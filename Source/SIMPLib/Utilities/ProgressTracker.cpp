@@ -0,0 +1,241 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ProgressTracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+int64_t currentNanos()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// -----------------------------------------------------------------------------
+size_t threadSlot(size_t numSlots)
+{
+  static thread_local const size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id());
+  return slot % numSlots;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressRateLimiter::ProgressRateLimiter(std::chrono::milliseconds interval)
+: m_IntervalNanos(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count())
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ProgressRateLimiter::tryAcquire()
+{
+  int64_t now = currentNanos();
+  int64_t next = m_NextReportNanos.load(std::memory_order_relaxed);
+  if(now < next)
+  {
+    return false;
+  }
+  return m_NextReportNanos.compare_exchange_strong(next, now + m_IntervalNanos, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ProgressRateLimiter::tryAdvance(int32_t percent)
+{
+  int32_t last = m_LastPercent.load(std::memory_order_relaxed);
+  while(last < percent)
+  {
+    if(m_LastPercent.compare_exchange_weak(last, percent, std::memory_order_relaxed))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ProgressRateLimiter::shouldReport(int32_t percent)
+{
+  if(percent <= m_LastPercent.load(std::memory_order_relaxed))
+  {
+    return false;
+  }
+  if(percent < 100 && !tryAcquire())
+  {
+    return false;
+  }
+  return tryAdvance(percent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressRateLimiter::reset()
+{
+  m_LastPercent.store(-1, std::memory_order_relaxed);
+  m_NextReportNanos.store(0, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker::ProgressTracker(int64_t total, ReportFunction reportFunction, std::chrono::milliseconds interval)
+: m_Root(this)
+, m_Total(total)
+, m_ReportFunction(std::move(reportFunction))
+, m_RateLimiter(interval)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker::ProgressTracker(ProgressTracker* root, int64_t total, int64_t parentUnits)
+: m_Root(root)
+, m_Total(total)
+, m_ParentUnits(parentUnits)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker::~ProgressTracker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressTracker::increment(int64_t amount)
+{
+  m_Slots[threadSlot(k_NumSlots)].value.fetch_add(amount, std::memory_order_relaxed);
+  m_Root->tryReport();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressTracker* ProgressTracker::createChild(int64_t total, int64_t parentUnits)
+{
+  std::unique_ptr<ProgressTracker> child(new ProgressTracker(m_Root, total, parentUnits));
+  ProgressTracker* childPtr = child.get();
+  std::lock_guard<std::mutex> lock(m_ChildrenMutex);
+  m_Children.push_back(std::move(child));
+  return childPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ProgressTracker::getCompleted() const
+{
+  int64_t completed = 0;
+  for(const Slot& slot : m_Slots)
+  {
+    completed += slot.value.load(std::memory_order_relaxed);
+  }
+  return completed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ProgressTracker::getTotal() const
+{
+  return m_Total;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ProgressTracker::getFraction() const
+{
+  if(m_Total <= 0)
+  {
+    return 1.0;
+  }
+
+  double completed = static_cast<double>(getCompleted());
+  {
+    std::lock_guard<std::mutex> lock(m_ChildrenMutex);
+    for(const auto& child : m_Children)
+    {
+      completed += child->getFraction() * static_cast<double>(child->m_ParentUnits);
+    }
+  }
+  return std::min(1.0, completed / static_cast<double>(m_Total));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressTracker::flush()
+{
+  ProgressTracker* root = m_Root;
+  int32_t percent = root->computePercent();
+  if(root->m_ReportFunction && root->m_RateLimiter.tryAdvance(percent))
+  {
+    root->m_ReportFunction(percent);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressTracker::tryReport()
+{
+  // Only the thread that wins the interval pays for summing the counters
+  if(!m_ReportFunction || !m_RateLimiter.tryAcquire())
+  {
+    return;
+  }
+  int32_t percent = computePercent();
+  if(m_RateLimiter.tryAdvance(percent))
+  {
+    m_ReportFunction(percent);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ProgressTracker::computePercent() const
+{
+  return static_cast<int32_t>(std::floor(getFraction() * 100.0));
+}
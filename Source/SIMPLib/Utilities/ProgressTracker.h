@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ProgressRateLimiter class decides, without locking, which caller gets to
+ * publish a progress update.  An update is accepted when the percentage has advanced past
+ * the last published value and the reporting interval has elapsed.  Reaching 100% is
+ * always published exactly once regardless of the interval.
+ */
+class SIMPLib_EXPORT ProgressRateLimiter
+{
+public:
+  explicit ProgressRateLimiter(std::chrono::milliseconds interval = std::chrono::milliseconds(250));
+  ~ProgressRateLimiter() = default;
+
+  /**
+   * @brief Returns true for exactly one caller once the interval has elapsed since the
+   * last successful call.
+   * @return
+   */
+  bool tryAcquire();
+
+  /**
+   * @brief Records the percentage as published if it is greater than the last published
+   * value.  Returns true for exactly one caller per percentage.
+   * @param percent
+   * @return
+   */
+  bool tryAdvance(int32_t percent);
+
+  /**
+   * @brief Convenience function combining tryAcquire and tryAdvance.  Returns true if the
+   * caller should publish the given percentage.
+   * @param percent
+   * @return
+   */
+  bool shouldReport(int32_t percent);
+
+  /**
+   * @brief Forgets the last published percentage so a new pass can report from 0% again.
+   */
+  void reset();
+
+public:
+  ProgressRateLimiter(const ProgressRateLimiter&) = delete;            // Copy Constructor Not Implemented
+  ProgressRateLimiter(ProgressRateLimiter&&) = delete;                 // Move Constructor Not Implemented
+  ProgressRateLimiter& operator=(const ProgressRateLimiter&) = delete; // Copy Assignment Not Implemented
+  ProgressRateLimiter& operator=(ProgressRateLimiter&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  int64_t m_IntervalNanos = 0;
+  std::atomic<int64_t> m_NextReportNanos = {0};
+  std::atomic<int32_t> m_LastPercent = {-1};
+};
+
+/**
+ * @brief The ProgressTracker class accumulates the progress of parallel work without a mutex
+ * on the hot path.  Worker threads add to cache line padded counters selected per thread and
+ * whichever thread wins the rate limiter computes the overall percentage and hands it to the
+ * report function, so at most one update is published per interval.
+ *
+ * Nested work is tracked by creating child trackers.  A child owns its own counters and total
+ * and maps its completion onto a fixed number of units of its parent, so a filter can report
+ * a single overall percentage over several differently sized passes.
+ */
+class SIMPLib_EXPORT ProgressTracker
+{
+public:
+  using ReportFunction = std::function<void(int32_t)>;
+
+  /**
+   * @brief Creates a root tracker.
+   * @param total Number of units that make up 100%
+   * @param reportFunction Called with the overall percentage, from whichever thread publishes
+   * @param interval Minimum time between two published updates
+   */
+  ProgressTracker(int64_t total, ReportFunction reportFunction, std::chrono::milliseconds interval = std::chrono::milliseconds(250));
+  ~ProgressTracker();
+
+  /**
+   * @brief Adds completed units and publishes the overall percentage if the rate limiter allows it.
+   * This function is safe to call concurrently from any number of threads.
+   * @param amount
+   */
+  void increment(int64_t amount = 1);
+
+  /**
+   * @brief Creates a child tracker covering parentUnits of this tracker's total.  The child is
+   * owned by this tracker.  Children should be created before the work they track starts.
+   * @param total Number of units that make up 100% of the child
+   * @param parentUnits Number of this tracker's units the child covers
+   * @return
+   */
+  ProgressTracker* createChild(int64_t total, int64_t parentUnits);
+
+  /**
+   * @brief Returns the units added directly to this tracker.
+   * @return
+   */
+  int64_t getCompleted() const;
+
+  /**
+   * @brief Returns the number of units that make up 100%.
+   * @return
+   */
+  int64_t getTotal() const;
+
+  /**
+   * @brief Returns the completed fraction in [0, 1] including all children.
+   * @return
+   */
+  double getFraction() const;
+
+  /**
+   * @brief Publishes the current percentage bypassing the reporting interval.  Call this once
+   * the tracked work is finished so the final value is not lost to rate limiting.
+   */
+  void flush();
+
+public:
+  ProgressTracker(const ProgressTracker&) = delete;            // Copy Constructor Not Implemented
+  ProgressTracker(ProgressTracker&&) = delete;                 // Move Constructor Not Implemented
+  ProgressTracker& operator=(const ProgressTracker&) = delete; // Copy Assignment Not Implemented
+  ProgressTracker& operator=(ProgressTracker&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  static constexpr size_t k_NumSlots = 16;
+
+  struct alignas(64) Slot
+  {
+    std::atomic<int64_t> value = {0};
+  };
+
+  ProgressTracker(ProgressTracker* root, int64_t total, int64_t parentUnits);
+
+  void tryReport();
+  int32_t computePercent() const;
+
+  std::array<Slot, k_NumSlots> m_Slots;
+  ProgressTracker* m_Root = nullptr;
+  int64_t m_Total = 0;
+  int64_t m_ParentUnits = 0;
+  ReportFunction m_ReportFunction;
+  ProgressRateLimiter m_RateLimiter;
+
+  mutable std::mutex m_ChildrenMutex;
+  std::vector<std::unique_ptr<ProgressTracker>> m_Children;
+};
@@ -0,0 +1,146 @@
+/* ============================================================================
+ * Copyright (c) 2022-2022 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+#include "SIMPLib/Utilities/ProgressTracker.h"
+
+class ProgressTrackerTest
+{
+public:
+  ProgressTrackerTest() = default;
+  virtual ~ProgressTrackerTest() = default;
+
+  class EmptyBody
+  {
+  public:
+    void operator()(const SIMPLRange& range) const
+    {
+    }
+  };
+
+  class EmptyTask
+  {
+  public:
+    void operator()() const
+    {
+    }
+  };
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRateLimiter()
+  {
+    ProgressRateLimiter limiter(std::chrono::milliseconds(60000));
+    DREAM3D_REQUIRE_EQUAL(limiter.shouldReport(10), true)
+    // Within the interval nothing below 100% is accepted
+    DREAM3D_REQUIRE_EQUAL(limiter.shouldReport(20), false)
+    DREAM3D_REQUIRE_EQUAL(limiter.shouldReport(100), true)
+    DREAM3D_REQUIRE_EQUAL(limiter.shouldReport(100), false)
+
+    limiter.reset();
+    DREAM3D_REQUIRE_EQUAL(limiter.shouldReport(5), true)
+    DREAM3D_REQUIRE_EQUAL(limiter.tryAdvance(3), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParallelDataAlgorithm()
+  {
+    std::atomic<int32_t> lastPercent = {-1};
+    ProgressTracker tracker(100000, [&lastPercent](int32_t percent) { lastPercent = percent; }, std::chrono::milliseconds(0));
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, 100000);
+    dataAlg.setProgressTracker(&tracker);
+    dataAlg.execute(EmptyBody());
+    tracker.flush();
+
+    DREAM3D_REQUIRE_EQUAL(tracker.getCompleted(), 100000)
+    DREAM3D_REQUIRE_EQUAL(lastPercent.load(), 100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChildTrackers()
+  {
+    int32_t lastPercent = -1;
+    ProgressTracker tracker(4, [&lastPercent](int32_t percent) { lastPercent = percent; }, std::chrono::milliseconds(60000));
+
+    ProgressTracker* first = tracker.createChild(10, 2);
+    ProgressTracker* second = tracker.createChild(1000, 2);
+
+    first->increment(5);
+    DREAM3D_REQUIRE_EQUAL(static_cast<int32_t>(tracker.getFraction() * 100.0), 25)
+
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setProgressTracker(second);
+    for(int32_t i = 0; i < 1000; i++)
+    {
+      taskAlg.execute(EmptyTask());
+    }
+    taskAlg.wait();
+
+    DREAM3D_REQUIRE_EQUAL(second->getCompleted(), 1000)
+    DREAM3D_REQUIRE_EQUAL(static_cast<int32_t>(tracker.getFraction() * 100.0), 75)
+
+    first->increment(5);
+    tracker.flush();
+    DREAM3D_REQUIRE_EQUAL(lastPercent, 100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ProgressTrackerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRateLimiter())
+    DREAM3D_REGISTER_TEST(TestParallelDataAlgorithm())
+    DREAM3D_REGISTER_TEST(TestChildTrackers())
+  }
+
+public:
+  ProgressTrackerTest(const ProgressTrackerTest&) = delete;            // Copy Constructor Not Implemented
+  ProgressTrackerTest(ProgressTrackerTest&&) = delete;                 // Move Constructor Not Implemented
+  ProgressTrackerTest& operator=(const ProgressTrackerTest&) = delete; // Copy Assignment Not Implemented
+  ProgressTrackerTest& operator=(ProgressTrackerTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -24,6 +24,7 @@ ServerSettings::ServerSettings(QSettings& settings)
   sslCertFile = settings.value("ssl/my.cert", "").toString();
   maxRequestSize = settings.value("maxRequestSize", 16000).toInt();
   maxMultiPartSize = settings.value("maxMultiPartSize", 4000000000LL).toLongLong();
+  maxMemoryPartSize = settings.value("maxMemoryPartSize", 1048576LL).toLongLong();
   verbose = settings.value("verbose", false).toBool();
   settings.endGroup();
 
@@ -51,6 +52,18 @@ ServerSettings::ServerSettings(QSettings& settings)
   cookieComment = settings.value("cookieComment", "Identifies the user").toString();
   settings.endGroup();
 
+  settings.beginGroup("resultCache");
+  resultCacheEnabled = settings.value("enabled", false).toBool();
+  resultCachePath = settings.value("path", "ResultCache").toString();
+  resultCacheMaxDiskSize = settings.value("maxDiskSize", 10737418240LL).toLongLong();
+  preflightCacheEntries = settings.value("preflightEntries", 256).toInt();
+  settings.endGroup();
+
+  settings.beginGroup("sessionData");
+  sessionDataEnabled = settings.value("enabled", true).toBool();
+  sessionDataMaxMemory = settings.value("maxMemory", 4294967296LL).toLongLong();
+  settings.endGroup();
+
   settings.beginGroup("logging");
   logFileName = settings.value("fileName", "Logs/SIMPLRestServer.log").toString();
   minLevel = settings.value("minLevel", 1).toInt();
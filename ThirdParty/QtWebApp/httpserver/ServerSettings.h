@@ -29,6 +29,7 @@ public:
   QString sslCertFile = "ssl/my.cert";
   int32_t maxRequestSize = 16000;
   int64_t maxMultiPartSize = 4000000000;
+  int64_t maxMemoryPartSize = 1048576;
   bool verbose = false;
 
   //  [templates]
@@ -53,6 +54,16 @@ public:
   QString cookieComment = "Identifies the user";
   //    ;cookieDomain=stefanfrings.de
 
+  //   [resultCache]
+  bool resultCacheEnabled = false;
+  QString resultCachePath = "ResultCache";
+  int64_t resultCacheMaxDiskSize = 10737418240;
+  int32_t preflightCacheEntries = 256;
+
+  //   [sessionData]
+  bool sessionDataEnabled = true;
+  int64_t sessionDataMaxMemory = 4294967296;
+
   //    [logging]
   //   ; The logging settings become effective after you comment in the related lines of code in main.cpp.
   QString logFileName = "Logs/SIMPLRestServer.log";
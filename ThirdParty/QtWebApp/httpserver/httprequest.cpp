@@ -15,6 +15,7 @@ HttpRequest::HttpRequest(ServerSettings* settings)
   expectedBodySize = 0;
   maxSize = settings->maxRequestSize;
   maxMultiPartSize = settings->maxMultiPartSize;
+  maxMemoryPartSize = settings->maxMemoryPartSize;
   tempFile = nullptr;
 }
 
@@ -118,7 +119,7 @@ void HttpRequest::readHeader(QTcpSocket* socket)
     QByteArray contentLength = headers.value("content-length");
     if(!contentLength.isEmpty())
     {
-      expectedBodySize = contentLength.toInt();
+      expectedBodySize = contentLength.toLongLong();
     }
     if(expectedBodySize == 0)
     {
@@ -140,7 +141,7 @@ void HttpRequest::readHeader(QTcpSocket* socket)
     else
     {
 #ifdef SUPERVERBOSE
-      qDebug("HttpRequest: expect %i bytes body", expectedBodySize);
+      qDebug("HttpRequest: expect %lld bytes body", static_cast<long long>(expectedBodySize));
 #endif
       status = waitForBody;
     }
@@ -156,7 +157,7 @@ void HttpRequest::readBody(QTcpSocket* socket)
 #ifdef SUPERVERBOSE
     qDebug("HttpRequest: receive body");
 #endif
-    int toRead = expectedBodySize - bodyData.size();
+    int toRead = static_cast<int>(expectedBodySize - bodyData.size());
     QByteArray newData = socket->read(toRead);
     currentSize += newData.size();
     bodyData.append(newData);
@@ -181,8 +182,8 @@ void HttpRequest::readBody(QTcpSocket* socket)
       tempFile->open();
     }
     // Transfer data in 64kb blocks
-    int fileSize = tempFile->size();
-    int toRead = expectedBodySize - fileSize;
+    int64_t fileSize = tempFile->size();
+    int64_t toRead = expectedBodySize - fileSize;
     if(toRead > 65536)
     {
       toRead = 65536;
@@ -458,11 +459,26 @@ void HttpRequest::parseMultiPartFile()
         if(fileName.isEmpty() && !fieldName.isEmpty())
         {
           // last field was a form field
-          fieldValue.remove(fieldValue.size() - 2, 2);
-          parameters.insert(fieldName, fieldValue);
+          if(uploadedFile != nullptr)
+          {
+            // The field was too large to keep in memory and has been spooled
+            uploadedFile->resize(uploadedFile->size() - 2);
+            uploadedFile->flush();
+            uploadedFile->seek(0);
+            parameters.insert(fieldName, QByteArray());
+            uploadedFiles.insert(fieldName, uploadedFile);
+#ifdef SUPERVERBOSE
+            qDebug("HttpRequest: spooled parameter %s, size is %lld", fieldName.data(), static_cast<long long>(uploadedFile->size()));
+#endif
+          }
+          else
+          {
+            fieldValue.remove(fieldValue.size() - 2, 2);
+            parameters.insert(fieldName, fieldValue);
 #ifdef SUPERVERBOSE
-          qDebug("HttpRequest: set parameter %s=%s", fieldName.data(), fieldValue.data());
+            qDebug("HttpRequest: set parameter %s=%s", fieldName.data(), fieldValue.data());
 #endif
+          }
         }
         else if(!fileName.isEmpty() && !fieldName.isEmpty())
         {
@@ -488,8 +504,27 @@ void HttpRequest::parseMultiPartFile()
       if(fileName.isEmpty() && !fieldName.isEmpty())
       {
         // this is a form field.
-        currentSize += line.size();
-        fieldValue.append(line);
+        if(uploadedFile == nullptr && fieldValue.size() + line.size() > maxMemoryPartSize)
+        {
+          // Switch to a temp file once the field exceeds the memory limit
+          uploadedFile = new QTemporaryFile();
+          uploadedFile->open();
+          uploadedFile->write(fieldValue);
+          fieldValue.clear();
+        }
+        if(uploadedFile != nullptr)
+        {
+          uploadedFile->write(line);
+          if(uploadedFile->error() != 0u)
+          {
+            qCritical("HttpRequest: error writing temp file, %s", qPrintable(uploadedFile->errorString()));
+          }
+        }
+        else
+        {
+          currentSize += line.size();
+          fieldValue.append(line);
+        }
       }
       else if(!fileName.isEmpty() && !fieldName.isEmpty())
       {
@@ -542,6 +577,11 @@ QTemporaryFile* HttpRequest::getUploadedFile(const QByteArray fieldName) const
   return uploadedFiles.value(fieldName);
 }
 
+int64_t HttpRequest::getMaxMemoryPartSize() const
+{
+  return maxMemoryPartSize;
+}
+
 QByteArray HttpRequest::getCookie(const QByteArray& name) const
 {
   return cookies.value(name);
@@ -25,12 +25,17 @@
   <code><pre>
   maxRequestSize=16000
   maxMultiPartSize=1000000
+  maxMemoryPartSize=1048576
   </pre></code>
   <p>
   MaxRequestSize is the maximum size of a HTTP request. In case of
   multipart/form-data requests (also known as file-upload), the maximum
   size of the body must not exceed maxMultiPartSize.
   The body is always a little larger than the file itself.
+  <p>
+  Multipart bodies are written to a temporary file as they arrive. Form fields
+  larger than maxMemoryPartSize are not kept in memory but spooled to their own
+  temporary file, which is returned by getUploadedFile() just like a file upload.
 */
 
 class QtWebAppLib_EXPORT HttpRequest
@@ -144,6 +149,12 @@ public:
   */
   QTemporaryFile* getUploadedFile(const QByteArray fieldName) const;
 
+  /**
+    Get the maximum number of bytes of a single part that is kept in memory.
+    Request handlers should use the same limit when buffering response data.
+  */
+  int64_t getMaxMemoryPartSize() const;
+
   /**
     Get the value of a cookie.
     @param name Name of the cookie
@@ -200,11 +211,14 @@ private:
   /** Maximum allowed size of multipart forms in bytes. */
   int64_t maxMultiPartSize;
 
+  /** Maximum size of a multipart form field that is kept in memory. */
+  int64_t maxMemoryPartSize;
+
   /** Current size */
   int currentSize;
 
   /** Expected size of body */
-  int expectedBodySize;
+  int64_t expectedBodySize;
 
   /** Name of the current header, or empty if no header is being processed */
   QByteArray currentHeader;
@@ -165,6 +165,7 @@ HttpSession HttpSessionStore::getSession(const QByteArray id)
 // -----------------------------------------------------------------------------
 void HttpSessionStore::sessionTimerEvent()
 {
+  QList<QByteArray> expiredIds;
   QMutexLocker locker(&mutex);
   qint64 now = QDateTime::currentMSecsSinceEpoch();
   QMap<QByteArray, HttpSession>::iterator i = sessions.begin();
@@ -177,9 +178,16 @@ void HttpSessionStore::sessionTimerEvent()
     if(now - lastAccess > expirationTime)
     {
       qDebug("HttpSessionStore: session %s expired", session.getId().data());
+      expiredIds.push_back(session.getId());
       sessions.erase(prev);
     }
   }
+  locker.unlock();
+
+  for(const QByteArray& id : expiredIds)
+  {
+    Q_EMIT sessionRemoved(id);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -190,4 +198,6 @@ void HttpSessionStore::removeSession(HttpSession session)
   mutex.lock();
   sessions.remove(session.getId());
   mutex.unlock();
+
+  Q_EMIT sessionRemoved(session.getId());
 }
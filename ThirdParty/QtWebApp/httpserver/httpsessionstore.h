@@ -90,6 +90,13 @@ public:
   /** Delete a session */
   void removeSession(HttpSession session);
 
+Q_SIGNALS:
+  /**
+   Emitted after a session was deleted, either explicitly or because it expired.
+   @param id ID number of the session
+  */
+  void sessionRemoved(const QByteArray& id);
+
 protected:
   /** Storage for the sessions */
   QMap<QByteArray, HttpSession> sessions;